@@ -76,6 +76,7 @@ void FMockAsyncTaskAccelByte::Tick()
 void FMockAsyncTaskAccelByte::Initialize()
 {
 	Parameter.EpicPtr = this->Epic;
+	Parameter.StartedCount++;
 	FOnlineAsyncTaskAccelByte::Initialize();
 	FOnlineAsyncTaskAccelByte::ExecuteCriticalSectionAction(Parameter.CreateChildDelegate);
 };
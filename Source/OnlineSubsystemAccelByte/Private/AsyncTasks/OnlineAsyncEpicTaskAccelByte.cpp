@@ -40,7 +40,7 @@ void FOnlineAsyncEpicTaskAccelByte::Tick()
 		FOnlineAsyncTaskAccelByte::OnTaskStartWorking();
 	}
 
-	if (TaskContainer.Num() == 0)
+	if (StackCount == 0)
 	{
 		//nothing to do, set as complete
 		this->CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
@@ -54,32 +54,20 @@ void FOnlineAsyncEpicTaskAccelByte::Tick()
 	// To ignore large delta (breakpoints, alt-tab, etc)
 	Delta = FMath::Min<double>(Delta, HardLimitSeconds);
 #endif
-	TDoubleLinkedList<TArray<FOnlineAsyncTaskAccelByte*>>::TDoubleLinkedListNode* Node = TaskContainer.GetHead();
-	if (Node == nullptr)
-	{
-		//nothing to do with the task container because it is empty
-		return;
-	}
 
-	//Cleanup empty queue, iteration stops if it finds a non-empty Array
-	while (Node->GetValue().Num() == 0)
-	{
-		auto NextNode = Node->GetNextNode();
-		TaskContainer.RemoveNode(Node);
-		if (NextNode == nullptr)
-		{
-			return;
-		}
-		Node = NextNode;
-	}
+	// Once the top stack starts, serial tasks dispatched by its tasks have to be inserted above it
+	const int32 StackIndex = TopStackIndex;
+	StackPool[StackIndex].bHasStarted = true;
+	LastPendingStackIndex = INDEX_NONE;
 
-	TArray<FOnlineAsyncTaskAccelByte*>& CurrentQueue = Node->GetValue();
-	TArray<FOnlineAsyncTaskAccelByte*> CopyOfQueue = {};
+	// Tasks are compacted in place. The stack is looked up by index on every access, as initializing a task may enqueue
+	// more tasks and grow the pool.
+	int32 KeptTaskCount = 0;
 	bool bIsTimeout = false;
 
-	for (int i = 0; i < CurrentQueue.Num(); i++)
+	for (int32 i = 0; i < StackPool[StackIndex].Tasks.Num(); i++)
 	{
-		FOnlineAsyncTaskAccelByte* CurrentTask = CurrentQueue[i];
+		FOnlineAsyncTaskAccelByte* CurrentTask = StackPool[StackIndex].Tasks[i];
 		if (CurrentTask == nullptr)
 		{
 			continue;
@@ -102,7 +90,7 @@ void FOnlineAsyncEpicTaskAccelByte::Tick()
 				continue;
 			}
 		}
-		CopyOfQueue.Add(CurrentTask);
+		StackPool[StackIndex].Tasks[KeptTaskCount++] = CurrentTask;
 		if (CurrentTask->HasTaskTimedOut())
 		{
 			bIsTimeout = true;
@@ -110,13 +98,17 @@ void FOnlineAsyncEpicTaskAccelByte::Tick()
 		}
 	}
 
-	if (CopyOfQueue.Num() == 0)
+	if (KeptTaskCount == 0)
 	{
-		TaskContainer.RemoveNode(Node);
+		ReleaseStack(StackIndex);
 	}
 	else
 	{
-		Node->GetValue() = CopyOfQueue;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+		StackPool[StackIndex].Tasks.SetNum(KeptTaskCount, EAllowShrinking::No);
+#else
+		StackPool[StackIndex].Tasks.SetNum(KeptTaskCount, false);
+#endif
 	}
 
 	LastTaskUpdateInSeconds = CurrentTime;
@@ -135,15 +127,10 @@ void FOnlineAsyncEpicTaskAccelByte::Timeout()
 		return;
 	}
 
-	TDoubleLinkedList<TArray<FOnlineAsyncTaskAccelByte*>>::TDoubleLinkedListNode* Node = TaskContainer.GetHead();
-
-	while (Node != nullptr)
+	for (int32 StackIndex = TopStackIndex; StackIndex != INDEX_NONE; StackIndex = StackPool[StackIndex].NextIndex)
 	{
-		TArray<FOnlineAsyncTaskAccelByte*>& CurrentQueue = Node->GetValue();
-
-		for (int i = 0; i < CurrentQueue.Num(); i++)
+		for (FOnlineAsyncTaskAccelByte* CurrentTask : StackPool[StackIndex].Tasks)
 		{
-			FOnlineAsyncTaskAccelByte* CurrentTask = CurrentQueue[i];
 			if (CurrentTask == nullptr)
 			{
 				continue;
@@ -151,75 +138,141 @@ void FOnlineAsyncEpicTaskAccelByte::Timeout()
 			CurrentTask->ForcefullySetTimeoutState();
 			Subsystem->AddTaskToOutQueue(CurrentTask);
 		}
-
-		Node = Node->GetNextNode();
 	}
 
 	this->CompleteTask(EAccelByteAsyncTaskCompleteState::TimedOut);
 	this->OnTaskTimedOut();
 }
 
-bool FOnlineAsyncEpicTaskAccelByte::bIsTopStackRunning()
+TArray<TArray<FOnlineAsyncTaskAccelByte*>> FOnlineAsyncEpicTaskAccelByte::GetTaskContainer() const
 {
-	if (TaskContainer.Num() == 0 || TaskContainer.GetHead() == nullptr)
+	TArray<TArray<FOnlineAsyncTaskAccelByte*>> Output;
+	Output.Reserve(StackCount);
+	for (int32 StackIndex = TopStackIndex; StackIndex != INDEX_NONE; StackIndex = StackPool[StackIndex].NextIndex)
 	{
-		return false;
+		Output.Emplace(StackPool[StackIndex].Tasks);
 	}
-	
-	if (TaskContainer.GetHead() || TaskContainer.GetHead()->GetValue().Num() == 0)
-	{
-		return false;
-	}
-
-	auto AsyncTaskAB = TaskContainer.GetHead()->GetValue();
-	if (AsyncTaskAB.Num() == 0)
-	{
-		return false;
-	}
-
-	auto TopStackState = (AsyncTaskAB[0])->GetCurrentState();
-	return TopStackState != EAccelByteAsyncTaskState::Uninitialized;
+	return Output;
 }
 
 void FOnlineAsyncEpicTaskAccelByte::Enqueue(ETypeOfOnlineAsyncTask TaskType, FOnlineAsyncTaskAccelByte* ChildTask)
 {
-	auto Stack = TArray<FOnlineAsyncTaskAccelByte*>();
-	Stack.Add(ChildTask);
-
-	if (bIsTopStackRunning() || TaskContainer.Num() == 0)
+	if (StackCount == 0)
 	{
-		TaskContainer.AddHead(Stack);
+		const int32 StackIndex = AcquireStack(ChildTask);
+		LinkStack(StackIndex, INDEX_NONE);
+		LastPendingStackIndex = StackIndex;
 		return;
 	}
 
 	switch (TaskType)
 	{
 	case ETypeOfOnlineAsyncTask::Parallel:
-		TaskContainer.GetHead()->GetValue().Add(ChildTask);
+		StackPool[TopStackIndex].Tasks.Add(ChildTask);
 		break;
 	case ETypeOfOnlineAsyncTask::Serial:
 	{
-		auto NodePtr = TaskContainer.GetHead();
-		while (NodePtr != nullptr)
-		{
-			if (NodePtr->GetValue().Num() == 0)
-			{
-				NodePtr->GetNextNode();
-				continue;
-			}
-
-			// If running, insert above the running task
-			if (NodePtr->GetValue()[0]->GetCurrentState() != EAccelByteAsyncTaskState::Uninitialized)
-			{
-				TaskContainer.InsertNode(Stack, NodePtr);
-				return;
-			}
-			NodePtr = NodePtr->GetNextNode();
-		}
-		TaskContainer.AddTail(Stack);
+		// Insert above the first started stack, after any stack that is still waiting to start
+		const int32 StackIndex = AcquireStack(ChildTask);
+		LinkStack(StackIndex, LastPendingStackIndex);
+		LastPendingStackIndex = StackIndex;
 	}
 		break;
 	default:
 		break;
 	}
 }
+
+int32 FOnlineAsyncEpicTaskAccelByte::AcquireStack(FOnlineAsyncTaskAccelByte* Task)
+{
+	int32 StackIndex = INDEX_NONE;
+	if (FreeStackIndices.Num() > 0)
+	{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+		StackIndex = FreeStackIndices.Pop(EAllowShrinking::No);
+#else
+		StackIndex = FreeStackIndices.Pop(false);
+#endif
+	}
+	else
+	{
+		StackIndex = StackPool.AddDefaulted();
+	}
+
+	FTaskStack& Stack = StackPool[StackIndex];
+	Stack.Tasks.Add(Task);
+	Stack.PrevIndex = INDEX_NONE;
+	Stack.NextIndex = INDEX_NONE;
+	Stack.bHasStarted = false;
+	return StackIndex;
+}
+
+void FOnlineAsyncEpicTaskAccelByte::LinkStack(int32 StackIndex, int32 InsertAfterIndex)
+{
+	FTaskStack& Stack = StackPool[StackIndex];
+	Stack.PrevIndex = InsertAfterIndex;
+	Stack.NextIndex = (InsertAfterIndex == INDEX_NONE) ? TopStackIndex : StackPool[InsertAfterIndex].NextIndex;
+
+	if (Stack.PrevIndex == INDEX_NONE)
+	{
+		TopStackIndex = StackIndex;
+	}
+	else
+	{
+		StackPool[Stack.PrevIndex].NextIndex = StackIndex;
+	}
+
+	if (Stack.NextIndex == INDEX_NONE)
+	{
+		BottomStackIndex = StackIndex;
+	}
+	else
+	{
+		StackPool[Stack.NextIndex].PrevIndex = StackIndex;
+	}
+
+	StackCount++;
+}
+
+void FOnlineAsyncEpicTaskAccelByte::ReleaseStack(int32 StackIndex)
+{
+	FTaskStack& Stack = StackPool[StackIndex];
+
+	if (Stack.PrevIndex == INDEX_NONE)
+	{
+		TopStackIndex = Stack.NextIndex;
+	}
+	else
+	{
+		StackPool[Stack.PrevIndex].NextIndex = Stack.NextIndex;
+	}
+
+	if (Stack.NextIndex == INDEX_NONE)
+	{
+		BottomStackIndex = Stack.PrevIndex;
+	}
+	else
+	{
+		StackPool[Stack.NextIndex].PrevIndex = Stack.PrevIndex;
+	}
+
+	if (LastPendingStackIndex == StackIndex)
+	{
+		LastPendingStackIndex = Stack.PrevIndex;
+	}
+
+	// Keep the allocation around for the next stack
+	Stack.Tasks.Reset();
+	Stack.PrevIndex = INDEX_NONE;
+	Stack.NextIndex = INDEX_NONE;
+	FreeStackIndices.Push(StackIndex);
+	StackCount--;
+
+	// Stacks that were enqueued below every other stack before anything started never ran yet. If they now directly
+	// follow the pending run at the top, they become part of it, and as they are at the bottom, so is the run's end.
+	const int32 FirstIndexAfterRun = (LastPendingStackIndex == INDEX_NONE) ? TopStackIndex : StackPool[LastPendingStackIndex].NextIndex;
+	if (FirstIndexAfterRun != INDEX_NONE && !StackPool[FirstIndexAfterRun].bHasStarted)
+	{
+		LastPendingStackIndex = BottomStackIndex;
+	}
+}
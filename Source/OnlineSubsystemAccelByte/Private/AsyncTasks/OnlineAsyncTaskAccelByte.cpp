@@ -5,6 +5,7 @@
 #include "AsyncTasks/OnlineAsyncTaskAccelByte.h"
 #include "AsyncTasks/OnlineAsyncEpicTaskAccelByte.h"
 #include "Core/AccelByteMultiRegistry.h"
+#include "Utilities/AccelByteAsyncTaskMetrics.h"
 
 void FOnlineAsyncTaskAccelByte::ExecuteCriticalSectionAction(FVoidHandler Action)
 {
@@ -70,4 +71,38 @@ void FOnlineAsyncTaskAccelByte::InitApiClientForLogin(int LoginUserNum)
 	{
 		SetApiClient(AccelByte::FMultiRegistry::GetApiClient());
 	}
-}
\ No newline at end of file
+}
+
+void FOnlineAsyncTaskAccelByte::RecordCompletionMetrics()
+{
+	if (Subsystem == nullptr)
+	{
+		return;
+	}
+
+	const FAccelByteAsyncTaskMetricsPtr Metrics = Subsystem->GetAsyncTaskMetrics();
+	if (!Metrics.IsValid() || !Metrics->IsEnabled())
+	{
+		return;
+	}
+
+	// Tasks that never got initialized (e.g. coalesced tasks) spent their whole lifetime waiting
+	const double CompleteTimeInSeconds = FPlatformTime::Seconds();
+	const double StartTime = (StartTimeInSeconds > 0.0) ? StartTimeInSeconds : CompleteTimeInSeconds;
+	Metrics->RecordTask(GetMetricsName(), StartTime - DispatchTimeInSeconds, CompleteTimeInSeconds - StartTime, CompleteState);
+}
+
+void FOnlineAsyncTaskAccelByte::ReportCompletionToTaskManager()
+{
+	if (Subsystem == nullptr)
+	{
+		return;
+	}
+
+	const FOnlineAsyncTaskManagerAccelBytePtr AsyncTaskManager = Subsystem->GetAsyncTaskManager();
+	if (AsyncTaskManager.IsValid())
+	{
+		AsyncTaskManager->ReleaseParallelTaskSlot(this);
+		AsyncTaskManager->CompleteCoalescedTasks(this);
+	}
+}
@@ -48,6 +48,11 @@ public:
 	virtual void TriggerDelegates() override;
 	virtual void OnTaskTimedOut() override;
 
+	virtual EAccelByteAsyncTaskPriority GetTaskPriority() const override
+	{
+		return EAccelByteAsyncTaskPriority::Critical;
+	}
+
 protected:
 
 	virtual const FString GetTaskName() const override
@@ -26,6 +26,11 @@ public:
 	virtual void Finalize() override;
 	virtual void TriggerDelegates() override;
 
+	virtual EAccelByteAsyncTaskPriority GetTaskPriority() const override
+	{
+		return EAccelByteAsyncTaskPriority::Critical;
+	}
+
 protected:
 
 	virtual const FString GetTaskName() const override
@@ -9,6 +9,7 @@
 #include "GameServerApi/AccelByteServerSessionApi.h"
 #include "Api/AccelByteSessionApi.h"
 #include "OnlineAsyncTaskAccelByteRefreshV2GameSession.h"
+#include "Utilities/AccelByteJsonDiff.h"
 
 using namespace AccelByte;
 
@@ -58,7 +59,22 @@ void FOnlineAsyncTaskAccelByteUpdateGameSessionV2::Initialize()
 	UpdateRequest.Version = GameSessionBackendData->Version;
 
 	// Currently we just want to update our attributes based on the new settings object passed in
-	UpdateRequest.Attributes.JsonObject = SessionInterface->ConvertSessionSettingsToJsonObject(NewSessionSettings);
+	const TSharedRef<FJsonObject> NewAttributes = SessionInterface->ConvertSessionSettingsToJsonObject(NewSessionSettings);
+	UpdateRequest.Attributes.JsonObject = NewAttributes;
+
+	// If the backend merges attributes, only send the ones that changed since it last acknowledged them. Removing an
+	// attribute can not be expressed as a merge, so those updates still send every attribute.
+	if (SessionInterface->IsSessionAttributeMergePatchEnabled())
+	{
+		const TSharedRef<FJsonObject> ChangedAttributes = MakeShared<FJsonObject>();
+		TArray<FString> RemovedAttributeNames;
+		FAccelByteJsonDiff::DiffTopLevelFields(GameSessionBackendData->Attributes.JsonObject, NewAttributes, ChangedAttributes, RemovedAttributeNames);
+		if (RemovedAttributeNames.Num() <= 0)
+		{
+			UE_LOG_AB(VeryVerbose, TEXT("Sending %d of %d attributes for update of game session named %s."), ChangedAttributes->Values.Num(), NewAttributes->Values.Num(), *SessionName.ToString());
+			UpdateRequest.Attributes.JsonObject = ChangedAttributes;
+		}
+	}
 	
 	// Check if joinability has changed and if so send it along to the backend
 	FString JoinTypeString;
@@ -134,6 +134,24 @@ void FOnlineAsyncTaskAccelByteQueryStatsUsers::Initialize()
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 } 
 
+FString FOnlineAsyncTaskAccelByteQueryStatsUsers::GetCoalescingKey() const
+{
+	TArray<FString> SortedStatNames = StatNames;
+	SortedStatNames.Sort();
+
+	const FString RequesterId = UserId.IsValid() ? UserId->GetAccelByteId() : FString::FromInt(LocalUserNum);
+	return FString::Printf(TEXT("%s;%s;%s;%s"), *GetTaskName(), *RequesterId, *GetCoalescingKeyForUserIds(StatsUsers), *FString::Join(SortedStatNames, TEXT(",")));
+}
+
+void FOnlineAsyncTaskAccelByteQueryStatsUsers::CopyCoalescedResult(const FOnlineAsyncTaskAccelByte& InFlightTask)
+{
+	const FOnlineAsyncTaskAccelByteQueryStatsUsers& InFlightQuery = static_cast<const FOnlineAsyncTaskAccelByteQueryStatsUsers&>(InFlightTask);
+	OnlineUsersStatsPairs = InFlightQuery.OnlineUsersStatsPairs;
+	QueryUserStatItemResponse = InFlightQuery.QueryUserStatItemResponse;
+	ErrorCode = InFlightQuery.ErrorCode;
+	ErrorMessage = InFlightQuery.ErrorMessage;
+}
+
 void FOnlineAsyncTaskAccelByteQueryStatsUsers::Finalize()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT(""));
@@ -149,7 +167,8 @@ void FOnlineAsyncTaskAccelByteQueryStatsUsers::Finalize()
 	}
 
 	const FOnlinePredefinedEventAccelBytePtr PredefinedEventInterface = Subsystem->GetPredefinedEventInterface();
-	if (bWasSuccessful && PredefinedEventInterface.IsValid())
+	// The in flight task that this task was coalesced into already sent the event for this query
+	if (bWasSuccessful && !IsCoalesced() && PredefinedEventInterface.IsValid())
 	{
 		TSharedPtr<FAccelByteModelsUserStatItemGetItemsByCodesPayload> UserStatItemGetItemsByCodesPayload = MakeShared<FAccelByteModelsUserStatItemGetItemsByCodesPayload>();
 		for (const auto& StatItem : QueryUserStatItemResponse.Data)
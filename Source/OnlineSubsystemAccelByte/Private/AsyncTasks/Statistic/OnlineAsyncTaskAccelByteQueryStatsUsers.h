@@ -30,6 +30,13 @@ public:
 	virtual void TriggerDelegates() override;
 	virtual void Tick() override;
 
+	virtual EAccelByteAsyncTaskPriority GetTaskPriority() const override
+	{
+		return EAccelByteAsyncTaskPriority::Background;
+	}
+
+	virtual FString GetCoalescingKey() const override;
+
 protected:
 
 	virtual const FString GetTaskName() const override
@@ -37,6 +44,8 @@ protected:
 		return TEXT("FOnlineAsyncTaskAccelByteQueryStatsUsers");
 	}
 
+	virtual void CopyCoalescedResult(const FOnlineAsyncTaskAccelByte& InFlightTask) override;
+
 private:
 	void OnGetUserStatItemsSuccess(FAccelByteModelsUserStatItemPagingSlicedResult const& Result);
 
@@ -74,6 +74,18 @@ void FOnlineAsyncTaskAccelByteQueryUserInfo::Initialize()
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
+FString FOnlineAsyncTaskAccelByteQueryUserInfo::GetCoalescingKey() const
+{
+	return FString::Printf(TEXT("%s;%d;%s"), *GetTaskName(), LocalUserNum, *GetCoalescingKeyForUserIds(InitialUserIds));
+}
+
+void FOnlineAsyncTaskAccelByteQueryUserInfo::CopyCoalescedResult(const FOnlineAsyncTaskAccelByte& InFlightTask)
+{
+	const FOnlineAsyncTaskAccelByteQueryUserInfo& InFlightQuery = static_cast<const FOnlineAsyncTaskAccelByteQueryUserInfo&>(InFlightTask);
+	UsersQueried = InFlightQuery.UsersQueried;
+	ErrorStr = InFlightQuery.ErrorStr;
+}
+
 void FOnlineAsyncTaskAccelByteQueryUserInfo::Finalize()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT(""));
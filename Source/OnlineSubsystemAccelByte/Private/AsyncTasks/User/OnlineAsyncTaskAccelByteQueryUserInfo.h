@@ -24,6 +24,13 @@ public:
 	virtual void Finalize() override;
 	virtual void TriggerDelegates() override;
 
+	virtual EAccelByteAsyncTaskPriority GetTaskPriority() const override
+	{
+		return EAccelByteAsyncTaskPriority::Background;
+	}
+
+	virtual FString GetCoalescingKey() const override;
+
 protected:
 
 	virtual const FString GetTaskName() const override
@@ -31,6 +38,8 @@ protected:
 		return TEXT("FOnlineAsyncTaskAccelByteQueryUserInfo");
 	}
 
+	virtual void CopyCoalescedResult(const FOnlineAsyncTaskAccelByte& InFlightTask) override;
+
 private:
 
 	/** Array of user IDs that we initially sent to query */
@@ -38,6 +38,19 @@ void FOnlineAsyncTaskAccelByteQueryUserPresence::Initialize()
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
+FString FOnlineAsyncTaskAccelByteQueryUserPresence::GetCoalescingKey() const
+{
+	return FString::Printf(TEXT("%s;%d;%s"), *GetTaskName(), LocalUserNum, *TargetUserId->GetAccelByteId());
+}
+
+void FOnlineAsyncTaskAccelByteQueryUserPresence::CopyCoalescedResult(const FOnlineAsyncTaskAccelByte& InFlightTask)
+{
+	const FOnlineAsyncTaskAccelByteQueryUserPresence& InFlightQuery = static_cast<const FOnlineAsyncTaskAccelByteQueryUserPresence&>(InFlightTask);
+
+	// Presence results are shared with the presence cache and handed out as shared refs, so sharing the instance is fine
+	PresenceResult = InFlightQuery.PresenceResult;
+}
+
 void FOnlineAsyncTaskAccelByteQueryUserPresence::Finalize()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
@@ -23,12 +23,21 @@ public:
 	virtual void Finalize() override;
 	virtual void TriggerDelegates() override;
 
+	virtual EAccelByteAsyncTaskPriority GetTaskPriority() const override
+	{
+		return EAccelByteAsyncTaskPriority::Background;
+	}
+
+	virtual FString GetCoalescingKey() const override;
+
 protected:
 
 	virtual const FString GetTaskName() const override {
 		return TEXT("FOnlineAsyncTaskAccelByteQueryUserPresence");
 	}
 
+	virtual void CopyCoalescedResult(const FOnlineAsyncTaskAccelByte& InFlightTask) override;
+
 private:
 
 	/** UserId of the friend we want to get the presence for */
@@ -125,17 +125,34 @@ void FOnlineAsyncTaskAccelByteQueryUserProfile::Initialize()
 		return;
 	}
 
-	QueryUserProfile(UserIdsToQuery);
+	// Query in chunks, keeping as many chunks in flight as the user cache allows for user queries
+	const FOnlineUserCacheAccelBytePtr UserCache = Subsystem->GetUserCache();
+	UserProfilePipeline.SetMaxChunksInFlight(UserCache.IsValid() ? UserCache->GetMaxParallelUserQueryChunks() : 1);
+	UserProfilePipeline.AddIds(UserIdsToQuery, MaximumQueryLimit);
+	SendPendingUserProfileChunks();
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUserProfile::QueryUserProfile(const TArray<FString>& UserIds)
+void FOnlineAsyncTaskAccelByteQueryUserProfile::SendPendingUserProfileChunks()
+{
+	UserProfilePipeline.SendPendingChunks([this](int32 ChunkIndex, const TArray<FString>& ChunkIds)
+	{
+		QueryUserProfile(ChunkIndex, ChunkIds);
+	});
+}
+
+void FOnlineAsyncTaskAccelByteQueryUserProfile::QueryUserProfile(int32 ChunkIndex, const TArray<FString>& UserIds)
+{
+	auto OnQueryUsersProfileCompleteDelegate = TDelegateUtils<THandler<FAccelByteModelsPublicUserProfileInfoV2>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUserProfile::OnQueryUsersProfileComplete, ChunkIndex);
+	auto OnQueryUserProfileErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUserProfile::OnQueryUserProfileError, ChunkIndex);
+	SendUserProfileRequest(UserIds, OnQueryUsersProfileCompleteDelegate, OnQueryUserProfileErrorDelegate);
+}
+
+void FOnlineAsyncTaskAccelByteQueryUserProfile::SendUserProfileRequest(const TArray<FString>& UserIds, const THandler<FAccelByteModelsPublicUserProfileInfoV2>& OnSuccess, const FErrorHandler& OnError)
 {
-	auto OnQueryUsersProfileCompleteDelegate = TDelegateUtils<THandler<FAccelByteModelsPublicUserProfileInfoV2>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUserProfile::OnQueryUsersProfileComplete);
-	auto OnQueryUserProfileErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUserProfile::OnQueryUserProfileError);
 	API_CLIENT_CHECK_GUARD(ErrorStr);
-	ApiClient->UserProfile.BulkGetPublicUserProfileInfosV2(UserIds, OnQueryUsersProfileCompleteDelegate, OnQueryUserProfileErrorDelegate);
+	ApiClient->UserProfile.BulkGetPublicUserProfileInfosV2(UserIds, OnSuccess, OnError);
 }
 
 void FOnlineAsyncTaskAccelByteQueryUserProfile::Finalize()
@@ -220,25 +237,44 @@ void FOnlineAsyncTaskAccelByteQueryUserProfile::TriggerDelegates()
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUserProfile::OnQueryUsersProfileComplete(const FAccelByteModelsPublicUserProfileInfoV2& InUsersQueried)
+void FOnlineAsyncTaskAccelByteQueryUserProfile::OnQueryUsersProfileComplete(const FAccelByteModelsPublicUserProfileInfoV2& InUsersQueried, int32 ChunkIndex)
 {
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT(""));
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("Chunk: %d"), ChunkIndex);
 
-	UsersQueried.Append(InUsersQueried.UserProfileInfos);
+	SetLastUpdateTimeToCurrentTime();
 
+	// Queue the retry before completing this chunk, so that the pipeline is not seen as finished in between
 	if (InUsersQueried.NotProcessed.Num() > 0)
 	{
-		QueryUserProfile(InUsersQueried.NotProcessed);
+		UserProfilePipeline.AddChunk(InUsersQueried.NotProcessed);
 	}
-	else
+
+	TArray<FAccelByteModelsPublicUserProfileInfo> UserProfileInfos = InUsersQueried.UserProfileInfos;
+	if (!UserProfilePipeline.CompleteChunk(ChunkIndex, MoveTemp(UserProfileInfos)))
 	{
-		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
-		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Successfully have a user profile!"));
+		SendPendingUserProfileChunks();
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Waiting on remaining user profile chunks"));
+		return;
 	}
+
+	// Every chunk is back, merge the profiles in chunk order so the result does not depend on response order
+	for (TArray<FAccelByteModelsPublicUserProfileInfo>& ChunkProfileInfos : UserProfilePipeline.ConsumeResultsInChunkOrder())
+	{
+		UsersQueried.Append(MoveTemp(ChunkProfileInfos));
+	}
+
+	CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Successfully have a user profile!"));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUserProfile::OnQueryUserProfileError(int32 ErrorCode, const FString& ErrorMessage)
+void FOnlineAsyncTaskAccelByteQueryUserProfile::OnQueryUserProfileError(int32 ErrorCode, const FString& ErrorMessage, int32 ChunkIndex)
 {
+	// Only the first failed chunk fails the task, chunks that were in flight alongside it are dropped
+	if (!UserProfilePipeline.Fail())
+	{
+		return;
+	}
+
 	ErrorStr = TEXT("query-user-profile-error-response");
 	UE_LOG_AB(Warning, TEXT("Failed to query users from the backend!"));
 	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
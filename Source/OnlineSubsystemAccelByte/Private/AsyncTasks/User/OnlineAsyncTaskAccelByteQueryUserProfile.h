@@ -10,6 +10,7 @@
 #include "OnlineUserInterfaceAccelByte.h"
 #include "Models/AccelByteUserModels.h"
 #include "OnlineUserCacheAccelByte.h"
+#include "Utilities/AccelByteChunkedRequestPipeline.h"
 
 class FOnlineAsyncTaskAccelByteQueryUserProfile
 	: public FOnlineAsyncTaskAccelByte
@@ -40,6 +41,12 @@ protected:
 		return TEXT("FOnlineAsyncTaskAccelByteQueryUserProfile");
 	}
 
+	/**
+	 * Send the profile request for a single chunk of user IDs to the backend. Kept apart from the chunk bookkeeping so
+	 * that tests can answer chunks from a stand-in backend.
+	 */
+	virtual void SendUserProfileRequest(const TArray<FString>& UserIds, const THandler<FAccelByteModelsPublicUserProfileInfoV2>& OnSuccess, const AccelByte::FErrorHandler& OnError);
+
 private:
 
 	/** Array of user IDs that we initially sent to query */
@@ -51,6 +58,9 @@ private:
 	/** Array of users that we have retrieved from the query */
 	TArray<FAccelByteModelsPublicUserProfileInfo> UsersQueried;
 
+	/** Chunks of user IDs to query profiles for, along with the profiles returned for each chunk */
+	TAccelByteChunkedRequestPipeline<TArray<FAccelByteModelsPublicUserProfileInfo>> UserProfilePipeline;
+
 	/** Array of user IDs that we successfully queried (should be the same as initial, but may also differ if a user isn't found) */
 	TArray<TSharedRef<const FUniqueNetId>> QueriedUserIds;
 	
@@ -60,18 +70,22 @@ private:
 	/** Delegate to fire on completion */
 	FOnQueryUserProfileComplete Delegate;
 
-	/** Initial query user profile endpoint */
-	void QueryUserProfile(const TArray<FString>& UserIds);
+	/** Send as many queued chunks of user IDs as the in flight limit allows */
+	void SendPendingUserProfileChunks();
+
+	/** Query user profile endpoint for a single chunk of user IDs */
+	void QueryUserProfile(int32 ChunkIndex, const TArray<FString>& UserIds);
 	
-	/** Delegate handler for when we complete a query for users from the backend */
-	void OnQueryUsersProfileComplete(const FAccelByteModelsPublicUserProfileInfoV2& InUsersQueried);
+	/** Delegate handler for when we complete a query for a chunk of users from the backend */
+	void OnQueryUsersProfileComplete(const FAccelByteModelsPublicUserProfileInfoV2& InUsersQueried, int32 ChunkIndex);
 
 	/**
 	 * Delegate handler for when getting the user's profile from the game namespace from the AccelByte SDK fails.
 	 *
 	 * @param ErrorCode Code returned from the backend that represents the error encountered for the request
 	 * @param ErrorMessage Message from the backend that describes the error encountered
+	 * @param ChunkIndex Index of the chunk of user IDs that failed
 	 */
-	void OnQueryUserProfileError(int32 ErrorCode, const FString& ErrorMessage);
+	void OnQueryUserProfileError(int32 ErrorCode, const FString& ErrorMessage, int32 ChunkIndex);
 
 };
\ No newline at end of file
@@ -76,13 +76,19 @@ FOnlineAsyncTaskAccelByteQueryUsersByIds::FOnlineAsyncTaskAccelByteQueryUsersByI
 	UserId = FUniqueNetIdAccelByteUser::CastChecked(InUserId);
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::BulkGetUserByOtherPlatformUserIds(const TArray<FString>& InUserIds)
+int32 FOnlineAsyncTaskAccelByteQueryUsersByIds::GetMaxChunksInFlight() const
+{
+	const FOnlineUserCacheAccelBytePtr UserCache = Subsystem->GetUserCache();
+	return UserCache.IsValid() ? UserCache->GetMaxParallelUserQueryChunks() : 1;
+}
+
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::BulkGetUserByOtherPlatformUserIds(int32 ChunkIndex, const TArray<FString>& InUserIds)
 {
 	EAccelBytePlatformType ABPlatformType;
 	if (Subsystem->GetAccelBytePlatformTypeFromAuthType(PlatformType, ABPlatformType))
 	{
-		const THandler<FBulkPlatformUserIdResponse> OnBulkGetUserSuccess = TDelegateUtils<THandler<FBulkPlatformUserIdResponse>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsSuccess);
-		const FErrorHandler OnBulkGetUserError = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsError);
+		const THandler<FBulkPlatformUserIdResponse> OnBulkGetUserSuccess = TDelegateUtils<THandler<FBulkPlatformUserIdResponse>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsSuccess, ChunkIndex);
+		const FErrorHandler OnBulkGetUserError = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsError, ChunkIndex);
 		API_CLIENT_CHECK_GUARD();
 		ApiClient->User.BulkGetUserByOtherPlatformUserIdsV4(ABPlatformType, InUserIds, OnBulkGetUserSuccess, OnBulkGetUserError);
 	}
@@ -101,7 +107,9 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::Initialize()
 		return;
 	}
 
-	FAccelByteUtilities::SplitArraysToNum(UserIds, MaximumQueryLimit, SplitUserIds);
+	const int32 MaxChunksInFlight = GetMaxChunksInFlight();
+	PlatformIdMappingPipeline.SetMaxChunksInFlight(MaxChunksInFlight);
+	BasicUserInfoPipeline.SetMaxChunksInFlight(MaxChunksInFlight);
 
 	// If these are already AccelByte IDs, then we just want to run a bulk query for the users
 	if (PlatformType == ACCELBYTE_QUERY_TYPE)
@@ -110,7 +118,20 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::Initialize()
 	}
 	else
 	{
-		BulkGetUserByOtherPlatformUserIds(SplitUserIds[LastSplitQueryIndex.GetValue()]);
+		// Platform IDs that recently could not be mapped to a user would not map now either
+		const FOnlineUserCacheAccelBytePtr UserCache = Subsystem->GetUserCache();
+		if (UserCache.IsValid() && UserCache->RemoveNegativeCachedPlatformIds(PlatformType, UserIds) > 0 && UserIds.Num() <= 0)
+		{
+			AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Every platform ID is known to have no AccelByte user"));
+			CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+			return;
+		}
+
+		PlatformIdMappingPipeline.AddIds(UserIds, MaximumQueryLimit);
+		PlatformIdMappingPipeline.SendPendingChunks([this](int32 ChunkIndex, const TArray<FString>& ChunkIds)
+		{
+			BulkGetUserByOtherPlatformUserIds(ChunkIndex, ChunkIds);
+		});
 	}
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
@@ -166,28 +187,47 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::TriggerDelegates()
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsSuccess(const FBulkPlatformUserIdResponse& Result)
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsSuccess(const FBulkPlatformUserIdResponse& Result, int32 ChunkIndex)
 {
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("Mappings found: %d"), Result.UserIdPlatforms.Num());
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("Chunk: %d; Mappings found: %d"), ChunkIndex, Result.UserIdPlatforms.Num());
 
-	QueriedUserMapByPlatformUserIds.Append(Result.UserIdPlatforms);
-	LastSplitQueryIndex.Increment();
 	SetLastUpdateTimeToCurrentTime();
-	
-	if(LastSplitQueryIndex.GetValue() < SplitUserIds.Num())
+
+	TArray<FPlatformUserIdMap> Mappings = Result.UserIdPlatforms;
+	if (!PlatformIdMappingPipeline.CompleteChunk(ChunkIndex, MoveTemp(Mappings)))
 	{
-		BulkGetUserByOtherPlatformUserIds(SplitUserIds[LastSplitQueryIndex.GetValue()]);
-		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Querying next platform user Ids"));
+		PlatformIdMappingPipeline.SendPendingChunks([this](int32 NextChunkIndex, const TArray<FString>& ChunkIds)
+		{
+			BulkGetUserByOtherPlatformUserIds(NextChunkIndex, ChunkIds);
+		});
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Waiting on remaining platform user Id chunks"));
 		return;
 	}
 
-	if (QueriedUserMapByPlatformUserIds.Num() > 0)
+	// Every chunk is back, merge the mappings in chunk order so the result does not depend on response order
+	TArray<FString> AccelByteIds;
+	TSet<FString> MappedPlatformIds;
+	for (const TArray<FPlatformUserIdMap>& ChunkMappings : PlatformIdMappingPipeline.ConsumeResultsInChunkOrder())
 	{
-		TArray<FString> AccelByteIds;
-		for (const FPlatformUserIdMap& UserIdMapping : QueriedUserMapByPlatformUserIds)
+		for (const FPlatformUserIdMap& UserIdMapping : ChunkMappings)
 		{
 			AccelByteIds.Add(UserIdMapping.UserId);
+			MappedPlatformIds.Add(UserIdMapping.PlatformUserId);
 		}
+	}
+
+	const FOnlineUserCacheAccelBytePtr UserCache = Subsystem->GetUserCache();
+	if (UserCache.IsValid())
+	{
+		TArray<FString> UnmappedPlatformIds = UserIds.FilterByPredicate([&MappedPlatformIds](const FString& PlatformId)
+		{
+			return !MappedPlatformIds.Contains(PlatformId);
+		});
+		UserCache->AddPlatformIdsToNegativeCache(PlatformType, UnmappedPlatformIds);
+	}
+
+	if (AccelByteIds.Num() > 0)
+	{
 
 		GetBasicUserInfo(AccelByteIds);
 	}
@@ -199,9 +239,15 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsSucc
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsError(int32 ErrorCode, const FString& ErrorMessage)
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsError(int32 ErrorCode, const FString& ErrorMessage, int32 ChunkIndex)
 {
-	UE_LOG_AB(Warning, TEXT("Could not query for AccelByte IDs from %s platform IDs in bulk! Error code: %d; Error message: %s"), *PlatformType, ErrorCode, *ErrorMessage);
+	// Only the first failed chunk fails the task, chunks that were in flight alongside it are dropped
+	if (!PlatformIdMappingPipeline.Fail())
+	{
+		return;
+	}
+
+	UE_LOG_AB(Warning, TEXT("Could not query for AccelByte IDs from %s platform IDs in bulk! Chunk: %d; Error code: %d; Error message: %s"), *PlatformType, ChunkIndex, ErrorCode, *ErrorMessage);
 	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
 }
 
@@ -228,45 +274,93 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::GetBasicUserInfo(const TArray<FSt
 	TArray<FString> UserIdsToQueryArray;
 	UserCache->GetQueryAndCacheArrays(AccelByteIds, UserIdsToQueryArray, UsersCached);
 
-	// Add userId that is not in the cache to the queue
-	for (const auto& AccelbyteUserId : UserIdsToQueryArray)
-	{
-		UsersToQuery.Enqueue(AccelbyteUserId);
-	}
-
 	// This means these users are already in the cache, so we can just skip the query and successfully complete
-	if (UsersToQuery.IsEmpty())
+	if (UserIdsToQueryArray.Num() <= 0)
 	{
 		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
 		return;
 	}
 
-	GetUserOtherPlatformBasicPublicInfo();
+	AccelByteIdsToQuery = UserIdsToQueryArray;
+	BasicUserInfoPipeline.AddIds(UserIdsToQueryArray, MaximumQueryLimit);
+	BasicUserInfoPipeline.SendPendingChunks([this](int32 ChunkIndex, const TArray<FString>& ChunkIds)
+	{
+		GetUserOtherPlatformBasicPublicInfo(ChunkIndex, ChunkIds);
+	});
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::GetUserOtherPlatformBasicPublicInfo()
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::GetUserOtherPlatformBasicPublicInfo(int32 ChunkIndex, const TArray<FString>& AccelByteIds)
 {
 	FPlatformAccountInfoRequest Request;
+	Request.UserIds = AccelByteIds;
+
+	const THandler<FAccountUserPlatformInfosResponse> OnGetUserPlatformInfoSuccessDelegate = TDelegateUtils<THandler<FAccountUserPlatformInfosResponse>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublicInfoSuccess, ChunkIndex);
+	const FErrorHandler OnGetUserPlatformInfoErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublicInfoError, ChunkIndex);
+	SendBasicUserInfoRequest(Request, OnGetUserPlatformInfoSuccessDelegate, OnGetUserPlatformInfoErrorDelegate);
+}
+
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::SendBasicUserInfoRequest(const FPlatformAccountInfoRequest& Request, const THandler<FAccountUserPlatformInfosResponse>& OnSuccess, const FErrorHandler& OnError)
+{
+	API_CLIENT_CHECK_GUARD();
+	ApiClient->User.GetUserOtherPlatformBasicPublicInfo(Request, OnSuccess, OnError);
+}
 
-	// Add user id to query until queue empty or limit reached
-	while (!UsersToQuery.IsEmpty() && Request.UserIds.Num() < MaximumQueryLimit)
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublicInfoSuccess(const FAccountUserPlatformInfosResponse& Result, int32 ChunkIndex)
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("Chunk: %d; User information received: %d"), ChunkIndex, Result.Data.Num());
+
+	SetLastUpdateTimeToCurrentTime();
+
+	TArray<FAccountUserPlatformData> BasicInfos = Result.Data;
+	if (!BasicUserInfoPipeline.CompleteChunk(ChunkIndex, MoveTemp(BasicInfos)))
 	{
-		FString AccelbyteUserId;
-		UsersToQuery.Dequeue(AccelbyteUserId);
-		Request.UserIds.Emplace(AccelbyteUserId);
+		BasicUserInfoPipeline.SendPendingChunks([this](int32 NextChunkIndex, const TArray<FString>& ChunkIds)
+		{
+			GetUserOtherPlatformBasicPublicInfo(NextChunkIndex, ChunkIds);
+		});
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Waiting on remaining user information chunks"));
+		return;
 	}
 
-	const THandler<FAccountUserPlatformInfosResponse> OnGetUserPlatformInfoSuccessDelegate = TDelegateUtils<THandler<FAccountUserPlatformInfosResponse>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublicInfoSuccess);
-	const FErrorHandler OnGetUserPlatformInfoErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublicInfoError);
-	API_CLIENT_CHECK_GUARD();
-	ApiClient->User.GetUserOtherPlatformBasicPublicInfo(Request, OnGetUserPlatformInfoSuccessDelegate, OnGetUserPlatformInfoErrorDelegate);
+	// Every chunk is back, build the users in chunk order so the result does not depend on response order
+	TArray<FAccountUserPlatformData> AllBasicInfos;
+	for (TArray<FAccountUserPlatformData>& ChunkBasicInfos : BasicUserInfoPipeline.ConsumeResultsInChunkOrder())
+	{
+		AllBasicInfos.Append(MoveTemp(ChunkBasicInfos));
+	}
+	ProcessBasicUserInfo(AllBasicInfos);
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublicInfoSuccess(const FAccountUserPlatformInfosResponse& Result)
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::ProcessBasicUserInfo(const TArray<FAccountUserPlatformData>& BasicInfos)
 {
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("User information received: %d"), Result.Data.Num());
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("User information to process: %d"), BasicInfos.Num());
+
+	// Remember the IDs that the backend returned nothing for, such as deleted users, so they are not queried again soon
+	if (BasicInfos.Num() < AccelByteIdsToQuery.Num())
+	{
+		TSet<FString> ReturnedIds;
+		ReturnedIds.Reserve(BasicInfos.Num());
+		for (const FAccountUserPlatformData& BasicInfo : BasicInfos)
+		{
+			ReturnedIds.Add(BasicInfo.UserId);
+		}
+
+		const TArray<FString> MissingIds = AccelByteIdsToQuery.FilterByPredicate([&ReturnedIds](const FString& AccelByteId)
+		{
+			return !ReturnedIds.Contains(AccelByteId);
+		});
+
+		const FOnlineUserCacheAccelBytePtr UserCache = Subsystem->GetUserCache();
+		if (UserCache.IsValid() && MissingIds.Num() > 0)
+		{
+			UE_LOG_AB(Verbose, TEXT("Backend returned no user for %d of %d queried AccelByte IDs, adding them to the negative cache."), MissingIds.Num(), AccelByteIdsToQuery.Num());
+			UserCache->AddAccelByteIdsToNegativeCache(MissingIds);
+		}
+	}
 
 	const FOnlineIdentityAccelBytePtr IdentityInterface = StaticCastSharedPtr<FOnlineIdentityAccelByte>(Subsystem->GetIdentityInterface());
 	if (!IdentityInterface.IsValid())
@@ -300,7 +394,7 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublic
 		return;
 	}
 
-	for (const FAccountUserPlatformData& BasicInfo : Result.Data)
+	for (const FAccountUserPlatformData& BasicInfo : BasicInfos)
 	{
 		// Construct a composite ID for this user
 		FAccelByteUniqueIdComposite CompositeId;
@@ -351,31 +445,30 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublic
 		}
 	}
 
-	if (UsersToQuery.IsEmpty())
-	{
-		bHasQueriedBasicUserInfo = true;
+	bHasQueriedBasicUserInfo = true;
 
-		if (PlatformIdsToQuery.Num() > 0)
-		{
-			QueryUsersOnNativePlatform(PlatformIdsToQuery);
-		}
-		else
-		{
-			// Just set this flag to true so that we aren't waiting on it
-			bHasQueriedUserPlatformInfo = true;
-		}
+	if (PlatformIdsToQuery.Num() > 0)
+	{
+		QueryUsersOnNativePlatform(PlatformIdsToQuery);
 	}
 	else
 	{
-		GetUserOtherPlatformBasicPublicInfo();
+		// Just set this flag to true so that we aren't waiting on it
+		bHasQueriedUserPlatformInfo = true;
 	}
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublicInfoError(int32 ErrorCode, const FString& ErrorMessage)
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetUserOtherPlatformBasicPublicInfoError(int32 ErrorCode, const FString& ErrorMessage, int32 ChunkIndex)
 {
-	UE_LOG_AB(Warning, TEXT("Failed to get basic user information from backend! Error code: %d; Error message: %s"), ErrorCode, *ErrorMessage);
+	// Only the first failed chunk fails the task, chunks that were in flight alongside it are dropped
+	if (!BasicUserInfoPipeline.Fail())
+	{
+		return;
+	}
+
+	UE_LOG_AB(Warning, TEXT("Failed to get basic user information from backend! Chunk: %d; Error code: %d; Error message: %s"), ChunkIndex, ErrorCode, *ErrorMessage);
 	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
 }
 
@@ -8,9 +8,16 @@
 #include "OnlineSubsystemAccelByteTypes.h"
 #include "OnlineUserCacheAccelByte.h"
 #include "Models/AccelByteUserModels.h"
+#include "Utilities/AccelByteChunkedRequestPipeline.h"
 
 /**
  * Task to query a bulk of users by AccelByte or platform IDs, will add these users to the user cache.
+ *
+ * IDs are sent in chunks of MaximumQueryLimit, with up to the user cache's MaxParallelUserQueryChunks chunk requests in
+ * flight at once. Results are merged in chunk order once every chunk is back, and the first failed chunk fails the task.
+ *
+ * IDs in the user cache's negative cache are not sent at all, and IDs that the backend returns nothing for are added to
+ * it, so the task completes successfully without users for them either way.
  */
 class FOnlineAsyncTaskAccelByteQueryUsersByIds
 	: public FOnlineAsyncTaskAccelByte
@@ -49,6 +56,12 @@ protected:
 		return TEXT("FOnlineAsyncTaskAccelByteQueryUsersByIds");
 	}
 
+	/**
+	 * Send the basic user information request for a single chunk of AccelByte IDs to the backend. Kept apart from the
+	 * chunk bookkeeping so that tests can answer chunks from a stand-in backend.
+	 */
+	virtual void SendBasicUserInfoRequest(const FPlatformAccountInfoRequest& Request, const THandler<FAccountUserPlatformInfosResponse>& OnSuccess, const AccelByte::FErrorHandler& OnError);
+
 private:
 
 	/**
@@ -63,19 +76,19 @@ private:
 	TArray<FString> UserIds;
 
 	/**
-	 * Array of IDs that's split to Max element count.
+	 * AccelByte IDs that were not cached and are queried for basic user information
 	 */
-	TArray<TArray<FString>> SplitUserIds;
+	TArray<FString> AccelByteIdsToQuery;
 
 	/**
-	 * Array of user IDs returned from query by platform user IDs
+	 * Chunks of platform IDs to map to AccelByte IDs, along with the mappings returned for each chunk
 	 */
-	TArray<FPlatformUserIdMap> QueriedUserMapByPlatformUserIds;
+	TAccelByteChunkedRequestPipeline<TArray<FPlatformUserIdMap>> PlatformIdMappingPipeline;
 
 	/**
-	 * Index of the split user IDs we last fetch
+	 * Chunks of AccelByte IDs that were not cached, along with the basic user information returned for each chunk
 	 */
-	FThreadSafeCounter LastSplitQueryIndex {0};
+	TAccelByteChunkedRequestPipeline<TArray<FAccountUserPlatformData>> BasicUserInfoPipeline;
 
 	/**
 	 * Whether all of these users that we are querying will be marked as important.
@@ -87,11 +100,6 @@ private:
 	 */
 	FOnQueryUsersComplete Delegate;
 
-	/**
-	 * Actual array of user IDs that will be queried on the backend
-	 */
-	TQueue<FString> UsersToQuery;
-
 	/**
 	 * Native platform Ids to be queried using native OSS
 	 */
@@ -123,14 +131,19 @@ private:
 	FThreadSafeBool bHasQueriedUserPlatformInfo = false;
 
 	/**
-	 * Delegate handler for when querying platform ID mappings in bulk succeeds
+	 * Get the amount of chunk requests that each stage of this query may keep in flight at once
 	 */
-	void OnBulkQueryPlatformIdMappingsSuccess(const FBulkPlatformUserIdResponse& Result);
+	int32 GetMaxChunksInFlight() const;
 
 	/**
-	 * Delegate handler for when querying platform ID mappings in bulk fails
+	 * Delegate handler for when querying a chunk of platform ID mappings succeeds
 	 */
-	void OnBulkQueryPlatformIdMappingsError(int32 ErrorCode, const FString& ErrorMessage);
+	void OnBulkQueryPlatformIdMappingsSuccess(const FBulkPlatformUserIdResponse& Result, int32 ChunkIndex);
+
+	/**
+	 * Delegate handler for when querying a chunk of platform ID mappings fails
+	 */
+	void OnBulkQueryPlatformIdMappingsError(int32 ErrorCode, const FString& ErrorMessage, int32 ChunkIndex);
 
 	/**
 	 * Calls method to get basic user information by an array of AccelByte IDs
@@ -138,19 +151,24 @@ private:
 	void GetBasicUserInfo(const TArray<FString>& AccelByteIds);
 
 	/*
-	 * Query users basic info using low level SDK (only users that is not in cache).
+	 * Query basic info for a chunk of users using low level SDK (only users that is not in cache).
+	 */
+	void GetUserOtherPlatformBasicPublicInfo(int32 ChunkIndex, const TArray<FString>& AccelByteIds);
+
+	/**
+	 * Delegate handler for when querying basic user information for a chunk of AccelByte IDs succeeds
 	 */
-	void GetUserOtherPlatformBasicPublicInfo();
+	void OnGetUserOtherPlatformBasicPublicInfoSuccess(const FAccountUserPlatformInfosResponse& Result, int32 ChunkIndex);
 
 	/**
-	 * Delegate handler for when querying basic user information by AccelByte IDs succeeds
+	 * Delegate handler for when querying basic user information for a chunk of AccelByte IDs fails
 	 */
-	void OnGetUserOtherPlatformBasicPublicInfoSuccess(const FAccountUserPlatformInfosResponse& Result);
+	void OnGetUserOtherPlatformBasicPublicInfoError(int32 ErrorCode, const FString& ErrorMessage, int32 ChunkIndex);
 
 	/**
-	 * Delegate handler for when querying basic user information by platform IDs fails
+	 * Build the queried users out of the basic user information of every chunk, once they have all completed
 	 */
-	void OnGetUserOtherPlatformBasicPublicInfoError(int32 ErrorCode, const FString& ErrorMessage);
+	void ProcessBasicUserInfo(const TArray<FAccountUserPlatformData>& BasicInfos);
 
 	/**
 	 * Make a call to query the user manually on the platform that corresponds to the one we are currently on
@@ -164,7 +182,7 @@ private:
 	void ExtractPlatformDataFromBasicUserInfo(const FAccountUserPlatformData& BasicInfo, FAccelByteUniqueIdComposite& CompositeId);
 
 	/**
-	* Method to query User by Other Platform with an array of User IDs
+	* Method to query User by Other Platform with a chunk of User IDs
 	*/
-	void BulkGetUserByOtherPlatformUserIds(const TArray<FString>& InUserIds);
+	void BulkGetUserByOtherPlatformUserIds(int32 ChunkIndex, const TArray<FString>& InUserIds);
 };
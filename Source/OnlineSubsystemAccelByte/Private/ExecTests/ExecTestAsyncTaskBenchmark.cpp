@@ -0,0 +1,194 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestAsyncTaskBenchmark.h"
+#include "OnlineSubsystemUtils.h"
+#include "HAL/PlatformMemory.h"
+
+/** Timeout given to each benchmark task, high enough that only a stuck pipeline would ever hit it */
+#define BENCHMARK_TASK_TIMEOUT_SECONDS 300.0
+
+FExecTestAsyncTaskBenchmark::FExecTestAsyncTaskBenchmark(UWorld* InWorld, const FName& InSubsystemName, EExecTestAsyncTaskBenchmarkMode InMode, int32 InTaskCount)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, Mode(InMode)
+	, TaskCount(InTaskCount)
+{
+	static int32 RunIndex = 0;
+	TaskName = FString::Printf(TEXT("FExecTestAsyncTaskBenchmark_%s_%d"), ModeToString(Mode), RunIndex++);
+}
+
+bool FExecTestAsyncTaskBenchmark::Run()
+{
+	FOnlineSubsystemAccelByte* Subsystem = static_cast<FOnlineSubsystemAccelByte*>(::Online::GetSubsystem(World, SubsystemName));
+	if (Subsystem == nullptr || TaskCount <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestAsyncTaskBenchmark, subsystem is invalid or task count %d is not positive"), TaskCount);
+		return CompleteTest(false);
+	}
+
+	const FAccelByteAsyncTaskMetricsPtr Metrics = Subsystem->GetAsyncTaskMetrics();
+	if (Metrics.IsValid())
+	{
+		GameTickStatsBeforeRun = Metrics->GetGameTickStats();
+	}
+
+	UsedPhysicalBeforeDispatch = FPlatformMemory::GetStats().UsedPhysical;
+	StartTimeInSeconds = FPlatformTime::Seconds();
+
+	TaskParameters.Reserve(TaskCount);
+	for (int32 Index = 0; Index < TaskCount; Index++)
+	{
+		TSharedRef<MockAsyncTaskParameter> Parameter = MakeShared<MockAsyncTaskParameter>();
+		Parameter->TaskName = TaskName;
+		Parameter->TimeoutLimitSeconds = BENCHMARK_TASK_TIMEOUT_SECONDS;
+		Parameter->TaskCompleteDelegate = FMockAsyncTaskDone::CreateSP(AsShared(), &FExecTestAsyncTaskBenchmark::OnTaskComplete);
+		TaskParameters.Add(Parameter);
+	}
+
+	switch (Mode)
+	{
+	case EExecTestAsyncTaskBenchmarkMode::Parallel:
+		for (const TSharedRef<MockAsyncTaskParameter>& Parameter : TaskParameters)
+		{
+			Subsystem->CreateAndDispatchAsyncTaskParallel<FMockAsyncTaskAccelByte>(Subsystem, Parameter.Get());
+		}
+		break;
+	case EExecTestAsyncTaskBenchmarkMode::Serial:
+		for (const TSharedRef<MockAsyncTaskParameter>& Parameter : TaskParameters)
+		{
+			Subsystem->CreateAndDispatchAsyncTaskSerial<FMockAsyncTaskAccelByte>(Subsystem, Parameter.Get());
+		}
+		break;
+	case EExecTestAsyncTaskBenchmarkMode::Epic:
+	case EExecTestAsyncTaskBenchmarkMode::EpicSerial:
+	{
+		// The root task dispatches every other task from its initialize, so that they all land in the root's Epic
+		MockAsyncTaskParameter& RootParameter = TaskParameters[0].Get();
+		RootParameter.ChildCount = TaskCount - 1;
+		RootParameter.CreateChildDelegate = AccelByte::FVoidHandler::CreateSP(AsShared(), &FExecTestAsyncTaskBenchmark::DispatchEpicChildTasks, Subsystem);
+
+		const FOnlineAsyncTaskInfo TaskInfo(ETypeOfOnlineAsyncTask::Parallel, true);
+		Subsystem->CreateAndDispatchAsyncTask<FMockAsyncTaskAccelByte>(TaskInfo, Subsystem, RootParameter);
+		break;
+	}
+	default:
+		break;
+	}
+
+	DispatchSeconds = FPlatformTime::Seconds() - StartTimeInSeconds;
+	if (Mode != EExecTestAsyncTaskBenchmarkMode::Epic && Mode != EExecTestAsyncTaskBenchmarkMode::EpicSerial)
+	{
+		UsedPhysicalAfterDispatch = FPlatformMemory::GetStats().UsedPhysical;
+	}
+
+	return true;
+}
+
+bool FExecTestAsyncTaskBenchmark::ParseMode(const FString& InString, EExecTestAsyncTaskBenchmarkMode& OutMode)
+{
+	const EExecTestAsyncTaskBenchmarkMode Modes[] = {
+		EExecTestAsyncTaskBenchmarkMode::Parallel,
+		EExecTestAsyncTaskBenchmarkMode::Serial,
+		EExecTestAsyncTaskBenchmarkMode::Epic,
+		EExecTestAsyncTaskBenchmarkMode::EpicSerial
+	};
+
+	for (const EExecTestAsyncTaskBenchmarkMode Candidate : Modes)
+	{
+		if (InString.Equals(ModeToString(Candidate), ESearchCase::IgnoreCase))
+		{
+			OutMode = Candidate;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FExecTestAsyncTaskBenchmark::DispatchEpicChildTasks(FOnlineSubsystemAccelByte* Subsystem)
+{
+	for (int32 Index = 1; Index < TaskParameters.Num(); Index++)
+	{
+		if (Mode == EExecTestAsyncTaskBenchmarkMode::EpicSerial)
+		{
+			Subsystem->CreateAndDispatchAsyncTaskSerial<FMockAsyncTaskAccelByte>(Subsystem, TaskParameters[Index].Get());
+		}
+		else
+		{
+			Subsystem->CreateAndDispatchAsyncTaskParallel<FMockAsyncTaskAccelByte>(Subsystem, TaskParameters[Index].Get());
+		}
+	}
+
+	// Children are only created here, so this is the first point where every task of the run is alive
+	UsedPhysicalAfterDispatch = FPlatformMemory::GetStats().UsedPhysical;
+}
+
+void FExecTestAsyncTaskBenchmark::OnTaskComplete(const FOnlineError& Result)
+{
+	if (!Result.bSucceeded)
+	{
+		FailedTaskCount++;
+	}
+
+	CompletedTaskCount++;
+	if (CompletedTaskCount == TaskCount)
+	{
+		ReportResults();
+	}
+}
+
+void FExecTestAsyncTaskBenchmark::ReportResults()
+{
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTimeInSeconds;
+	const int64 MemoryDelta = static_cast<int64>(UsedPhysicalAfterDispatch) - static_cast<int64>(UsedPhysicalBeforeDispatch);
+
+	UE_LOG_AB(Log, TEXT("[%s] '%s' finished %d tasks in %.3f s, %.0f tasks/s"), GetResultTag(), *TaskName
+		, CompletedTaskCount, ElapsedSeconds, (ElapsedSeconds > 0.0) ? CompletedTaskCount / ElapsedSeconds : 0.0);
+	UE_LOG_AB(Log, TEXT("[%s] Dispatch: %.3f ms total, %.2f us per task"), GetResultTag(), DispatchSeconds * 1000.0, DispatchSeconds * 1000000.0 / TaskCount);
+	UE_LOG_AB(Log, TEXT("[%s] Memory: %lld bytes per task (physical memory delta across dispatch, approximate)"), GetResultTag(), MemoryDelta / TaskCount);
+	Check(FString::Printf(TEXT("%d of %d tasks failed"), FailedTaskCount, CompletedTaskCount), FailedTaskCount == 0);
+
+	const IOnlineSubsystem* Subsystem = ::Online::GetSubsystem(World, SubsystemName);
+	const FAccelByteAsyncTaskMetricsPtr Metrics = (Subsystem != nullptr) ? static_cast<const FOnlineSubsystemAccelByte*>(Subsystem)->GetAsyncTaskMetrics() : nullptr;
+	if (!Metrics.IsValid() || !Metrics->IsEnabled())
+	{
+		UE_LOG_AB(Log, TEXT("[%s] Async task metrics are disabled, per tick and latency results are not available"), GetResultTag());
+		CompleteTest();
+		return;
+	}
+
+	const FAccelByteAsyncTaskGameTickStats GameTickStats = Metrics->GetGameTickStats();
+	const uint64 TickCount = GameTickStats.TickCount - GameTickStatsBeforeRun.TickCount;
+	const double TickSeconds = GameTickStats.TotalSeconds - GameTickStatsBeforeRun.TotalSeconds;
+	UE_LOG_AB(Log, TEXT("[%s] Game tick: %llu ticks, %.1f us avg, %.1f us max since metrics were last reset"), GetResultTag(), TickCount
+		, (TickCount > 0) ? TickSeconds * 1000000.0 / TickCount : 0.0, GameTickStats.MaxSeconds * 1000000.0);
+
+	FAccelByteAsyncTaskClassMetrics TaskMetrics;
+	if (Metrics->GetTaskClassMetrics(TaskName, TaskMetrics))
+	{
+		UE_LOG_AB(Log, TEXT("[%s] Queue wait: %.1f ms p50, %.1f ms p99. Execution: %.1f ms p50, %.1f ms p99"), GetResultTag()
+			, TaskMetrics.QueueWait.GetPercentile(50.0), TaskMetrics.QueueWait.GetPercentile(99.0)
+			, TaskMetrics.Execution.GetPercentile(50.0), TaskMetrics.Execution.GetPercentile(99.0));
+	}
+
+	CompleteTest();
+}
+
+const TCHAR* FExecTestAsyncTaskBenchmark::ModeToString(EExecTestAsyncTaskBenchmarkMode InMode)
+{
+	switch (InMode)
+	{
+	case EExecTestAsyncTaskBenchmarkMode::Parallel: return TEXT("Parallel");
+	case EExecTestAsyncTaskBenchmarkMode::Serial: return TEXT("Serial");
+	case EExecTestAsyncTaskBenchmarkMode::Epic: return TEXT("Epic");
+	case EExecTestAsyncTaskBenchmarkMode::EpicSerial: return TEXT("EpicSerial");
+	default: return TEXT("Unknown");
+	}
+}
+
+#undef BENCHMARK_TASK_TIMEOUT_SECONDS
+
+#endif
@@ -0,0 +1,114 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "AsyncTasks/MockAsyncTaskAccelByte.h"
+#include "Utilities/AccelByteAsyncTaskMetrics.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** How the benchmark tasks are handed to the async task manager */
+enum class EExecTestAsyncTaskBenchmarkMode : uint8
+{
+	/** Every task is dispatched to the parallel task list through the priority scheduler */
+	Parallel,
+	/** Every task is dispatched to the serial in queue */
+	Serial,
+	/** A single root task creates an Epic, and every other task is dispatched into that Epic as its child */
+	Epic,
+	/** Same as Epic, but children are dispatched serially, stressing the Epic's stack container with a long chain */
+	EpicSerial
+};
+
+/**
+ * Benchmark for the async task pipeline, pushing mock tasks through FOnlineAsyncTaskManagerAccelByte and
+ * FOnlineAsyncEpicTaskAccelByte without touching the backend.
+ *
+ * Reports tasks per second, time spent by the task manager per game tick and the memory allocated per task. As mock
+ * tasks never send a request, this can run headless with -nullrhi and no network, for example through -ExecCmds.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST ASYNCTASK <PARALLEL|SERIAL|EPIC|EPICSERIAL> [TaskCount]
+ */
+class FExecTestAsyncTaskBenchmark : public FExecTestBase, public TSharedFromThis<FExecTestAsyncTaskBenchmark>
+{
+public:
+
+	/**
+	 * Constructs an instance of the async task benchmark.
+	 *
+	 * @param InMode How the benchmark tasks are dispatched
+	 * @param InTaskCount Amount of mock tasks to push through the pipeline
+	 */
+	FExecTestAsyncTaskBenchmark(UWorld* InWorld, const FName& InSubsystemName, EExecTestAsyncTaskBenchmarkMode InMode, int32 InTaskCount);
+
+	virtual bool Run() override;
+
+	/**
+	 * Parse a benchmark mode from a console command token.
+	 *
+	 * @return true if the token named one of the modes
+	 */
+	static bool ParseMode(const FString& InString, EExecTestAsyncTaskBenchmarkMode& OutMode);
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("ASYNCTASK");
+	}
+
+private:
+
+	/** How the benchmark tasks are dispatched */
+	EExecTestAsyncTaskBenchmarkMode Mode;
+
+	/** Amount of mock tasks to push through the pipeline */
+	int32 TaskCount;
+
+	/** Name shared by every task of this run, so that their metrics are aggregated apart from any other run */
+	FString TaskName;
+
+	/** Parameters of each mock task, the tasks only hold a reference so these must outlive them */
+	TArray<TSharedRef<MockAsyncTaskParameter>> TaskParameters;
+
+	/** Amount of tasks that have triggered their delegates */
+	int32 CompletedTaskCount = 0;
+
+	/** Amount of tasks that triggered their delegates with a failure */
+	int32 FailedTaskCount = 0;
+
+	/** Time that the first task was dispatched */
+	double StartTimeInSeconds = 0.0;
+
+	/** Time spent dispatching every task from the game thread */
+	double DispatchSeconds = 0.0;
+
+	/** Physical memory in use right before the tasks were created */
+	uint64 UsedPhysicalBeforeDispatch = 0;
+
+	/** Physical memory in use right after every task was created, before any of them was destroyed */
+	uint64 UsedPhysicalAfterDispatch = 0;
+
+	/** Game tick stats from before the run, to only report the ticks that happened while it was going */
+	FAccelByteAsyncTaskGameTickStats GameTickStatsBeforeRun;
+
+	/** Dispatch every child task of the Epic root, called from the root task initialize on the online thread */
+	void DispatchEpicChildTasks(FOnlineSubsystemAccelByte* Subsystem);
+
+	/** Delegate callback for when a single mock task completes */
+	void OnTaskComplete(const FOnlineError& Result);
+
+	/** Log the results once every task has completed */
+	void ReportResults();
+
+	static const TCHAR* ModeToString(EExecTestAsyncTaskBenchmarkMode InMode);
+
+};
+
+#endif
@@ -0,0 +1,135 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestAsyncTaskCoalescing.h"
+#include "OnlineSubsystemUtils.h"
+
+/** Time that each mock task takes to complete once started, long enough for every identical task to be dispatched */
+#define ASYNC_TASK_COALESCING_TEST_TASK_SECONDS 0.5
+
+/** Time after which the test fails if mock tasks are still waiting */
+#define ASYNC_TASK_COALESCING_TEST_TIMEOUT_SECONDS 30.0f
+
+FExecTestAsyncTaskCoalescing::FExecTestAsyncTaskCoalescing(UWorld* InWorld, const FName& InSubsystemName, int32 InTaskCount)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, TaskCount(InTaskCount)
+{
+}
+
+bool FExecTestAsyncTaskCoalescing::Run()
+{
+	if (TaskCount < 2)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestAsyncTaskCoalescing, task count %d must be at least 2"), TaskCount);
+		return CompleteTest(false);
+	}
+
+	Subsystem = static_cast<FOnlineSubsystemAccelByte*>(::Online::GetSubsystem(World, SubsystemName));
+	AsyncTaskManager = (Subsystem != nullptr) ? Subsystem->GetAsyncTaskManager() : nullptr;
+	if (!AsyncTaskManager.IsValid())
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestAsyncTaskCoalescing, subsystem or its async task manager is invalid"));
+		return CompleteTest(false);
+	}
+
+	KeepAlive = AsShared();
+	CoalescingKey = FString::Printf(TEXT("FExecTestAsyncTaskCoalescing_%s"), *FGuid::NewGuid().ToString());
+
+	TaskParameters.Reserve(TaskCount);
+	for (int32 Index = 0; Index < TaskCount; Index++)
+	{
+		TaskParameters.Add(DispatchTask(&FExecTestAsyncTaskCoalescing::OnTaskComplete));
+	}
+
+	// The first task is still in flight here, as it takes a while to complete once started
+	const int32 AttachedCount = AsyncTaskManager->GetCoalescedTaskCount(CoalescingKey);
+	Check(FString::Printf(TEXT("%d of %d identical tasks attached to the first one"), AttachedCount, TaskCount), AttachedCount == TaskCount - 1);
+
+	TimeoutHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FExecTestAsyncTaskCoalescing::OnTimeout), ASYNC_TASK_COALESCING_TEST_TIMEOUT_SECONDS);
+	return true;
+}
+
+TSharedRef<MockAsyncTaskParameter> FExecTestAsyncTaskCoalescing::DispatchTask(void (FExecTestAsyncTaskCoalescing::*OnComplete)(const FOnlineError&))
+{
+	TSharedRef<MockAsyncTaskParameter> Parameter = MakeShared<MockAsyncTaskParameter>();
+	Parameter->TaskName = TEXT("FExecTestAsyncTaskCoalescing");
+	Parameter->CoalescingKey = CoalescingKey;
+	Parameter->CompletionTime = ASYNC_TASK_COALESCING_TEST_TASK_SECONDS;
+	Parameter->TimeoutLimitSeconds = ASYNC_TASK_COALESCING_TEST_TIMEOUT_SECONDS;
+	Parameter->TaskCompleteDelegate = FMockAsyncTaskDone::CreateSP(AsShared(), OnComplete);
+
+	Subsystem->CreateAndDispatchAsyncTaskParallel<FMockAsyncTaskAccelByte>(Subsystem, Parameter.Get());
+	return Parameter;
+}
+
+void FExecTestAsyncTaskCoalescing::OnTaskComplete(const FOnlineError& Result)
+{
+	CompletedTaskCount++;
+	if (Result.bSucceeded)
+	{
+		SucceededTaskCount++;
+	}
+
+	if (CompletedTaskCount < TaskCount)
+	{
+		return;
+	}
+
+	uint32 StartedCount = 0;
+	for (const TSharedRef<MockAsyncTaskParameter>& Parameter : TaskParameters)
+	{
+		StartedCount += Parameter->StartedCount;
+	}
+
+	const int32 AttachedCount = AsyncTaskManager->GetCoalescedTaskCount(CoalescingKey);
+	if (!bIsComplete)
+	{
+		Check(FString::Printf(TEXT("One of %d identical tasks started its work, %u did"), TaskCount, StartedCount), StartedCount == 1);
+		Check(FString::Printf(TEXT("Every identical task succeeded, %d of %d did"), SucceededTaskCount, TaskCount), SucceededTaskCount == TaskCount);
+		Check(FString::Printf(TEXT("No task left attached, %d are"), AttachedCount), AttachedCount == 0);
+	}
+
+	// The key is free again, so an identical task dispatched now must start a request of its own
+	LateTaskParameter = DispatchTask(&FExecTestAsyncTaskCoalescing::OnLateTaskComplete);
+}
+
+void FExecTestAsyncTaskCoalescing::OnLateTaskComplete(const FOnlineError& Result)
+{
+	if (!bIsComplete)
+	{
+		Check(FString::Printf(TEXT("Task dispatched after completion started its work, %u times"), LateTaskParameter->StartedCount)
+			, Result.bSucceeded && LateTaskParameter->StartedCount == 1);
+		CompleteTest();
+	}
+
+	Finish();
+}
+
+bool FExecTestAsyncTaskCoalescing::OnTimeout(float DeltaTime)
+{
+	TimeoutHandle.Reset();
+
+	// Mock tasks may still complete after this, this test stays alive until they have
+	Check(FString::Printf(TEXT("Tasks completed within %.0f seconds, %d of %d done"), ASYNC_TASK_COALESCING_TEST_TIMEOUT_SECONDS, CompletedTaskCount, TaskCount), false);
+	CompleteTest();
+	return false;
+}
+
+void FExecTestAsyncTaskCoalescing::Finish()
+{
+	if (TimeoutHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(TimeoutHandle);
+		TimeoutHandle.Reset();
+	}
+
+	KeepAlive.Reset();
+}
+
+#undef ASYNC_TASK_COALESCING_TEST_TASK_SECONDS
+#undef ASYNC_TASK_COALESCING_TEST_TIMEOUT_SECONDS
+
+#endif
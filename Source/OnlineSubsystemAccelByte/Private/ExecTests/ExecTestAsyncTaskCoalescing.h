@@ -0,0 +1,93 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Core/AccelByteDefines.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "AsyncTasks/MockAsyncTaskAccelByte.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test for the coalescing of identical requests in FOnlineAsyncTaskManagerAccelByte, pushing mock tasks through it
+ * without touching the backend.
+ *
+ * Dispatches several mock tasks sharing a coalescing key back to back, and checks that:
+ * - Every task past the first one is attached to the first one rather than dispatched
+ * - Only the first task starts its work, while every task completes successfully
+ * - No task is left attached once they have completed
+ * - A task with the same key dispatched after that starts its own work again
+ *
+ * Completes from the delegate of the last mock task, or fails once the timeout passes.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST ASYNCTASKCOALESCING [TaskCount]
+ */
+class FExecTestAsyncTaskCoalescing : public FExecTestBase, public TSharedFromThis<FExecTestAsyncTaskCoalescing>
+{
+public:
+
+	/**
+	 * Constructs an instance of the async task coalescing test.
+	 *
+	 * @param InTaskCount Amount of identical mock tasks to dispatch
+	 */
+	FExecTestAsyncTaskCoalescing(UWorld* InWorld, const FName& InSubsystemName, int32 InTaskCount);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("ASYNCTASKCOALESCING");
+	}
+
+private:
+
+	/** Amount of identical mock tasks to dispatch */
+	int32 TaskCount;
+
+	/** Coalescing key shared by every mock task, unique to this run */
+	FString CoalescingKey;
+
+	FOnlineSubsystemAccelByte* Subsystem = nullptr;
+
+	/** Async task manager of the subsystem under test */
+	FOnlineAsyncTaskManagerAccelBytePtr AsyncTaskManager;
+
+	/** Parameters of each identical mock task, the tasks only hold a reference so these must outlive them */
+	TArray<TSharedRef<MockAsyncTaskParameter>> TaskParameters;
+
+	/** Parameter of the mock task dispatched once the identical ones have completed */
+	TSharedPtr<MockAsyncTaskParameter> LateTaskParameter;
+
+	/** Keeps this test alive until every mock task has completed, even if it timed out first */
+	TSharedPtr<FExecTestAsyncTaskCoalescing> KeepAlive;
+
+	int32 CompletedTaskCount = 0;
+
+	int32 SucceededTaskCount = 0;
+
+	FDelegateHandleAlias TimeoutHandle;
+
+	/** Dispatch a parallel mock task with the coalescing key of this run */
+	TSharedRef<MockAsyncTaskParameter> DispatchTask(void (FExecTestAsyncTaskCoalescing::*OnComplete)(const FOnlineError&));
+
+	void OnTaskComplete(const FOnlineError& Result);
+
+	void OnLateTaskComplete(const FOnlineError& Result);
+
+	bool OnTimeout(float DeltaTime);
+
+	/** Stop the timeout and let go of this test */
+	void Finish();
+
+};
+
+#endif
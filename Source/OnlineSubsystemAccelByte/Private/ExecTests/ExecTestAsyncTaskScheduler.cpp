@@ -0,0 +1,164 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestAsyncTaskScheduler.h"
+#include "OnlineSubsystemUtils.h"
+
+/** Amount of Normal mock tasks dispatched behind the Background backlog */
+#define ASYNC_TASK_SCHEDULER_TEST_NORMAL_TASK_COUNT 2
+
+/** Time that each mock task takes to complete once it is admitted */
+#define ASYNC_TASK_SCHEDULER_TEST_TASK_SECONDS 0.1
+
+/** Time after which the test fails if mock tasks are still waiting, well past the time needed to drain the backlog */
+#define ASYNC_TASK_SCHEDULER_TEST_TIMEOUT_SECONDS 30.0f
+
+FExecTestAsyncTaskScheduler::FExecTestAsyncTaskScheduler(UWorld* InWorld, const FName& InSubsystemName, int32 InTaskCount, int32 InBackgroundLimit)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, TaskCount(InTaskCount)
+	, BackgroundLimit(InBackgroundLimit)
+{
+}
+
+bool FExecTestAsyncTaskScheduler::Run()
+{
+	if (BackgroundLimit <= 0 || TaskCount <= BackgroundLimit)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestAsyncTaskScheduler, background limit %d must be positive and below task count %d"), BackgroundLimit, TaskCount);
+		return CompleteTest(false);
+	}
+
+	FOnlineSubsystemAccelByte* Subsystem = static_cast<FOnlineSubsystemAccelByte*>(::Online::GetSubsystem(World, SubsystemName));
+	AsyncTaskManager = (Subsystem != nullptr) ? Subsystem->GetAsyncTaskManager() : nullptr;
+	if (!AsyncTaskManager.IsValid())
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestAsyncTaskScheduler, subsystem or its async task manager is invalid"));
+		return CompleteTest(false);
+	}
+
+	KeepAlive = AsShared();
+	PreviousBackgroundLimit = AsyncTaskManager->GetMaxParallelTasksForPriority(EAccelByteAsyncTaskPriority::Background);
+	AsyncTaskManager->SetMaxParallelTasksForPriority(EAccelByteAsyncTaskPriority::Background, BackgroundLimit);
+	BaselineActiveCount = AsyncTaskManager->GetActiveParallelTaskCount(EAccelByteAsyncTaskPriority::Background);
+
+	TaskParameters.Reserve(TaskCount + ASYNC_TASK_SCHEDULER_TEST_NORMAL_TASK_COUNT);
+	for (int32 Index = 0; Index < TaskCount; Index++)
+	{
+		DispatchTask(Subsystem, EAccelByteAsyncTaskPriority::Background, ASYNC_TASK_SCHEDULER_TEST_TASK_SECONDS, &FExecTestAsyncTaskScheduler::OnBackgroundTaskComplete);
+	}
+
+	// Tasks are only admitted from the online thread tick, so everything past the free slots is still waiting here
+	const int32 PendingCount = AsyncTaskManager->GetPendingParallelTaskCount(EAccelByteAsyncTaskPriority::Background);
+	SampleActiveCount();
+	Check(FString::Printf(TEXT("%d of %d Background tasks wait for a slot"), PendingCount, TaskCount), PendingCount >= TaskCount - BackgroundLimit);
+
+	for (int32 Index = 0; Index < ASYNC_TASK_SCHEDULER_TEST_NORMAL_TASK_COUNT; Index++)
+	{
+		DispatchTask(Subsystem, EAccelByteAsyncTaskPriority::Normal, ASYNC_TASK_SCHEDULER_TEST_TASK_SECONDS, &FExecTestAsyncTaskScheduler::OnNormalTaskComplete);
+	}
+
+	TimeoutHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FExecTestAsyncTaskScheduler::OnTimeout), ASYNC_TASK_SCHEDULER_TEST_TIMEOUT_SECONDS);
+	return true;
+}
+
+void FExecTestAsyncTaskScheduler::DispatchTask(FOnlineSubsystemAccelByte* Subsystem, EAccelByteAsyncTaskPriority Priority, double CompletionTime, void (FExecTestAsyncTaskScheduler::*OnComplete)(const FOnlineError&))
+{
+	TSharedRef<MockAsyncTaskParameter> Parameter = MakeShared<MockAsyncTaskParameter>();
+	Parameter->TaskName = FString::Printf(TEXT("FExecTestAsyncTaskScheduler_%s"), *AsyncTaskPriorityToString(Priority));
+	Parameter->Priority = Priority;
+	Parameter->CompletionTime = CompletionTime;
+	Parameter->TimeoutLimitSeconds = ASYNC_TASK_SCHEDULER_TEST_TIMEOUT_SECONDS;
+	Parameter->TaskCompleteDelegate = FMockAsyncTaskDone::CreateSP(AsShared(), OnComplete);
+	TaskParameters.Add(Parameter);
+
+	Subsystem->CreateAndDispatchAsyncTaskParallel<FMockAsyncTaskAccelByte>(Subsystem, Parameter.Get());
+}
+
+void FExecTestAsyncTaskScheduler::OnBackgroundTaskComplete(const FOnlineError& Result)
+{
+	SampleActiveCount();
+	CompletedBackgroundTaskCount++;
+	if (CompletedBackgroundTaskCount == TaskCount && CompletedNormalTaskCount == ASYNC_TASK_SCHEDULER_TEST_NORMAL_TASK_COUNT)
+	{
+		Finish();
+	}
+}
+
+void FExecTestAsyncTaskScheduler::OnNormalTaskComplete(const FOnlineError& Result)
+{
+	CompletedNormalTaskCount++;
+	if (CompletedNormalTaskCount == ASYNC_TASK_SCHEDULER_TEST_NORMAL_TASK_COUNT)
+	{
+		BackgroundCompletedBeforeNormalCount = CompletedBackgroundTaskCount;
+		if (CompletedBackgroundTaskCount == TaskCount)
+		{
+			Finish();
+		}
+	}
+}
+
+void FExecTestAsyncTaskScheduler::SampleActiveCount()
+{
+	MaxObservedActiveCount = FMath::Max(MaxObservedActiveCount, AsyncTaskManager->GetActiveParallelTaskCount(EAccelByteAsyncTaskPriority::Background));
+}
+
+void FExecTestAsyncTaskScheduler::Finish()
+{
+	// Slots are handed back as tasks complete, before their delegates fire, so none of ours may be held anymore
+	const int32 ActiveCount = AsyncTaskManager->GetActiveParallelTaskCount(EAccelByteAsyncTaskPriority::Background);
+	const int32 PendingCount = AsyncTaskManager->GetPendingParallelTaskCount(EAccelByteAsyncTaskPriority::Background);
+	RestoreScheduler();
+
+	if (!bIsComplete)
+	{
+		Check(FString::Printf(TEXT("At most %d Background tasks in flight, %d seen"), FMath::Max(BackgroundLimit, BaselineActiveCount), MaxObservedActiveCount)
+			, MaxObservedActiveCount <= FMath::Max(BackgroundLimit, BaselineActiveCount));
+		Check(FString::Printf(TEXT("Every slot released, %d Background tasks in flight and %d pending afterwards"), ActiveCount, PendingCount)
+			, ActiveCount <= BaselineActiveCount && PendingCount == 0);
+		Check(FString::Printf(TEXT("Normal tasks done while %d of %d Background tasks were"), BackgroundCompletedBeforeNormalCount, TaskCount)
+			, BackgroundCompletedBeforeNormalCount < TaskCount);
+		CompleteTest();
+	}
+
+	KeepAlive.Reset();
+}
+
+bool FExecTestAsyncTaskScheduler::OnTimeout(float DeltaTime)
+{
+	TimeoutHandle.Reset();
+	RestoreScheduler();
+
+	// Mock tasks may still complete now that the limit is back, this test stays alive until they have
+	Check(FString::Printf(TEXT("Tasks completed within %.0f seconds, %d of %d Background and %d of %d Normal done")
+		, ASYNC_TASK_SCHEDULER_TEST_TIMEOUT_SECONDS
+		, CompletedBackgroundTaskCount
+		, TaskCount
+		, CompletedNormalTaskCount
+		, ASYNC_TASK_SCHEDULER_TEST_NORMAL_TASK_COUNT)
+		, false);
+	CompleteTest();
+	return false;
+}
+
+void FExecTestAsyncTaskScheduler::RestoreScheduler()
+{
+	if (TimeoutHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(TimeoutHandle);
+		TimeoutHandle.Reset();
+	}
+
+	if (AsyncTaskManager.IsValid() && AsyncTaskManager->GetMaxParallelTasksForPriority(EAccelByteAsyncTaskPriority::Background) == BackgroundLimit)
+	{
+		AsyncTaskManager->SetMaxParallelTasksForPriority(EAccelByteAsyncTaskPriority::Background, PreviousBackgroundLimit);
+	}
+}
+
+#undef ASYNC_TASK_SCHEDULER_TEST_NORMAL_TASK_COUNT
+#undef ASYNC_TASK_SCHEDULER_TEST_TASK_SECONDS
+#undef ASYNC_TASK_SCHEDULER_TEST_TIMEOUT_SECONDS
+
+#endif
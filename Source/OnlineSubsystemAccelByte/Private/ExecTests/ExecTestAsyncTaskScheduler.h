@@ -0,0 +1,108 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Core/AccelByteDefines.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "AsyncTasks/MockAsyncTaskAccelByte.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test for the priority scheduler of FOnlineAsyncTaskManagerAccelByte, pushing mock tasks through it without touching
+ * the backend.
+ *
+ * Lowers the Background concurrency limit, dispatches more Background mock tasks than that limit followed by a few
+ * Normal ones, and checks that:
+ * - Background tasks past the limit wait in the pending queue, and no more than the limit are ever in flight
+ * - Every Background task completes, meaning that completed tasks hand their slot back
+ * - Normal tasks do not wait behind the Background backlog
+ *
+ * The previous Background limit is restored once the test completes. Completes from the delegate of the last mock task,
+ * or fails once the timeout passes.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST ASYNCTASKSCHEDULER [TaskCount] [BackgroundLimit]
+ */
+class FExecTestAsyncTaskScheduler : public FExecTestBase, public TSharedFromThis<FExecTestAsyncTaskScheduler>
+{
+public:
+
+	/**
+	 * Constructs an instance of the async task scheduler test.
+	 *
+	 * @param InTaskCount Amount of Background mock tasks to dispatch
+	 * @param InBackgroundLimit Background concurrency limit used for the test
+	 */
+	FExecTestAsyncTaskScheduler(UWorld* InWorld, const FName& InSubsystemName, int32 InTaskCount, int32 InBackgroundLimit);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("ASYNCTASKSCHEDULER");
+	}
+
+private:
+
+	/** Amount of Background mock tasks to dispatch */
+	int32 TaskCount;
+
+	/** Background concurrency limit used for the test */
+	int32 BackgroundLimit;
+
+	/** Background concurrency limit from before the test, restored once it completes */
+	int32 PreviousBackgroundLimit = 0;
+
+	/** Background tasks already in flight before the test, as the subsystem may be running some of its own */
+	int32 BaselineActiveCount = 0;
+
+	/** Async task manager of the subsystem under test */
+	FOnlineAsyncTaskManagerAccelBytePtr AsyncTaskManager;
+
+	/** Parameters of each mock task, the tasks only hold a reference so these must outlive them */
+	TArray<TSharedRef<MockAsyncTaskParameter>> TaskParameters;
+
+	/** Keeps this test alive until every mock task has completed, even if it timed out first */
+	TSharedPtr<FExecTestAsyncTaskScheduler> KeepAlive;
+
+	int32 CompletedBackgroundTaskCount = 0;
+
+	int32 CompletedNormalTaskCount = 0;
+
+	/** Amount of Background tasks that had completed when the last Normal task completed */
+	int32 BackgroundCompletedBeforeNormalCount = INDEX_NONE;
+
+	/** Highest amount of Background tasks seen in flight from the delegate of any mock task */
+	int32 MaxObservedActiveCount = 0;
+
+	FDelegateHandleAlias TimeoutHandle;
+
+	/** Dispatch a parallel mock task under the given priority class */
+	void DispatchTask(FOnlineSubsystemAccelByte* Subsystem, EAccelByteAsyncTaskPriority Priority, double CompletionTime, void (FExecTestAsyncTaskScheduler::*OnComplete)(const FOnlineError&));
+
+	void OnBackgroundTaskComplete(const FOnlineError& Result);
+
+	void OnNormalTaskComplete(const FOnlineError& Result);
+
+	/** Record how many Background tasks are in flight right now */
+	void SampleActiveCount();
+
+	/** Run the final checks once every mock task has completed */
+	void Finish();
+
+	bool OnTimeout(float DeltaTime);
+
+	/** Put the Background concurrency limit back and stop the timeout */
+	void RestoreScheduler();
+
+};
+
+#endif
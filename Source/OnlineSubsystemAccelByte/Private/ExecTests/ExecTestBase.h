@@ -10,6 +10,7 @@
 #else
 #include "UObject/CoreOnline.h"
 #endif
+#include "OnlineSubsystemAccelByte.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -62,6 +63,49 @@ protected:
 	/** Name of the subsystem we want to use with this test */
 	FName SubsystemName;
 
+	/**
+	 * Tag that the results of this test are logged under, such that every line can be found with a single search of the
+	 * log, for example "[CHATRINGBUFFER] passed".
+	 */
+	virtual const TCHAR* GetResultTag() const
+	{
+		return TEXT("EXECTEST");
+	}
+
+	/**
+	 * Log the outcome of a single check of this test. A failed check fails the whole test once it completes.
+	 *
+	 * @param Description What was checked, along with any measurements worth logging next to it
+	 * @param bPassed Whether the check passed
+	 * @return bPassed, so that checks can be chained
+	 */
+	bool Check(const FString& Description, bool bPassed)
+	{
+		UE_LOG_AB(Log, TEXT("[%s] %s: %s"), GetResultTag(), *Description, bPassed ? TEXT("passed") : TEXT("FAILED"));
+		bHasFailedCheck |= !bPassed;
+		return bPassed;
+	}
+
+	/**
+	 * Mark this test as complete and log its overall outcome. Tests that finish asynchronously call this from their
+	 * last callback, rather than blocking the game thread until they are done.
+	 *
+	 * @param bPassed Whether the test passed, on top of every check reported so far
+	 * @return Whether the test passed
+	 */
+	bool CompleteTest(bool bPassed = true)
+	{
+		bPassed &= !bHasFailedCheck;
+		bIsComplete = true;
+		UE_LOG_AB(Log, TEXT("[%s] %s"), GetResultTag(), bPassed ? TEXT("passed") : TEXT("FAILED"));
+		return bPassed;
+	}
+
+private:
+
+	/** Whether any check reported through Check has failed */
+	bool bHasFailedCheck = false;
+
 };
 
 #endif
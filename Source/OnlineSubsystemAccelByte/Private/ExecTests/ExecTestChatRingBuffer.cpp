@@ -0,0 +1,97 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestChatRingBuffer.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineChatInterfaceAccelByte.h"
+
+FExecTestChatRingBuffer::FExecTestChatRingBuffer(UWorld* InWorld, const FName& InSubsystemName, int32 InMessageCount, int32 InCapacity)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, MessageCount(InMessageCount)
+	, Capacity(InCapacity)
+{
+}
+
+bool FExecTestChatRingBuffer::Run()
+{
+	if (MessageCount <= 0 || Capacity <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestChatRingBuffer, message count %d and capacity %d must be positive"), MessageCount, Capacity);
+		return CompleteTest(false);
+	}
+
+	const FUniqueNetIdRef SenderId = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(TEXT("0123456789abcdef0123456789abcdef")));
+	const FDateTime Timestamp = FDateTime::UtcNow();
+
+	TArray<TSharedRef<FChatMessage>> Messages;
+	Messages.Reserve(MessageCount);
+	for (int32 Index = 0; Index < MessageCount; Index++)
+	{
+		Messages.Add(MakeShared<FAccelByteChatMessage>(SenderId, TEXT("Sender"), FString::FromInt(Index), Timestamp));
+	}
+
+	FChatMessageRingBuffer RingBuffer(Capacity);
+	const double StartSeconds = FPlatformTime::Seconds();
+	for (const TSharedRef<FChatMessage>& Message : Messages)
+	{
+		RingBuffer.Add(Message);
+	}
+	const double RingBufferSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	// Previous approach, an array that drops its first message once it is over capacity
+	TArray<TSharedRef<FChatMessage>> Reference;
+	const double ReferenceStartSeconds = FPlatformTime::Seconds();
+	for (const TSharedRef<FChatMessage>& Message : Messages)
+	{
+		Reference.Add(Message);
+		if (Reference.Num() > Capacity)
+		{
+			Reference.RemoveAt(0);
+		}
+	}
+	const double ReferenceSeconds = FPlatformTime::Seconds() - ReferenceStartSeconds;
+
+	UE_LOG_AB(Log, TEXT("[%s] %d messages at capacity %d: %.3f us per message, previous array %.3f us per message"), GetResultTag()
+		, MessageCount
+		, Capacity
+		, RingBufferSeconds * 1000000.0 / MessageCount
+		, ReferenceSeconds * 1000000.0 / MessageCount);
+
+	bool bContentPassed = RingBuffer.Num() == Reference.Num();
+	for (int32 Index = 0; bContentPassed && Index < Reference.Num(); Index++)
+	{
+		bContentPassed = RingBuffer[Index] == Reference[Index];
+	}
+	Check(TEXT("Content"), bContentPassed);
+
+	// Reading the last messages returns them newest first, and never more than are held
+	TArray<TSharedRef<FChatMessage>> LastMessages;
+	RingBuffer.ForEachFromNewest(Capacity + 1, [&LastMessages](const TSharedRef<FChatMessage>& Message)
+	{
+		LastMessages.Add(Message);
+	});
+	bool bNewestFirstPassed = LastMessages.Num() == Reference.Num();
+	for (int32 Index = 0; bNewestFirstPassed && Index < LastMessages.Num(); Index++)
+	{
+		bNewestFirstPassed = LastMessages[Index] == Reference[Reference.Num() - 1 - Index];
+	}
+	Check(TEXT("Newest first"), bNewestFirstPassed);
+
+	// Shrinking keeps the newest messages, and growing again makes room without dropping any
+	const int32 ShrunkCapacity = FMath::Max(Capacity / 2, 1);
+	RingBuffer.SetCapacity(ShrunkCapacity);
+	bool bResizePassed = RingBuffer.Num() == FMath::Min(ShrunkCapacity, Reference.Num())
+		&& RingBuffer.GetFromNewest(0) == Reference.Last();
+	RingBuffer.SetCapacity(Capacity);
+	const int32 NumBeforeGrow = RingBuffer.Num();
+	RingBuffer.Add(Messages[0]);
+	bResizePassed &= RingBuffer.Num() == FMath::Min(NumBeforeGrow + 1, Capacity) && RingBuffer.GetFromNewest(0) == Messages[0];
+	Check(TEXT("Resize"), bResizePassed);
+
+	return CompleteTest();
+}
+
+#endif
@@ -0,0 +1,54 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test for the ring buffer that caches the most recent chat messages of each room.
+ *
+ * Adds the given amount of messages to a buffer of the given capacity and checks, against the previous approach of an
+ * array trimmed from the front, that the same messages are kept in the same order and that reading the newest messages
+ * returns them newest first. Also checks shrinking and growing the capacity. Logs the time taken to add the messages
+ * with either approach.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST CHATRINGBUFFER [MessageCount] [Capacity]
+ */
+class FExecTestChatRingBuffer : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the chat ring buffer test.
+	 *
+	 * @param InMessageCount Amount of messages added to the room
+	 * @param InCapacity Maximum amount of messages cached for the room
+	 */
+	FExecTestChatRingBuffer(UWorld* InWorld, const FName& InSubsystemName, int32 InMessageCount, int32 InCapacity);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("CHATRINGBUFFER");
+	}
+
+private:
+
+	/** Amount of messages added to the room */
+	int32 MessageCount;
+
+	/** Maximum amount of messages cached for the room */
+	int32 Capacity;
+
+};
+
+#endif
@@ -0,0 +1,111 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestChatRoomMembers.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineChatInterfaceAccelByte.h"
+
+FExecTestChatRoomMembers::FExecTestChatRoomMembers(UWorld* InWorld, const FName& InSubsystemName, int32 InMemberCount, int32 InOperationCount)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, MemberCount(InMemberCount)
+	, OperationCount(InOperationCount)
+{
+}
+
+bool FExecTestChatRoomMembers::Run()
+{
+	if (MemberCount <= 0 || OperationCount <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestChatRoomMembers, member count %d and operation count %d must be positive"), MemberCount, OperationCount);
+		return CompleteTest(false);
+	}
+
+	// Twice as many candidate IDs as members, so that half of the lookups miss
+	TArray<FString> UserIds;
+	UserIds.Reserve(MemberCount * 2);
+	for (int32 Index = 0; Index < MemberCount * 2; Index++)
+	{
+		UserIds.Add(FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower());
+	}
+
+	FAccelByteModelsChatTopicQueryData TopicData;
+	TopicData.TopicId = TEXT("g.0123456789abcdef0123456789abcdef");
+	TopicData.Members.Append(UserIds.GetData(), MemberCount);
+
+	// Topic data listing a member twice keeps a single entry for that member
+	TopicData.Members.Add(UserIds[0]);
+	const FAccelByteChatRoomInfoRef RoomInfo = FAccelByteChatRoomInfo::Create();
+	RoomInfo->SetTopicData(TopicData);
+	const bool bDuplicatePassed = RoomInfo->GetMemberCount() == MemberCount;
+	TopicData.Members.Pop();
+
+	TArray<FString> Reference = TopicData.Members;
+
+	FRandomStream Stream(MemberCount);
+	TArray<int32> Operations;
+	Operations.Reserve(OperationCount);
+	for (int32 Index = 0; Index < OperationCount; Index++)
+	{
+		Operations.Add(Stream.RandHelper(UserIds.Num()));
+	}
+
+	int32 HitCount = 0;
+	const double LookupStartSeconds = FPlatformTime::Seconds();
+	for (const int32 Operation : Operations)
+	{
+		HitCount += RoomInfo->HasMember(UserIds[Operation]) ? 1 : 0;
+	}
+	const double LookupSeconds = FPlatformTime::Seconds() - LookupStartSeconds;
+
+	int32 ReferenceHitCount = 0;
+	const double ReferenceLookupStartSeconds = FPlatformTime::Seconds();
+	for (const int32 Operation : Operations)
+	{
+		ReferenceHitCount += Reference.Contains(UserIds[Operation]) ? 1 : 0;
+	}
+	const double ReferenceLookupSeconds = FPlatformTime::Seconds() - ReferenceLookupStartSeconds;
+
+	// Members leave and join again, and IDs that are not members leave without effect
+	const double ChurnStartSeconds = FPlatformTime::Seconds();
+	for (const int32 Operation : Operations)
+	{
+		RoomInfo->RemoveMember(UserIds[Operation]);
+		RoomInfo->AddMember(UserIds[Operation % MemberCount]);
+	}
+	const double ChurnSeconds = FPlatformTime::Seconds() - ChurnStartSeconds;
+
+	const double ReferenceChurnStartSeconds = FPlatformTime::Seconds();
+	for (const int32 Operation : Operations)
+	{
+		Reference.Remove(UserIds[Operation]);
+		Reference.AddUnique(UserIds[Operation % MemberCount]);
+	}
+	const double ReferenceChurnSeconds = FPlatformTime::Seconds() - ReferenceChurnStartSeconds;
+
+	bool bMembersPassed = RoomInfo->GetMemberCount() == Reference.Num();
+	for (int32 Index = 0; bMembersPassed && Index < UserIds.Num(); Index++)
+	{
+		bMembersPassed = RoomInfo->HasMember(UserIds[Index]) == Reference.Contains(UserIds[Index]);
+	}
+	for (int32 Index = 0; bMembersPassed && Index < RoomInfo->GetMemberCount(); Index++)
+	{
+		bMembersPassed = Reference.Contains(RoomInfo->GetMembers()[Index]);
+	}
+
+	UE_LOG_AB(Log, TEXT("[%s] %d members: %.3f us per lookup, previous array %.3f us per lookup, %.3f us per leave and join, previous array %.3f us per leave and join"), GetResultTag()
+		, MemberCount
+		, LookupSeconds * 1000000.0 / OperationCount
+		, ReferenceLookupSeconds * 1000000.0 / OperationCount
+		, ChurnSeconds * 1000000.0 / OperationCount
+		, ReferenceChurnSeconds * 1000000.0 / OperationCount);
+
+	Check(TEXT("Duplicate members"), bDuplicatePassed);
+	Check(TEXT("Lookups"), HitCount == ReferenceHitCount);
+	Check(TEXT("Members after churn"), bMembersPassed);
+	return CompleteTest();
+}
+
+#endif
@@ -0,0 +1,54 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test for the membership index of chat room info.
+ *
+ * Fills a room with the given amount of members, then runs a storm of membership lookups and of members leaving and
+ * joining again, as after a chat server restart, both against the room info and against the previous approach of a
+ * plain member array. Checks that the room and the array agree on every lookup and end with the same members, and that
+ * duplicate members in topic data are dropped. Logs the time per operation of either approach.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST CHATROOMMEMBERS [MemberCount] [OperationCount]
+ */
+class FExecTestChatRoomMembers : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the chat room membership test.
+	 *
+	 * @param InMemberCount Amount of members in the room
+	 * @param InOperationCount Amount of lookups, and of leave and join pairs, timed for each approach
+	 */
+	FExecTestChatRoomMembers(UWorld* InWorld, const FName& InSubsystemName, int32 InMemberCount, int32 InOperationCount);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("CHATROOMMEMBERS");
+	}
+
+private:
+
+	/** Amount of members in the room */
+	int32 MemberCount;
+
+	/** Amount of lookups, and of leave and join pairs, timed for each approach */
+	int32 OperationCount;
+
+};
+
+#endif
@@ -0,0 +1,105 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestChatSenderStorm.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineChatInterfaceAccelByte.h"
+
+FExecTestChatSenderStorm::FExecTestChatSenderStorm(UWorld* InWorld, const FName& InSubsystemName, int32 InMessageCount, int32 InSenderCount)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, MessageCount(InMessageCount)
+	, SenderCount(InSenderCount)
+{
+}
+
+bool FExecTestChatSenderStorm::Run()
+{
+	if (MessageCount <= 0 || SenderCount <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestChatSenderStorm, message count %d and sender count %d must be positive"), MessageCount, SenderCount);
+		return CompleteTest(false);
+	}
+
+	TArray<FString> SenderIds;
+	SenderIds.Reserve(SenderCount);
+	for (int32 Index = 0; Index < SenderCount; Index++)
+	{
+		SenderIds.Add(FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower());
+	}
+
+	// Skew the storm towards the first senders, the way a few players carry most of a global channel
+	FRandomStream Stream(SenderCount);
+	TArray<FAccelByteModelsChatNotif> Notifications;
+	Notifications.Reserve(MessageCount);
+	for (int32 Index = 0; Index < MessageCount; Index++)
+	{
+		const float Skewed = FMath::Square(Stream.GetFraction());
+		FAccelByteModelsChatNotif& Notification = Notifications.AddDefaulted_GetRef();
+		Notification.From = SenderIds[FMath::Min(static_cast<int32>(Skewed * SenderCount), SenderCount - 1)];
+		Notification.TopicId = TEXT("g.0123456789abcdef0123456789abcdef");
+		Notification.Message = FString::Printf(TEXT("Message %d"), Index);
+		Notification.CreatedAt = FDateTime::UtcNow();
+	}
+
+	// Standalone chat interface, so that the storm does not end up in the cache of a logged in user
+	const TSharedRef<FOnlineChatAccelByte, ESPMode::ThreadSafe> ChatInterface = MakeShared<FOnlineChatAccelByte, ESPMode::ThreadSafe>(nullptr);
+
+	// Nickname of the first sender is known, as if their user info had already been queried
+	FAccelByteUserInfoRef KnownUser = MakeShared<FAccelByteUserInfo, ESPMode::ThreadSafe>();
+	KnownUser->Id = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(SenderIds[0]));
+	KnownUser->DisplayName = TEXT("KnownSender");
+	ChatInterface->AddChatRoomMembers({ KnownUser });
+
+	TArray<TSharedRef<FAccelByteChatMessage>> Messages;
+	Messages.Reserve(MessageCount);
+	const double StartSeconds = FPlatformTime::Seconds();
+	for (const FAccelByteModelsChatNotif& Notification : Notifications)
+	{
+		Messages.Add(ChatInterface->CreateChatMessage(Notification));
+	}
+	const double InternedSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	// Previous approach, a new sender ID built for every message next to the member lookup
+	TArray<TSharedRef<FAccelByteChatMessage>> ReferenceMessages;
+	ReferenceMessages.Reserve(MessageCount);
+	const double ReferenceStartSeconds = FPlatformTime::Seconds();
+	for (const FAccelByteModelsChatNotif& Notification : Notifications)
+	{
+		FAccelByteUniqueIdComposite SenderCompositeId;
+		SenderCompositeId.Id = Notification.From;
+		const FUniqueNetIdAccelByteUserRef SenderUserId = FUniqueNetIdAccelByteUser::Create(SenderCompositeId);
+		const FAccelByteChatRoomMemberRef Member = ChatInterface->GetAccelByteChatRoomMember(Notification.From);
+		ReferenceMessages.Add(MakeShared<FAccelByteChatMessage>(SenderUserId, Member->GetNickname(), Notification.Message, Notification.CreatedAt));
+	}
+	const double ReferenceSeconds = FPlatformTime::Seconds() - ReferenceStartSeconds;
+
+	TMap<FString, const FUniqueNetId*> SenderIdToSharedId;
+	bool bSharedPassed = true;
+	bool bSenderPassed = true;
+	bool bNicknamePassed = true;
+	for (int32 Index = 0; Index < Messages.Num(); Index++)
+	{
+		const FAccelByteChatMessage& Message = Messages[Index].Get();
+		const FUniqueNetId*& SharedId = SenderIdToSharedId.FindOrAdd(Notifications[Index].From, &Message.GetUserId().Get());
+		bSharedPassed &= SharedId == &Message.GetUserId().Get();
+		bSenderPassed &= Message.GetUserId().Get() == ReferenceMessages[Index]->GetUserId().Get();
+		bNicknamePassed &= Message.GetNickname() == ReferenceMessages[Index]->GetNickname()
+			&& (Notifications[Index].From != SenderIds[0] || Message.GetNickname() == KnownUser->DisplayName);
+	}
+
+	UE_LOG_AB(Log, TEXT("[%s] %d messages from %d senders: %.3f us per message, previous %.3f us per message building an ID for each"), GetResultTag()
+		, MessageCount
+		, SenderIdToSharedId.Num()
+		, InternedSeconds * 1000000.0 / MessageCount
+		, ReferenceSeconds * 1000000.0 / MessageCount);
+
+	Check(TEXT("Shared sender IDs"), bSharedPassed);
+	Check(TEXT("Matching sender"), bSenderPassed);
+	Check(TEXT("Cached nickname"), bNicknamePassed);
+	return CompleteTest();
+}
+
+#endif
@@ -0,0 +1,54 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Benchmark for turning received chat notifications into chat messages, as on a busy global channel where a handful of
+ * senders make up most of the messages.
+ *
+ * Runs a synthetic storm of notifications from the given amount of senders through a standalone chat interface, and
+ * times it against the previous approach of building a new sender ID for every message. Checks that messages of the
+ * same sender share a single ID, that the ID matches the sender, and that the nickname of the cached member is used.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST CHATSENDERSTORM [MessageCount] [SenderCount]
+ */
+class FExecTestChatSenderStorm : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the chat sender storm benchmark.
+	 *
+	 * @param InMessageCount Amount of notifications in the storm
+	 * @param InSenderCount Amount of distinct senders the notifications come from
+	 */
+	FExecTestChatSenderStorm(UWorld* InWorld, const FName& InSubsystemName, int32 InMessageCount, int32 InSenderCount);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("CHATSENDERSTORM");
+	}
+
+private:
+
+	/** Amount of notifications in the storm */
+	int32 MessageCount;
+
+	/** Amount of distinct senders the notifications come from */
+	int32 SenderCount;
+
+};
+
+#endif
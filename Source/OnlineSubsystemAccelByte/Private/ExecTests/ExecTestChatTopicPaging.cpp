@@ -0,0 +1,499 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestChatTopicPaging.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSubsystemUtils.h"
+#include "OnlineChatInterfaceAccelByte.h"
+#include "Utilities/AccelBytePagedQuery.h"
+#include "Async/Async.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+
+/** Index of the page that the fake endpoint fails in the failure run */
+#define CHAT_TOPIC_PAGING_TEST_FAIL_PAGE_INDEX 2
+
+/** Time on top of the expected length of every run after which the test fails */
+#define CHAT_TOPIC_PAGING_TEST_TIMEOUT_SLACK_SECONDS 30.0f
+
+/** Latency of a page, spread between half and one and a half times the average so that responses arrive out of order */
+static double GetChatTopicPageLatency(double LatencySeconds, int32 PageIndex)
+{
+	return LatencySeconds * (0.5 + ((PageIndex * 7919) % 101) / 100.0);
+}
+
+/** Topic at the given index of the ones served to the test */
+static FAccelByteModelsChatTopicQueryData MakeChatTopicPagingTopic(int32 Index)
+{
+	FAccelByteModelsChatTopicQueryData Topic;
+	Topic.TopicId = FString::Printf(TEXT("g.%032x"), Index);
+	Topic.Name = FString::Printf(TEXT("Topic %d"), Index);
+	Topic.Members.Add(FString::Printf(TEXT("%032x"), Index));
+	return Topic;
+}
+
+/**
+ * Fake chat endpoint for a single run, sending a page answers it from its own thread after the injected latency.
+ * Shared with the response threads, so it stays alive until the last response has been handled.
+ */
+struct FFakeChatTopicEndpoint : public TSharedFromThis<FFakeChatTopicEndpoint, ESPMode::ThreadSafe>
+{
+	FAccelBytePagedQuery Query;
+
+	/** Amount of topics that the endpoint serves */
+	int32 TopicCount = 0;
+
+	/** Average latency of a single page */
+	double LatencySeconds = 0.0;
+
+	/** Index of the page to fail, or INDEX_NONE */
+	int32 FailPageIndex = INDEX_NONE;
+
+	/** Called on the game thread once the last response has been handled */
+	TFunction<void()> OnAllResponsesHandled;
+
+	/** Stands in for the topic cache of the chat interface, filled as each page comes back */
+	FCriticalSection CacheLock;
+	TMap<FString, FAccelByteChatRoomInfoRef> TopicIdToChatRoomInfo;
+	int32 DuplicateTopicCount = 0;
+	double FirstPageTime = 0.0;
+	/** Time at which every page had come back, or at which the first page failed */
+	double DoneTime = 0.0;
+	FThreadSafeBool bFirstPageCached = false;
+
+	FThreadSafeCounter SentAfterFailureCount;
+	FThreadSafeCounter OutstandingResponseCount;
+	FThreadSafeCounter FinishedCount;
+	FThreadSafeCounter FailureReportCount;
+
+	/** Highest amount of pages seen in flight when sending a page, and whether a page was sent alongside the first */
+	FCriticalSection InFlightLock;
+	int32 MaxInFlight = 0;
+	bool bFirstPageSentAlone = true;
+
+	FFakeChatTopicEndpoint(int32 InTopicCount, int32 PageSize, int32 PagesInFlight, double InLatencySeconds, int32 InFailPageIndex)
+		: Query(PageSize, PagesInFlight)
+		, TopicCount(InTopicCount)
+		, LatencySeconds(InLatencySeconds)
+		, FailPageIndex(InFailPageIndex)
+	{
+	}
+
+	void SendPendingPages()
+	{
+		TSharedRef<FFakeChatTopicEndpoint, ESPMode::ThreadSafe> Self = AsShared();
+		Query.SendPendingPages([Self](int32 PageIndex, int32 Offset, int32 Limit)
+		{
+			Self->SendPage(PageIndex, Offset, Limit);
+		});
+	}
+
+	void SendPage(int32 PageIndex, int32 Offset, int32 Limit)
+	{
+		{
+			FScopeLock Lock(&InFlightLock);
+			MaxInFlight = FMath::Max(MaxInFlight, Query.GetPagesInFlight());
+			if (PageIndex > 0 && !bFirstPageCached)
+			{
+				bFirstPageSentAlone = false;
+			}
+		}
+
+		const double PageLatencySeconds = GetChatTopicPageLatency(LatencySeconds, PageIndex);
+
+		OutstandingResponseCount.Increment();
+		TSharedRef<FFakeChatTopicEndpoint, ESPMode::ThreadSafe> Self = AsShared();
+		Async(EAsyncExecution::Thread, [Self, PageIndex, Offset, Limit, PageLatencySeconds]()
+		{
+			FPlatformProcess::Sleep(static_cast<float>(PageLatencySeconds));
+			Self->OnResponse(PageIndex, Offset, Limit);
+
+			// Every response sends its following pages before getting here, so nothing is left to come once this is zero
+			if (Self->OutstandingResponseCount.Decrement() == 0)
+			{
+				AsyncTask(ENamedThreads::GameThread, [Self]()
+				{
+					Self->OnAllResponsesHandled();
+				});
+			}
+		});
+	}
+
+	void OnResponse(int32 PageIndex, int32 Offset, int32 Limit)
+	{
+		if (PageIndex == FailPageIndex)
+		{
+			if (Query.Fail())
+			{
+				FailureReportCount.Increment();
+				FScopeLock Lock(&CacheLock);
+				DoneTime = FPlatformTime::Seconds();
+			}
+
+			// A failed query must not send any more pages
+			SentAfterFailureCount.Add(Query.SendPendingPages([](int32, int32, int32) {}));
+			return;
+		}
+
+		const int32 End = FMath::Min(Offset + Limit, TopicCount);
+		{
+			FScopeLock Lock(&CacheLock);
+			for (int32 Index = Offset; Index < End; Index++)
+			{
+				const FAccelByteModelsChatTopicQueryData Topic = MakeChatTopicPagingTopic(Index);
+				if (TopicIdToChatRoomInfo.Contains(Topic.TopicId))
+				{
+					DuplicateTopicCount++;
+					continue;
+				}
+
+				FAccelByteChatRoomInfoRef RoomInfo = FAccelByteChatRoomInfo::Create();
+				RoomInfo->SetTopicData(Topic);
+				TopicIdToChatRoomInfo.Add(Topic.TopicId, RoomInfo);
+			}
+
+			if (PageIndex == 0)
+			{
+				FirstPageTime = FPlatformTime::Seconds();
+				bFirstPageCached = true;
+			}
+		}
+
+		if (Query.CompletePage(PageIndex, FMath::Max(End - Offset, 0)))
+		{
+			FinishedCount.Increment();
+			FScopeLock Lock(&CacheLock);
+			DoneTime = FPlatformTime::Seconds();
+			return;
+		}
+
+		SendPendingPages();
+	}
+};
+
+/**
+ * Chat interface with the query room task of every topic page replaced by an answer on the game thread once the latency
+ * has passed, the way the delegate of the task would run. Everything here runs on the game thread.
+ */
+class FChatTopicPagingStandIn : public FOnlineChatAccelByte
+{
+public:
+	FChatTopicPagingStandIn(FOnlineSubsystemAccelByte* InSubsystem, int32 InTopicCount, int32 InPageSize, int32 InPagesInFlight, double InLatencySeconds)
+		: FOnlineChatAccelByte(InSubsystem)
+		, TopicCount(InTopicCount)
+		, LatencySeconds(InLatencySeconds)
+	{
+		TopicQueryPageSize = InPageSize;
+		MaxTopicQueryPagesInFlight = InPagesInFlight;
+	}
+
+	using FOnlineChatAccelByte::StartTopicQuery;
+
+	/** Topic query that a local user is still paging through, if any */
+	TSharedPtr<FAccelBytePagedQuery, ESPMode::ThreadSafe> FindTopicQuery(int32 LocalUserNum) const
+	{
+		const TSharedRef<FAccelBytePagedQuery, ESPMode::ThreadSafe>* TopicQuery = LocalUserNumToTopicQuery.Find(LocalUserNum);
+		return (TopicQuery != nullptr) ? TSharedPtr<FAccelBytePagedQuery, ESPMode::ThreadSafe>(*TopicQuery) : nullptr;
+	}
+
+	int32 GetSentPageCount(const TSharedPtr<FAccelBytePagedQuery, ESPMode::ThreadSafe>& TopicQuery) const
+	{
+		const int32* SentPageCount = SentPageCounts.Find(TopicQuery.Get());
+		return (SentPageCount != nullptr) ? *SentPageCount : 0;
+	}
+
+	int32 GetSentAfterShortPageCount() const
+	{
+		return SentAfterShortPageCount;
+	}
+
+	/** Called once the last page in flight has been answered */
+	TFunction<void()> OnAllResponsesHandled;
+
+protected:
+	virtual void SendTopicQueryPage(int32 LocalUserNum, const FUniqueNetIdRef& LocalUserId, int32 PageIndex, int32 Offset, int32 Limit, const TSharedRef<FAccelBytePagedQuery, ESPMode::ThreadSafe>& TopicQuery) override
+	{
+		SentPageCounts.FindOrAdd(&TopicQuery.Get())++;
+		if (bShortPageAnswered)
+		{
+			SentAfterShortPageCount++;
+		}
+		OutstandingResponseCount++;
+
+		const TSharedRef<FChatTopicPagingStandIn, ESPMode::ThreadSafe> Self = StaticCastSharedRef<FChatTopicPagingStandIn>(AsShared());
+		FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Self, LocalUserNum, LocalUserId, PageIndex, Offset, Limit, TopicQuery](float DeltaTime)
+		{
+			Self->AnswerPage(LocalUserNum, LocalUserId, PageIndex, Offset, Limit, TopicQuery);
+			return false;
+		}), static_cast<float>(GetChatTopicPageLatency(LatencySeconds, PageIndex)));
+	}
+
+private:
+	void AnswerPage(int32 LocalUserNum, const FUniqueNetIdRef& LocalUserId, int32 PageIndex, int32 Offset, int32 Limit, const TSharedRef<FAccelBytePagedQuery, ESPMode::ThreadSafe>& TopicQuery)
+	{
+		TArray<FAccelByteChatRoomInfoRef> RoomList;
+		for (int32 Index = Offset; Index < FMath::Min(Offset + Limit, TopicCount); Index++)
+		{
+			FAccelByteChatRoomInfoRef RoomInfo = FAccelByteChatRoomInfo::Create();
+			RoomInfo->SetTopicData(MakeChatTopicPagingTopic(Index));
+
+			// Cached before the delegate runs, as the query room task does
+			AddTopic(RoomInfo);
+			RoomList.Add(RoomInfo);
+		}
+
+		if (RoomList.Num() < Limit)
+		{
+			bShortPageAnswered = true;
+		}
+
+		OnQueryChatRoomInfoComplete(true, RoomList, LocalUserNum, LocalUserId, PageIndex, TopicQuery);
+
+		OutstandingResponseCount--;
+		if (OutstandingResponseCount == 0 && OnAllResponsesHandled)
+		{
+			OnAllResponsesHandled();
+		}
+	}
+
+	/** Amount of topics served */
+	int32 TopicCount = 0;
+
+	/** Average latency of a single page */
+	double LatencySeconds = 0.0;
+
+	/** Amount of pages sent by each topic query */
+	TMap<const FAccelBytePagedQuery*, int32> SentPageCounts;
+
+	int32 OutstandingResponseCount = 0;
+
+	/** Whether a page has come back with fewer topics than requested, marking the end */
+	bool bShortPageAnswered = false;
+
+	/** Pages sent after the end was known, which must not happen */
+	int32 SentAfterShortPageCount = 0;
+};
+
+FExecTestChatTopicPaging::FExecTestChatTopicPaging(UWorld* InWorld, const FName& InSubsystemName, int32 InTopicCount, int32 InPageSize, int32 InMaxPagesInFlight, int32 InLatencyMilliseconds)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, TopicCount(InTopicCount)
+	, PageSize(InPageSize)
+	, MaxPagesInFlight(InMaxPagesInFlight)
+	, LatencyMilliseconds(InLatencyMilliseconds)
+{
+}
+
+bool FExecTestChatTopicPaging::Run()
+{
+	// Pages hold at least two topics, so that the chat interface run can end on a short page
+	if (PageSize < 2 || TopicCount <= PageSize * CHAT_TOPIC_PAGING_TEST_FAIL_PAGE_INDEX || MaxPagesInFlight <= 0 || LatencyMilliseconds < 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestChatTopicPaging, page size %d must be at least 2, max pages in flight %d must be positive, topic count %d must be above %d and latency %d must not be negative")
+			, PageSize, MaxPagesInFlight, TopicCount, PageSize * CHAT_TOPIC_PAGING_TEST_FAIL_PAGE_INDEX, LatencyMilliseconds);
+		return CompleteTest(false);
+	}
+
+	Subsystem = static_cast<FOnlineSubsystemAccelByte*>(::Online::GetSubsystem(World, SubsystemName));
+	if (Subsystem == nullptr)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestChatTopicPaging, subsystem is invalid"));
+		return CompleteTest(false);
+	}
+
+	Runs.Add({ false, 1, INDEX_NONE });
+	Runs.Add({ false, MaxPagesInFlight, INDEX_NONE });
+	Runs.Add({ false, MaxPagesInFlight, CHAT_TOPIC_PAGING_TEST_FAIL_PAGE_INDEX });
+	Runs.Add({ true, MaxPagesInFlight, INDEX_NONE });
+
+	KeepAlive = AsShared();
+
+	// Worst case for a run is every page, plus the page past the end, sent one after the other at the highest latency
+	const int32 PageCount = (TopicCount / PageSize) + 2;
+	const float TimeoutSeconds = Runs.Num() * PageCount * LatencyMilliseconds * 1.5f / 1000.0f + CHAT_TOPIC_PAGING_TEST_TIMEOUT_SLACK_SECONDS;
+	TimeoutHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FExecTestChatTopicPaging::OnTimeout), TimeoutSeconds);
+
+	StartNextRun();
+	return true;
+}
+
+void FExecTestChatTopicPaging::StartNextRun()
+{
+	CurrentRunIndex++;
+	if (bIsComplete || CurrentRunIndex >= Runs.Num())
+	{
+		Finish();
+		return;
+	}
+
+	RunStartTimeInSeconds = FPlatformTime::Seconds();
+	if (Runs[CurrentRunIndex].bThroughChatInterface)
+	{
+		StartChatInterfaceRun();
+	}
+	else
+	{
+		StartEndpointRun(Runs[CurrentRunIndex]);
+	}
+}
+
+void FExecTestChatTopicPaging::StartEndpointRun(const FPagingRun& PagingRun)
+{
+	Endpoint = MakeShared<FFakeChatTopicEndpoint, ESPMode::ThreadSafe>(TopicCount, PageSize, PagingRun.PagesInFlight, LatencyMilliseconds / 1000.0, PagingRun.FailPageIndex);
+
+	const TWeakPtr<FExecTestChatTopicPaging> WeakThis = AsShared();
+	Endpoint->OnAllResponsesHandled = [WeakThis]()
+	{
+		const TSharedPtr<FExecTestChatTopicPaging> PinnedThis = WeakThis.Pin();
+		if (PinnedThis.IsValid())
+		{
+			PinnedThis->OnEndpointRunComplete();
+		}
+	};
+
+	Endpoint->SendPendingPages();
+}
+
+void FExecTestChatTopicPaging::StartChatInterfaceRun()
+{
+	// Standalone chat interface, so that the topics served here never end up in the cache of a logged in user
+	ChatInterface = MakeShared<FChatTopicPagingStandIn, ESPMode::ThreadSafe>(Subsystem, GetChatInterfaceTopicCount(), PageSize, MaxPagesInFlight, LatencyMilliseconds / 1000.0);
+
+	const TWeakPtr<FExecTestChatTopicPaging> WeakThis = AsShared();
+	ChatInterface->OnAllResponsesHandled = [WeakThis]()
+	{
+		const TSharedPtr<FExecTestChatTopicPaging> PinnedThis = WeakThis.Pin();
+		if (PinnedThis.IsValid())
+		{
+			PinnedThis->OnChatInterfaceRunComplete();
+		}
+	};
+
+	// Connecting twice in a row, so that the second query replaces the first before its first page has come back
+	const FUniqueNetIdRef LocalUserId = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower()));
+	ChatInterface->StartTopicQuery(TEST_USER_INDEX, LocalUserId);
+	StaleTopicQuery = ChatInterface->FindTopicQuery(TEST_USER_INDEX);
+	ChatInterface->StartTopicQuery(TEST_USER_INDEX, LocalUserId);
+	CurrentTopicQuery = ChatInterface->FindTopicQuery(TEST_USER_INDEX);
+}
+
+void FExecTestChatTopicPaging::OnEndpointRunComplete()
+{
+	if (!Runs.IsValidIndex(CurrentRunIndex) || !Endpoint.IsValid())
+	{
+		return;
+	}
+
+	FPagingRun& PagingRun = Runs[CurrentRunIndex];
+	{
+		FScopeLock Lock(&Endpoint->CacheLock);
+		PagingRun.Seconds = ((Endpoint->DoneTime > 0.0) ? Endpoint->DoneTime : FPlatformTime::Seconds()) - RunStartTimeInSeconds;
+		PagingRun.FirstPageSeconds = (Endpoint->FirstPageTime > 0.0) ? Endpoint->FirstPageTime - RunStartTimeInSeconds : 0.0;
+	}
+
+	{
+		FScopeLock Lock(&Endpoint->InFlightLock);
+		Check(FString::Printf(TEXT("Query had %d page(s) in flight at most with a limit of %d, first page sent alone"), Endpoint->MaxInFlight, PagingRun.PagesInFlight)
+			, Endpoint->MaxInFlight <= PagingRun.PagesInFlight && Endpoint->bFirstPageSentAlone);
+	}
+
+	if (PagingRun.FailPageIndex != INDEX_NONE)
+	{
+		Check(FString::Printf(TEXT("Failing page %d was reported %d time(s), finished %d time(s) and sent %d page(s) after failing")
+			, PagingRun.FailPageIndex, Endpoint->FailureReportCount.GetValue(), Endpoint->FinishedCount.GetValue(), Endpoint->SentAfterFailureCount.GetValue())
+			, Endpoint->FailureReportCount.GetValue() == 1 && Endpoint->FinishedCount.GetValue() == 0 && Endpoint->SentAfterFailureCount.GetValue() == 0);
+	}
+	else
+	{
+		FScopeLock Lock(&Endpoint->CacheLock);
+		Check(FString::Printf(TEXT("Query with %d page(s) in flight finished %d time(s), failed %d time(s) and cached %d of %d topics with %d duplicate(s)")
+			, PagingRun.PagesInFlight, Endpoint->FinishedCount.GetValue(), Endpoint->FailureReportCount.GetValue()
+			, Endpoint->TopicIdToChatRoomInfo.Num(), TopicCount, Endpoint->DuplicateTopicCount)
+			, Endpoint->FinishedCount.GetValue() == 1 && Endpoint->FailureReportCount.GetValue() == 0
+				&& Endpoint->TopicIdToChatRoomInfo.Num() == TopicCount && Endpoint->DuplicateTopicCount == 0
+				&& Endpoint->Query.GetItemCount() == TopicCount);
+	}
+
+	Endpoint.Reset();
+	StartNextRun();
+}
+
+void FExecTestChatTopicPaging::OnChatInterfaceRunComplete()
+{
+	if (!Runs.IsValidIndex(CurrentRunIndex) || !ChatInterface.IsValid() || !StaleTopicQuery.IsValid() || !CurrentTopicQuery.IsValid())
+	{
+		return;
+	}
+
+	FPagingRun& PagingRun = Runs[CurrentRunIndex];
+	PagingRun.Seconds = FPlatformTime::Seconds() - RunStartTimeInSeconds;
+
+	const int32 ChatTopicCount = GetChatInterfaceTopicCount();
+	const int32 PageCount = FMath::DivideAndRoundUp(ChatTopicCount, PageSize);
+	const int32 StaleSentPageCount = ChatInterface->GetSentPageCount(StaleTopicQuery);
+	const int32 CurrentSentPageCount = ChatInterface->GetSentPageCount(CurrentTopicQuery);
+
+	// The first page of the replaced query came back full, so it would have sent more pages had it not been ignored
+	Check(FString::Printf(TEXT("Replaced topic query sent %d page(s) and counted %d topics, expected its first page only"), StaleSentPageCount, StaleTopicQuery->GetItemCount())
+		, StaleSentPageCount == 1 && StaleTopicQuery->GetItemCount() == 0 && !StaleTopicQuery->IsComplete());
+	Check(FString::Printf(TEXT("Current topic query completed with %d of %d topics"), CurrentTopicQuery->GetItemCount(), ChatTopicCount)
+		, CurrentTopicQuery->IsComplete() && !CurrentTopicQuery->HasFailed() && CurrentTopicQuery->GetItemCount() == ChatTopicCount);
+	Check(TEXT("Completed topic query was dropped by the chat interface"), !ChatInterface->FindTopicQuery(TEST_USER_INDEX).IsValid());
+	Check(FString::Printf(TEXT("Current topic query sent %d pages for %d topics ending in a short page, %d after the end was known"), CurrentSentPageCount, ChatTopicCount, ChatInterface->GetSentAfterShortPageCount())
+		, CurrentSentPageCount >= PageCount && CurrentSentPageCount < PageCount + PagingRun.PagesInFlight && ChatInterface->GetSentAfterShortPageCount() == 0);
+
+	ChatInterface.Reset();
+	StaleTopicQuery.Reset();
+	CurrentTopicQuery.Reset();
+	StartNextRun();
+}
+
+int32 FExecTestChatTopicPaging::GetChatInterfaceTopicCount() const
+{
+	return (TopicCount % PageSize != 0) ? TopicCount : TopicCount - 1;
+}
+
+void FExecTestChatTopicPaging::Finish()
+{
+	if (TimeoutHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(TimeoutHandle);
+		TimeoutHandle.Reset();
+	}
+
+	if (!bIsComplete)
+	{
+		UE_LOG_AB(Log, TEXT("[%s] %d topics, %d per page: one page in flight %.1f ms to first page and %.1f ms to all, %d pages in flight %.1f ms to first page and %.1f ms to all, failing page %d after %.1f ms, through the chat interface %.1f ms")
+			, GetResultTag()
+			, TopicCount
+			, PageSize
+			, Runs[0].FirstPageSeconds * 1000.0
+			, Runs[0].Seconds * 1000.0
+			, MaxPagesInFlight
+			, Runs[1].FirstPageSeconds * 1000.0
+			, Runs[1].Seconds * 1000.0
+			, CHAT_TOPIC_PAGING_TEST_FAIL_PAGE_INDEX
+			, Runs[2].Seconds * 1000.0
+			, Runs[3].Seconds * 1000.0);
+		CompleteTest();
+	}
+
+	KeepAlive.Reset();
+}
+
+bool FExecTestChatTopicPaging::OnTimeout(float DeltaTime)
+{
+	TimeoutHandle.Reset();
+
+	// The run in progress may still finish after this, this test stays alive until it has
+	Check(FString::Printf(TEXT("Runs finished in time, %d of %d done"), CurrentRunIndex, Runs.Num()), false);
+	CompleteTest();
+	return false;
+}
+
+#undef CHAT_TOPIC_PAGING_TEST_FAIL_PAGE_INDEX
+#undef CHAT_TOPIC_PAGING_TEST_TIMEOUT_SLACK_SECONDS
+
+#endif
@@ -0,0 +1,140 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Core/AccelByteDefines.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class FOnlineSubsystemAccelByte;
+struct FFakeChatTopicEndpoint;
+class FChatTopicPagingStandIn;
+class FAccelBytePagedQuery;
+
+/**
+ * Test for the paged topic query sent after connecting to chat.
+ *
+ * The first runs go against a local fake chat endpoint that answers each page on its own thread after an injected
+ * latency. Latency varies per page, so responses arrive out of order. The topics are queried with one page in flight
+ * and then with the given in flight limit, adding each page to a topic cache as it comes back. Both runs check that the
+ * first page is sent on its own, that the in flight limit is respected and that every topic is cached exactly once, and
+ * log the time to the first page and to the last one. A third run fails one page, and checks that the failure is only
+ * reported once and that no pages are sent after it.
+ *
+ * The last run goes through a standalone chat interface, with only the dispatch of each page answered on the game
+ * thread by a stand-in. It starts a topic query and replaces it with a new one before the first page has come back, as
+ * a new connection does, and serves a topic count that ends in a short page. It checks that the replaced query sends
+ * nothing past its first page, that the new query caches every topic and is dropped once done, and that nothing is sent
+ * after the short final page.
+ *
+ * Runs are made one after the other without blocking the game thread. Completes once the last run is done, or fails
+ * once the timeout passes.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST CHATTOPICPAGING [TopicCount] [PageSize] [MaxPagesInFlight] [LatencyMilliseconds]
+ */
+class FExecTestChatTopicPaging : public FExecTestBase, public TSharedFromThis<FExecTestChatTopicPaging>
+{
+public:
+
+	/**
+	 * Constructs an instance of the chat topic paging test.
+	 *
+	 * @param InTopicCount Amount of topics served by the fake endpoint
+	 * @param InPageSize Amount of topics requested per page
+	 * @param InMaxPagesInFlight In flight limit of the paged runs
+	 * @param InLatencyMilliseconds Average latency of a single page
+	 */
+	FExecTestChatTopicPaging(UWorld* InWorld, const FName& InSubsystemName, int32 InTopicCount, int32 InPageSize, int32 InMaxPagesInFlight, int32 InLatencyMilliseconds);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("CHATTOPICPAGING");
+	}
+
+private:
+
+	/** Settings and timings of a single run */
+	struct FPagingRun
+	{
+		/** Whether this run goes through the chat interface rather than the fake endpoint */
+		bool bThroughChatInterface = false;
+		int32 PagesInFlight = 1;
+		/** Index of a page that the fake endpoint fails, or INDEX_NONE to succeed every page */
+		int32 FailPageIndex = INDEX_NONE;
+		double FirstPageSeconds = 0.0;
+		double Seconds = 0.0;
+	};
+
+	/** Amount of topics served by the fake endpoint */
+	int32 TopicCount;
+
+	/** Amount of topics requested per page */
+	int32 PageSize;
+
+	/** In flight limit of the paged runs */
+	int32 MaxPagesInFlight;
+
+	/** Average latency of a single page */
+	int32 LatencyMilliseconds;
+
+	FOnlineSubsystemAccelByte* Subsystem = nullptr;
+
+	/** Every run in the order they are made, one after the other */
+	TArray<FPagingRun> Runs;
+
+	/** Index of the run in progress */
+	int32 CurrentRunIndex = INDEX_NONE;
+
+	double RunStartTimeInSeconds = 0.0;
+
+	/** Fake endpoint of the run in progress, if it goes against one */
+	TSharedPtr<FFakeChatTopicEndpoint, ESPMode::ThreadSafe> Endpoint;
+
+	/** Standalone chat interface of the run in progress, if it goes through one */
+	TSharedPtr<FChatTopicPagingStandIn, ESPMode::ThreadSafe> ChatInterface;
+
+	/** Topic query of the chat interface run that gets replaced before its first page comes back */
+	TSharedPtr<FAccelBytePagedQuery, ESPMode::ThreadSafe> StaleTopicQuery;
+
+	/** Topic query of the chat interface run that replaces the stale one */
+	TSharedPtr<FAccelBytePagedQuery, ESPMode::ThreadSafe> CurrentTopicQuery;
+
+	/** Keeps this test alive until the last run is done, even if it timed out first */
+	TSharedPtr<FExecTestChatTopicPaging> KeepAlive;
+
+	FDelegateHandleAlias TimeoutHandle;
+
+	/** Start the next run, or finish once every run is done */
+	void StartNextRun();
+
+	void StartEndpointRun(const FPagingRun& PagingRun);
+
+	void StartChatInterfaceRun();
+
+	/** Check the run against the fake endpoint that just finished, and move on to the next one */
+	void OnEndpointRunComplete();
+
+	/** Check the run through the chat interface that just finished, and move on to the next one */
+	void OnChatInterfaceRunComplete();
+
+	/** Amount of topics served in the chat interface run, chosen so that the last page comes back short */
+	int32 GetChatInterfaceTopicCount() const;
+
+	/** Log the timings once every run is done */
+	void Finish();
+
+	bool OnTimeout(float DeltaTime);
+
+};
+
+#endif
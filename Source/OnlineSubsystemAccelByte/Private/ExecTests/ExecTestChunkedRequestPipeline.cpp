@@ -0,0 +1,337 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestChunkedRequestPipeline.h"
+#include "OnlineSubsystemUtils.h"
+#include "OnlineIdentityInterfaceAccelByte.h"
+#include "AsyncTasks/User/OnlineAsyncTaskAccelByteQueryUserProfile.h"
+#include "AsyncTasks/User/OnlineAsyncTaskAccelByteQueryUsersByIds.h"
+#include "Async/Async.h"
+
+/** Amount of IDs at the end of the first profile chunk that the stand-in reports as not processed, once */
+#define CHUNK_PIPELINE_TEST_RETRY_COUNT 5
+
+/**
+ * Tolerance on the parallel to sequential time ratio, covering the frames that every response waits for on the game
+ * thread and the task manager ticks around each run
+ */
+#define CHUNK_PIPELINE_TEST_RATIO_TOLERANCE 1.5
+
+/** Time on top of the expected length of every run after which the test fails */
+#define CHUNK_PIPELINE_TEST_TIMEOUT_SLACK_SECONDS 30.0f
+
+/**
+ * Stand-in for the backend of a single run, answering each chunk request on the game thread once the latency has
+ * passed. Requests are made from the online thread as well as from earlier answers, so every counter is locked.
+ */
+struct FChunkPipelineStandInBackend : public TSharedFromThis<FChunkPipelineStandInBackend, ESPMode::ThreadSafe>
+{
+	explicit FChunkPipelineStandInBackend(double InLatencySeconds)
+		: LatencySeconds(InLatencySeconds)
+	{
+	}
+
+	/** Record a chunk request and run the response once the latency has passed */
+	void Answer(int32 ChunkSize, TFunction<void()>&& Respond)
+	{
+		{
+			FScopeLock Lock(&BackendLock);
+			ChunksInFlight++;
+			SentChunkCount++;
+			MaxChunksInFlightSeen = FMath::Max(MaxChunksInFlightSeen, ChunksInFlight);
+			MaxChunkSize = FMath::Max(MaxChunkSize, ChunkSize);
+		}
+
+		// The core ticker may only be touched from the game thread
+		TSharedRef<FChunkPipelineStandInBackend, ESPMode::ThreadSafe> Self = AsShared();
+		AsyncTask(ENamedThreads::GameThread, [Self, Respond = MoveTemp(Respond)]() mutable
+		{
+			FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Self, Respond = MoveTemp(Respond)](float DeltaTime)
+			{
+				// Out of flight before responding, as the response sends the next chunk straight away
+				{
+					FScopeLock Lock(&Self->BackendLock);
+					Self->ChunksInFlight--;
+				}
+
+				Respond();
+				return false;
+			}), static_cast<float>(Self->LatencySeconds));
+		});
+	}
+
+	/** Whether this is the first call, the profile stand-in reports IDs as not processed only once per run */
+	bool ShouldReportNotProcessed()
+	{
+		FScopeLock Lock(&BackendLock);
+		const bool bShouldReport = !bHasReportedNotProcessed;
+		bHasReportedNotProcessed = true;
+		return bShouldReport;
+	}
+
+	double LatencySeconds = 0.0;
+
+	int32 ChunksInFlight = 0;
+
+	int32 SentChunkCount = 0;
+
+	int32 MaxChunksInFlightSeen = 0;
+
+	int32 MaxChunkSize = 0;
+
+	bool bHasReportedNotProcessed = false;
+
+	FCriticalSection BackendLock;
+};
+
+/** QueryUserProfile task with its backend request answered by the stand-in, with no profiles so nothing gets cached */
+class FChunkPipelineTestQueryUserProfile : public FOnlineAsyncTaskAccelByteQueryUserProfile
+{
+public:
+	FChunkPipelineTestQueryUserProfile(FOnlineSubsystemAccelByte* const InABSubsystem, int32 InLocalUserNum, const TArray<FString>& InUserIds, const FOnQueryUserProfileComplete& InDelegate, const TSharedRef<FChunkPipelineStandInBackend, ESPMode::ThreadSafe>& InBackend)
+		: FOnlineAsyncTaskAccelByteQueryUserProfile(InABSubsystem, InLocalUserNum, InUserIds, InDelegate)
+		, Backend(InBackend)
+	{
+	}
+
+protected:
+	virtual void SendUserProfileRequest(const TArray<FString>& UserIds, const THandler<FAccelByteModelsPublicUserProfileInfoV2>& OnSuccess, const AccelByte::FErrorHandler& OnError) override
+	{
+		// Report the end of the first chunk as not processed, the way the endpoint does when it cannot get to every ID
+		FAccelByteModelsPublicUserProfileInfoV2 Response;
+		if (UserIds.Num() > CHUNK_PIPELINE_TEST_RETRY_COUNT && Backend->ShouldReportNotProcessed())
+		{
+			Response.NotProcessed.Append(UserIds.GetData() + UserIds.Num() - CHUNK_PIPELINE_TEST_RETRY_COUNT, CHUNK_PIPELINE_TEST_RETRY_COUNT);
+		}
+
+		Backend->Answer(UserIds.Num(), [OnSuccess, Response]()
+		{
+			OnSuccess.ExecuteIfBound(Response);
+		});
+	}
+
+private:
+	TSharedRef<FChunkPipelineStandInBackend, ESPMode::ThreadSafe> Backend;
+};
+
+/**
+ * QueryUsersByIds task with its basic user information request answered by the stand-in, with no users so that only the
+ * negative cache picks up the made up IDs
+ */
+class FChunkPipelineTestQueryUsersByIds : public FOnlineAsyncTaskAccelByteQueryUsersByIds
+{
+public:
+	FChunkPipelineTestQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, int32 InLocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& InDelegate, const TSharedRef<FChunkPipelineStandInBackend, ESPMode::ThreadSafe>& InBackend)
+		: FOnlineAsyncTaskAccelByteQueryUsersByIds(InABSubsystem, InLocalUserNum, AccelByteIds, false, InDelegate)
+		, Backend(InBackend)
+	{
+	}
+
+protected:
+	virtual void SendBasicUserInfoRequest(const FPlatformAccountInfoRequest& Request, const THandler<FAccountUserPlatformInfosResponse>& OnSuccess, const AccelByte::FErrorHandler& OnError) override
+	{
+		Backend->Answer(Request.UserIds.Num(), [OnSuccess]()
+		{
+			OnSuccess.ExecuteIfBound(FAccountUserPlatformInfosResponse());
+		});
+	}
+
+private:
+	TSharedRef<FChunkPipelineStandInBackend, ESPMode::ThreadSafe> Backend;
+};
+
+FExecTestChunkedRequestPipeline::FExecTestChunkedRequestPipeline(UWorld* InWorld, const FName& InSubsystemName, int32 InIdCount, int32 InLatencyMilliseconds, int32 InMaxChunksInFlight)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, IdCount(InIdCount)
+	, LatencyMilliseconds(InLatencyMilliseconds)
+	, MaxChunksInFlight(InMaxChunksInFlight)
+{
+}
+
+bool FExecTestChunkedRequestPipeline::Run()
+{
+	if (IdCount <= CHUNK_PIPELINE_TEST_RETRY_COUNT || LatencyMilliseconds <= 0 || MaxChunksInFlight < 2)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestChunkedRequestPipeline, ID count %d must be above %d, latency %d must be positive and max chunks in flight %d must be at least 2")
+			, IdCount, CHUNK_PIPELINE_TEST_RETRY_COUNT, LatencyMilliseconds, MaxChunksInFlight);
+		return CompleteTest(false);
+	}
+
+	Subsystem = static_cast<FOnlineSubsystemAccelByte*>(::Online::GetSubsystem(World, SubsystemName));
+	UserCache = (Subsystem != nullptr) ? Subsystem->GetUserCache() : nullptr;
+	const FOnlineIdentityAccelBytePtr IdentityInterface = (Subsystem != nullptr) ? StaticCastSharedPtr<FOnlineIdentityAccelByte>(Subsystem->GetIdentityInterface()) : nullptr;
+	if (!UserCache.IsValid() || !IdentityInterface.IsValid() || IdentityInterface->GetLoginStatus(TEST_USER_INDEX) != ELoginStatus::LoggedIn)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestChunkedRequestPipeline, a user must be logged in at index %d"), TEST_USER_INDEX);
+		return CompleteTest(false);
+	}
+
+	for (const EQuery Query : { EQuery::UserProfile, EQuery::UsersByIds })
+	{
+		for (const int32 ChunksInFlight : { 1, MaxChunksInFlight })
+		{
+			FPipelineRun& PipelineRun = Runs.AddDefaulted_GetRef();
+			PipelineRun.Query = Query;
+			PipelineRun.ChunksInFlight = ChunksInFlight;
+		}
+	}
+
+	KeepAlive = AsShared();
+	PreviousMaxChunksInFlight = UserCache->GetMaxParallelUserQueryChunks();
+
+	// Chunks hold at least one ID, so no run sends more than one chunk per ID along with the retried chunk
+	const float TimeoutSeconds = Runs.Num() * (IdCount + CHUNK_PIPELINE_TEST_RETRY_COUNT) * LatencyMilliseconds / 1000.0f + CHUNK_PIPELINE_TEST_TIMEOUT_SLACK_SECONDS;
+	TimeoutHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FExecTestChunkedRequestPipeline::OnTimeout), TimeoutSeconds);
+
+	UE_LOG_AB(Log, TEXT("[%s] Querying %d IDs per run, %d ms latency per chunk"), GetResultTag(), IdCount, LatencyMilliseconds);
+	StartNextRun();
+	return true;
+}
+
+void FExecTestChunkedRequestPipeline::StartNextRun()
+{
+	CurrentRunIndex++;
+	if (bIsComplete || CurrentRunIndex >= Runs.Num())
+	{
+		Finish();
+		return;
+	}
+
+	const FPipelineRun& PipelineRun = Runs[CurrentRunIndex];
+	UserCache->SetMaxParallelUserQueryChunks(PipelineRun.ChunksInFlight);
+
+	// Fresh IDs for each run, so that nothing is cached or negative cached from the previous one
+	TArray<FString> Ids;
+	Ids.Reserve(IdCount);
+	for (int32 Index = 0; Index < IdCount; Index++)
+	{
+		Ids.Add(FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower());
+	}
+
+	TSharedRef<FChunkPipelineStandInBackend, ESPMode::ThreadSafe> RunBackend = MakeShared<FChunkPipelineStandInBackend, ESPMode::ThreadSafe>(LatencyMilliseconds / 1000.0);
+	Backend = RunBackend;
+	RunStartTimeInSeconds = FPlatformTime::Seconds();
+
+	if (PipelineRun.Query == EQuery::UserProfile)
+	{
+		FOnQueryUserProfileComplete Delegate;
+		Delegate.AddSP(AsShared(), &FExecTestChunkedRequestPipeline::OnUserProfileQueryComplete);
+		Subsystem->CreateAndDispatchAsyncTaskParallel<FChunkPipelineTestQueryUserProfile>(Subsystem, TEST_USER_INDEX, Ids, Delegate, RunBackend);
+	}
+	else
+	{
+		const FOnQueryUsersComplete Delegate = FOnQueryUsersComplete::CreateSP(AsShared(), &FExecTestChunkedRequestPipeline::OnUsersByIdsQueryComplete);
+		Subsystem->CreateAndDispatchAsyncTaskParallel<FChunkPipelineTestQueryUsersByIds>(Subsystem, TEST_USER_INDEX, Ids, Delegate, RunBackend);
+	}
+}
+
+void FExecTestChunkedRequestPipeline::OnUserProfileQueryComplete(int32 LocalUserNum, bool bWasSuccessful, const TArray<FUniqueNetIdRef>& UserIds, const FOnlineError& Error)
+{
+	CompleteRun(bWasSuccessful);
+}
+
+void FExecTestChunkedRequestPipeline::OnUsersByIdsQueryComplete(bool bWasSuccessful, TArray<FAccelByteUserInfoRef> UsersQueried)
+{
+	CompleteRun(bWasSuccessful);
+}
+
+void FExecTestChunkedRequestPipeline::CompleteRun(bool bWasSuccessful)
+{
+	if (!Runs.IsValidIndex(CurrentRunIndex) || !Backend.IsValid())
+	{
+		return;
+	}
+
+	FPipelineRun& PipelineRun = Runs[CurrentRunIndex];
+	PipelineRun.bWasSuccessful = bWasSuccessful;
+	PipelineRun.Seconds = FPlatformTime::Seconds() - RunStartTimeInSeconds;
+	{
+		FScopeLock Lock(&Backend->BackendLock);
+		PipelineRun.SentChunkCount = Backend->SentChunkCount;
+		PipelineRun.MaxChunksInFlightSeen = Backend->MaxChunksInFlightSeen;
+		PipelineRun.MaxChunkSize = Backend->MaxChunkSize;
+	}
+	Backend.Reset();
+
+	UE_LOG_AB(Log, TEXT("[%s] %s with %d chunk(s) in flight: %d chunks in %.1f ms")
+		, GetResultTag()
+		, PipelineRun.Query == EQuery::UserProfile ? TEXT("QueryUserProfile") : TEXT("QueryUsersByIds")
+		, PipelineRun.ChunksInFlight
+		, PipelineRun.SentChunkCount
+		, PipelineRun.Seconds * 1000.0);
+
+	StartNextRun();
+}
+
+void FExecTestChunkedRequestPipeline::CheckRuns(const FPipelineRun& SequentialRun, const FPipelineRun& ParallelRun, int32 RetryChunkCount)
+{
+	const TCHAR* QueryName = SequentialRun.Query == EQuery::UserProfile ? TEXT("QueryUserProfile") : TEXT("QueryUsersByIds");
+	const int32 ChunkCount = FMath::DivideAndRoundUp(IdCount, FMath::Max(ParallelRun.MaxChunkSize, 1));
+	const int32 ExpectedChunksInFlight = FMath::Min(ParallelRun.ChunksInFlight, ChunkCount);
+
+	Check(FString::Printf(TEXT("%s succeeded with one and with %d chunks in flight"), QueryName, ParallelRun.ChunksInFlight)
+		, SequentialRun.bWasSuccessful && ParallelRun.bWasSuccessful);
+	Check(FString::Printf(TEXT("%s sent %d and %d chunks, expected %d"), QueryName, SequentialRun.SentChunkCount, ParallelRun.SentChunkCount, ChunkCount + RetryChunkCount)
+		, SequentialRun.SentChunkCount == ChunkCount + RetryChunkCount && ParallelRun.SentChunkCount == ChunkCount + RetryChunkCount);
+	Check(FString::Printf(TEXT("%s kept %d and %d chunks in flight at most, expected 1 and %d"), QueryName, SequentialRun.MaxChunksInFlightSeen, ParallelRun.MaxChunksInFlightSeen, ExpectedChunksInFlight)
+		, SequentialRun.MaxChunksInFlightSeen == 1 && ParallelRun.MaxChunksInFlightSeen == ExpectedChunksInFlight);
+
+	// One latency per chunk when sent one after the other, against one latency per K chunks, plus the retried chunk that
+	// can only be sent once the chunk it came from is back
+	const double LatencySeconds = LatencyMilliseconds / 1000.0;
+	const int32 SentChunkCount = ChunkCount + RetryChunkCount;
+	const double ExpectedRatio = static_cast<double>(FMath::DivideAndRoundUp(ChunkCount, ParallelRun.ChunksInFlight) + RetryChunkCount) / SentChunkCount;
+	const double Ratio = (SequentialRun.Seconds > 0.0) ? ParallelRun.Seconds / SequentialRun.Seconds : 1.0;
+	Check(FString::Printf(TEXT("%s took %.1f ms for %d chunks one at a time, at least %.1f ms"), QueryName, SequentialRun.Seconds * 1000.0, SentChunkCount, SentChunkCount * LatencySeconds * 1000.0)
+		, SequentialRun.Seconds >= SentChunkCount * LatencySeconds);
+	Check(FString::Printf(TEXT("%s took %.2fx the sequential time with %d chunks in flight, expected %.2fx"), QueryName, Ratio, ParallelRun.ChunksInFlight, ExpectedRatio)
+		, Ratio <= ExpectedRatio * CHUNK_PIPELINE_TEST_RATIO_TOLERANCE);
+}
+
+void FExecTestChunkedRequestPipeline::Finish()
+{
+	RestoreUserCache();
+
+	if (!bIsComplete)
+	{
+		CheckRuns(Runs[0], Runs[1], 1);
+		CheckRuns(Runs[2], Runs[3], 0);
+		CompleteTest();
+	}
+
+	KeepAlive.Reset();
+}
+
+bool FExecTestChunkedRequestPipeline::OnTimeout(float DeltaTime)
+{
+	TimeoutHandle.Reset();
+	RestoreUserCache();
+
+	// The query in flight may still complete after this, this test stays alive until it has
+	Check(FString::Printf(TEXT("Queries completed in time, %d of %d done"), CurrentRunIndex, Runs.Num()), false);
+	CompleteTest();
+	return false;
+}
+
+void FExecTestChunkedRequestPipeline::RestoreUserCache()
+{
+	if (TimeoutHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(TimeoutHandle);
+		TimeoutHandle.Reset();
+	}
+
+	if (UserCache.IsValid())
+	{
+		UserCache->SetMaxParallelUserQueryChunks(PreviousMaxChunksInFlight);
+	}
+}
+
+#undef CHUNK_PIPELINE_TEST_RETRY_COUNT
+#undef CHUNK_PIPELINE_TEST_RATIO_TOLERANCE
+#undef CHUNK_PIPELINE_TEST_TIMEOUT_SLACK_SECONDS
+
+#endif
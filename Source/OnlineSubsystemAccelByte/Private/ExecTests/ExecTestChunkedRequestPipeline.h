@@ -0,0 +1,135 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Core/AccelByteDefines.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineUserCacheAccelByte.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+struct FChunkPipelineStandInBackend;
+
+/**
+ * Test for the chunked dispatch of bulk user queries, running the real QueryUserProfile and QueryUsersByIds tasks with
+ * their backend request answered by a local stand-in after a fixed latency. Answers come back on the game thread like
+ * SDK responses do, and nothing is sent to the backend.
+ *
+ * Each query is run once with a single chunk in flight and once with the given amount of chunks in flight, checking
+ * that:
+ * - The in flight limit of the user cache is respected, and reached when there are enough chunks
+ * - IDs that a profile response reports as not processed are sent again in a chunk of their own
+ * - Every run completes successfully
+ * - The end to end time drops from one latency per chunk to about one latency per K chunks
+ *
+ * Requires a user logged in at TEST_USER_INDEX, as the tasks resolve their API client and user from it. The in flight
+ * limit of the user cache is restored once the test completes. Completes from the delegate of the last query, or fails
+ * once the timeout passes.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST CHUNKPIPELINE [IdCount] [LatencyMilliseconds] [MaxChunksInFlight]
+ */
+class FExecTestChunkedRequestPipeline : public FExecTestBase, public TSharedFromThis<FExecTestChunkedRequestPipeline>
+{
+public:
+
+	/**
+	 * Constructs an instance of the chunked request pipeline test.
+	 *
+	 * @param InIdCount Amount of IDs to query in each run
+	 * @param InLatencyMilliseconds Latency of the stand-in backend for a single chunk
+	 * @param InMaxChunksInFlight In flight limit to compare against sending one chunk at a time
+	 */
+	FExecTestChunkedRequestPipeline(UWorld* InWorld, const FName& InSubsystemName, int32 InIdCount, int32 InLatencyMilliseconds, int32 InMaxChunksInFlight);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("CHUNKPIPELINE");
+	}
+
+private:
+
+	/** Query task driven by a single run */
+	enum class EQuery : uint8
+	{
+		UserProfile,
+		UsersByIds
+	};
+
+	/** Settings and outcome of a single query */
+	struct FPipelineRun
+	{
+		EQuery Query = EQuery::UserProfile;
+		int32 ChunksInFlight = 1;
+		bool bWasSuccessful = false;
+		double Seconds = 0.0;
+		int32 SentChunkCount = 0;
+		int32 MaxChunksInFlightSeen = 0;
+		int32 MaxChunkSize = 0;
+	};
+
+	/** Amount of IDs to query in each run */
+	int32 IdCount;
+
+	/** Latency of the stand-in backend for a single chunk */
+	int32 LatencyMilliseconds;
+
+	/** In flight limit to compare against sending one chunk at a time */
+	int32 MaxChunksInFlight;
+
+	FOnlineSubsystemAccelByte* Subsystem = nullptr;
+
+	FOnlineUserCacheAccelBytePtr UserCache;
+
+	/** In flight limit of the user cache from before the test, restored once it completes */
+	int32 PreviousMaxChunksInFlight = 1;
+
+	/** Every run in the order they are made, one after the other */
+	TArray<FPipelineRun> Runs;
+
+	/** Index of the run in progress */
+	int32 CurrentRunIndex = INDEX_NONE;
+
+	double RunStartTimeInSeconds = 0.0;
+
+	/** Stand-in backend of the run in progress */
+	TSharedPtr<FChunkPipelineStandInBackend, ESPMode::ThreadSafe> Backend;
+
+	/** Keeps this test alive until the last query has completed, even if it timed out first */
+	TSharedPtr<FExecTestChunkedRequestPipeline> KeepAlive;
+
+	FDelegateHandleAlias TimeoutHandle;
+
+	/** Dispatch the query of the next run, or finish once every run is done */
+	void StartNextRun();
+
+	void OnUserProfileQueryComplete(int32 LocalUserNum, bool bWasSuccessful, const TArray<FUniqueNetIdRef>& UserIds, const FOnlineError& Error);
+
+	void OnUsersByIdsQueryComplete(bool bWasSuccessful, TArray<FAccelByteUserInfoRef> UsersQueried);
+
+	/** Record the outcome of the run in progress and move on to the next one */
+	void CompleteRun(bool bWasSuccessful);
+
+	/** Check the sequential and parallel runs of a single query against each other */
+	void CheckRuns(const FPipelineRun& SequentialRun, const FPipelineRun& ParallelRun, int32 RetryChunkCount);
+
+	/** Run the final checks once every run is done */
+	void Finish();
+
+	bool OnTimeout(float DeltaTime);
+
+	/** Put the in flight limit back and stop the timeout */
+	void RestoreUserCache();
+
+};
+
+#endif
@@ -0,0 +1,107 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestNegativeUserCache.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSubsystemUtils.h"
+#include "OnlineUserCacheAccelByte.h"
+#include "Misc/Guid.h"
+
+/** Amount of IDs added at once when checking that the negative cache stays bounded, well past its default limit */
+#define NEGATIVE_USER_CACHE_TEST_OVERFLOW_COUNT 5000
+
+static FString MakeTestAccelByteId()
+{
+	return FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+}
+
+FExecTestNegativeUserCache::FExecTestNegativeUserCache(UWorld* InWorld, const FName& InSubsystemName)
+	: FExecTestBase(InWorld, InSubsystemName)
+{
+}
+
+bool FExecTestNegativeUserCache::Run()
+{
+	FOnlineSubsystemAccelByte* Subsystem = static_cast<FOnlineSubsystemAccelByte*>(::Online::GetSubsystem(World, SubsystemName));
+	if (Subsystem == nullptr)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestNegativeUserCache, subsystem is invalid"));
+		return CompleteTest(false);
+	}
+
+	// Missing AccelByte IDs are left out of the query, every other ID is still queried
+	{
+		FOnlineUserCacheAccelByte UserCache(Subsystem);
+		const FString MissingId = MakeTestAccelByteId();
+		const FString OtherId = MakeTestAccelByteId();
+		UserCache.AddAccelByteIdsToNegativeCache({ MissingId });
+
+		TArray<FString> UsersToQuery;
+		TArray<FAccelByteUserInfoRef> UsersInCache;
+		UserCache.GetQueryAndCacheArrays({ MissingId, OtherId }, UsersToQuery, UsersInCache);
+		Check(TEXT("AccelByte IDs"), UsersToQuery.Num() == 1 && UsersToQuery[0] == OtherId && UsersInCache.Num() == 0);
+	}
+
+	// Missing platform IDs are only left out for the platform type that they were missing on
+	{
+		FOnlineUserCacheAccelByte UserCache(Subsystem);
+		UserCache.AddPlatformIdsToNegativeCache(TEXT("STEAM"), { TEXT("76561197960265728") });
+
+		TArray<FString> SteamIds = { TEXT("76561197960265728"), TEXT("76561197960265729") };
+		const int32 RemovedSteamCount = UserCache.RemoveNegativeCachedPlatformIds(TEXT("STEAM"), SteamIds);
+
+		TArray<FString> OtherPlatformIds = { TEXT("76561197960265728") };
+		const int32 RemovedOtherCount = UserCache.RemoveNegativeCachedPlatformIds(TEXT("PS5"), OtherPlatformIds);
+
+		Check(TEXT("Platform IDs"), RemovedSteamCount == 1 && SteamIds.Num() == 1 && SteamIds[0] == TEXT("76561197960265729")
+			&& RemovedOtherCount == 0 && OtherPlatformIds.Num() == 1);
+	}
+
+	// A user that shows up later, for example through another query, is queried again straight away
+	{
+		FOnlineUserCacheAccelByte UserCache(Subsystem);
+		const FString AccelByteId = MakeTestAccelByteId();
+		UserCache.AddAccelByteIdsToNegativeCache({ AccelByteId });
+		UserCache.AddPlatformIdsToNegativeCache(TEXT("STEAM"), { TEXT("76561197960265730") });
+
+		FAccelByteUserInfoRef User = MakeShared<FAccelByteUserInfo, ESPMode::ThreadSafe>();
+		User->Id = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(AccelByteId, TEXT("STEAM"), TEXT("76561197960265730")));
+		UserCache.AddUsersToCache({ User });
+
+		Check(TEXT("Resolved users"), UserCache.GetNegativeCachedUserCount() == 0);
+	}
+
+	// The negative cache never grows past its limit, no matter how many IDs are missing
+	{
+		FOnlineUserCacheAccelByte UserCache(Subsystem);
+		TArray<FString> MissingIds;
+		for (int32 Index = 0; Index < NEGATIVE_USER_CACHE_TEST_OVERFLOW_COUNT; Index++)
+		{
+			MissingIds.Add(MakeTestAccelByteId());
+			if (MissingIds.Num() == 100)
+			{
+				UserCache.AddAccelByteIdsToNegativeCache(MissingIds);
+				MissingIds.Reset();
+			}
+		}
+		UserCache.AddAccelByteIdsToNegativeCache(MissingIds);
+		const int32 OverflowCount = UserCache.GetNegativeCachedUserCount();
+		Check(FString::Printf(TEXT("Bounded (%d of %d IDs kept)"), OverflowCount, NEGATIVE_USER_CACHE_TEST_OVERFLOW_COUNT)
+			, OverflowCount > 0 && OverflowCount < NEGATIVE_USER_CACHE_TEST_OVERFLOW_COUNT);
+	}
+
+	// Nothing is remembered while disabled
+	{
+		FOnlineUserCacheAccelByte UserCache(Subsystem);
+		UserCache.SetNegativeUserCacheTimeSeconds(0);
+		UserCache.AddAccelByteIdsToNegativeCache({ MakeTestAccelByteId() });
+		Check(TEXT("Disabled"), UserCache.GetNegativeCachedUserCount() == 0);
+	}
+
+	return CompleteTest();
+}
+
+#endif
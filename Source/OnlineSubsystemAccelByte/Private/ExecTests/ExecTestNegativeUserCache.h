@@ -0,0 +1,39 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test for the negative cache of the user cache, run entirely locally without any backend calls.
+ *
+ * Checks that AccelByte IDs and platform IDs remembered as having no user are left out of queries, that an ID is
+ * forgotten once a user with that ID is cached, that the negative cache stays under its limit, and that nothing is
+ * remembered while the negative cache is disabled.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST NEGATIVEUSERCACHE
+ */
+class FExecTestNegativeUserCache : public FExecTestBase
+{
+public:
+
+	FExecTestNegativeUserCache(UWorld* InWorld, const FName& InSubsystemName);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("NEGATIVEUSERCACHE");
+	}
+
+};
+
+#endif
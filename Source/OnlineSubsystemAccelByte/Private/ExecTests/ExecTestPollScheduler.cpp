@@ -0,0 +1,127 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestPollScheduler.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "Utilities/AccelBytePollScheduler.h"
+
+FExecTestPollScheduler::FExecTestPollScheduler(UWorld* InWorld, const FName& InSubsystemName, int32 InPollCount, int32 InTickCount)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, PollCount(InPollCount)
+	, TickCount(InTickCount)
+{
+}
+
+bool FExecTestPollScheduler::Run()
+{
+	if (PollCount <= 0 || TickCount <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestPollScheduler, poll count %d and tick count %d must be positive"), PollCount, TickCount);
+		return CompleteTest(false);
+	}
+
+	RunChecks();
+	RunMeasurement();
+	return CompleteTest();
+}
+
+void FExecTestPollScheduler::RunChecks()
+{
+	FAccelBytePollScheduler Scheduler;
+	TArray<FString> Fired;
+
+	Scheduler.Schedule(TEXT("C"), 3.0, [&Fired]() { Fired.Add(TEXT("C")); });
+	Scheduler.Schedule(TEXT("A"), 1.0, [&Fired]() { Fired.Add(TEXT("A")); });
+	Scheduler.Schedule(TEXT("B"), 2.0, [&Fired]() { Fired.Add(TEXT("B")); });
+	Scheduler.Schedule(TEXT("Cancelled"), 1.5, [&Fired]() { Fired.Add(TEXT("Cancelled")); });
+	Scheduler.Cancel(TEXT("Cancelled"));
+
+	// Rescheduling replaces the pending poll, so this only fires once at its new time
+	Scheduler.Schedule(TEXT("Moved"), 0.5, [&Fired]() { Fired.Add(TEXT("MovedEarly")); });
+	Scheduler.Schedule(TEXT("Moved"), 2.5, [&Fired]() { Fired.Add(TEXT("Moved")); });
+
+	Check(TEXT("Nothing due"), Scheduler.Tick(0.0) == 0 && Fired.Num() == 0);
+
+	Scheduler.Tick(5.0);
+	Check(TEXT("Due order with cancel and reschedule"), Fired == TArray<FString>{ TEXT("A"), TEXT("B"), TEXT("Moved"), TEXT("C") }
+		&& Scheduler.GetScheduledCount() == 0);
+
+	// A poll that reschedules itself from its callback fires again on a later tick, not within the same one
+	int32 SelfFireCount = 0;
+	TFunction<void()> SelfRescheduling;
+	SelfRescheduling = [&Scheduler, &SelfFireCount, &SelfRescheduling]()
+	{
+		SelfFireCount++;
+		Scheduler.Schedule(TEXT("Self"), 10.0 + SelfFireCount, CopyTemp(SelfRescheduling));
+	};
+	Scheduler.Schedule(TEXT("Self"), 10.0, CopyTemp(SelfRescheduling));
+	Scheduler.Tick(10.5);
+	const bool bSelfFirstPassed = SelfFireCount == 1 && Scheduler.IsScheduled(TEXT("Self"));
+	Scheduler.Tick(11.5);
+	Check(TEXT("Reschedule from callback"), bSelfFirstPassed && SelfFireCount == 2);
+	Scheduler.CancelAll();
+}
+
+void FExecTestPollScheduler::RunMeasurement()
+{
+	FAccelBytePollScheduler Scheduler;
+	int32 FiredCount = 0;
+
+	// Previous approach, a list of poll times that was scanned on every tick
+	struct FPollTime
+	{
+		FString Key;
+		double NextPollTime;
+	};
+	TArray<FPollTime> PollTimes;
+
+	for (int32 Index = 0; Index < PollCount; Index++)
+	{
+		const FString Key = FString::Printf(TEXT("SessionServerCheck:Session_%d:Player_%d"), Index, Index);
+		const double DueTime = 1000.0 + Index;
+		Scheduler.Schedule(Key, DueTime, [&FiredCount]() { FiredCount++; });
+		PollTimes.Add(FPollTime{ Key, DueTime });
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	for (int32 Tick = 0; Tick < TickCount; Tick++)
+	{
+		Scheduler.Tick(Tick * 0.016);
+	}
+	const double SchedulerSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	int32 ScanDueCount = 0;
+	const double ReferenceStartSeconds = FPlatformTime::Seconds();
+	for (int32 Tick = 0; Tick < TickCount; Tick++)
+	{
+		const double Now = Tick * 0.016;
+		for (const FPollTime& PollTime : PollTimes)
+		{
+			if (Now >= PollTime.NextPollTime)
+			{
+				ScanDueCount++;
+			}
+		}
+	}
+	const double ReferenceSeconds = FPlatformTime::Seconds() - ReferenceStartSeconds;
+
+	// Cancelling every poll, as the notifications that they stand in for arrive
+	const double CancelStartSeconds = FPlatformTime::Seconds();
+	for (const FPollTime& PollTime : PollTimes)
+	{
+		Scheduler.Cancel(PollTime.Key);
+	}
+	const double CancelSeconds = FPlatformTime::Seconds() - CancelStartSeconds;
+
+	Check(FString::Printf(TEXT("%d outstanding polls: %.3f us per idle tick, previous scan %.3f us per idle tick, %.3f us per cancel")
+		, PollCount
+		, SchedulerSeconds * 1000000.0 / TickCount
+		, ReferenceSeconds * 1000000.0 / TickCount
+		, CancelSeconds * 1000000.0 / PollCount)
+		, FiredCount == 0 && ScanDueCount == 0 && Scheduler.GetScheduledCount() == 0);
+}
+
+#endif
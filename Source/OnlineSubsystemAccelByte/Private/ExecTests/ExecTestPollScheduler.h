@@ -0,0 +1,60 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test for the scheduler behind the match ticket, session server and session invite check polls.
+ *
+ * Checks that polls fire in due order, that cancelled and rescheduled polls do not fire with their old schedule, and that
+ * a poll may reschedule itself from its own callback. Then schedules the given amount of polls that are not due yet,
+ * as on a server with many outstanding matchmaking tickets, and times idle ticks against the previous approach of
+ * scanning a list of poll times on every tick.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST POLLSCHEDULER [PollCount] [TickCount]
+ */
+class FExecTestPollScheduler : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the poll scheduler test.
+	 *
+	 * @param InPollCount Amount of outstanding polls during the timed ticks
+	 * @param InTickCount Amount of ticks timed for each approach
+	 */
+	FExecTestPollScheduler(UWorld* InWorld, const FName& InSubsystemName, int32 InPollCount, int32 InTickCount);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("POLLSCHEDULER");
+	}
+
+private:
+
+	/** Amount of outstanding polls during the timed ticks */
+	int32 PollCount;
+
+	/** Amount of ticks timed for each approach */
+	int32 TickCount;
+
+	/** Check firing order, cancelling and rescheduling */
+	void RunChecks();
+
+	/** Time idle ticks against the previous list scan, checking that no poll fires early */
+	void RunMeasurement();
+
+};
+
+#endif
@@ -0,0 +1,185 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestSessionArrayCodec.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSessionSettingsAccelByte.h"
+
+namespace
+{
+	const FName CodecTestKey(TEXT("ARRAYCODECTEST"));
+
+	/** Write strings in the original format, the data type byte followed by each string with a zero TCHAR after it */
+	TArray<uint8> MakeOriginalFormatBlob(const TArray<FString>& Strings)
+	{
+		TArray<uint8> Bytes;
+		Bytes.Add(StaticCast<uint8>(ESessionSettingsAccelByteArrayFieldType::STRINGS));
+		for (const FString& String : Strings)
+		{
+			const int32 Offset = Bytes.AddZeroed((String.Len() + 1) * sizeof(TCHAR));
+			FMemory::Memcpy(Bytes.GetData() + Offset, *String, String.Len() * sizeof(TCHAR));
+		}
+		return Bytes;
+	}
+
+	/** Decode in the original manner, appending one character at a time */
+	void DecodeOriginalFormatBlob(const TArray<uint8>& Bytes, TArray<FString>& OutStrings)
+	{
+		FString String = TEXT("");
+		for (int32 Index = sizeof(uint8); Index < Bytes.Num(); Index += sizeof(TCHAR))
+		{
+			TCHAR Char;
+			FMemory::Memcpy(&Char, Bytes.GetData() + Index, sizeof(TCHAR));
+			if (Char == 0)
+			{
+				OutStrings.Add(String);
+				String = TEXT("");
+			}
+			else
+			{
+				String.AppendChar(Char);
+			}
+		}
+	}
+
+	bool DoesStringArrayRoundTrip(const TArray<FString>& Strings)
+	{
+		FOnlineSessionSettings Settings;
+		FOnlineSessionSettingsAccelByte::Set(Settings, CodecTestKey, Strings);
+
+		TArray<FString> Decoded;
+		return FOnlineSessionSettingsAccelByte::Get(Settings, CodecTestKey, Decoded)
+			&& Decoded == Strings
+			&& FOnlineSessionSettingsAccelByte::GetArrayFieldType(Settings, CodecTestKey) == ESessionSettingsAccelByteArrayFieldType::STRINGS;
+	}
+}
+
+FExecTestSessionArrayCodec::FExecTestSessionArrayCodec(UWorld* InWorld, const FName& InSubsystemName, int32 InStringCount, int32 InStringLength, int32 InIterations)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, StringCount(InStringCount)
+	, StringLength(InStringLength)
+	, Iterations(InIterations)
+{
+}
+
+bool FExecTestSessionArrayCodec::Run()
+{
+	if (StringCount <= 0 || StringLength <= 0 || Iterations <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestSessionArrayCodec, string count %d, string length %d and iterations %d must be positive"), StringCount, StringLength, Iterations);
+		return CompleteTest(false);
+	}
+
+	RunChecks();
+	RunMeasurement();
+	return CompleteTest();
+}
+
+void FExecTestSessionArrayCodec::RunChecks()
+{
+	const TArray<FString> Strings = { TEXT("us-west-2"), TEXT(""), TEXT("caf\u00e9 \u4e2d\u6587"), TEXT(""), TEXT("eu-central-1") };
+
+	Check(TEXT("String round trip"), DoesStringArrayRoundTrip(Strings));
+	Check(TEXT("Empty string array round trip"), DoesStringArrayRoundTrip({}));
+
+	{
+		const TArray<double> Numbers = { 0.0, -1.5, 3.14159, 1e300, 42.0 };
+		FOnlineSessionSettings Settings;
+		FOnlineSessionSettingsAccelByte::Set(Settings, CodecTestKey, Numbers);
+
+		TArray<double> Decoded;
+		Check(TEXT("Double round trip"), FOnlineSessionSettingsAccelByte::Get(Settings, CodecTestKey, Decoded)
+			&& Decoded == Numbers
+			&& FOnlineSessionSettingsAccelByte::GetArrayFieldType(Settings, CodecTestKey) == ESessionSettingsAccelByteArrayFieldType::DOUBLES);
+	}
+
+	{
+		// Blobs written before the length prefixed codec are still read
+		FOnlineSessionSettings Settings;
+		Settings.Set(CodecTestKey, MakeOriginalFormatBlob(Strings));
+
+		TArray<FString> Decoded;
+		Check(TEXT("Original format"), FOnlineSessionSettingsAccelByte::Get(Settings, CodecTestKey, Decoded)
+			&& Decoded == Strings
+			&& FOnlineSessionSettingsAccelByte::GetArrayFieldType(Settings, CodecTestKey) == ESessionSettingsAccelByteArrayFieldType::STRINGS);
+	}
+
+	{
+		// Cutting a blob short at any point is rejected rather than read out of bounds
+		FOnlineSessionSettings Settings;
+		FOnlineSessionSettingsAccelByte::Set(Settings, CodecTestKey, Strings);
+		TArray<uint8> Blob;
+		Settings.Get(CodecTestKey, Blob);
+
+		bool bTruncatedPassed = true;
+		for (int32 Size = 1; Size < Blob.Num(); Size++)
+		{
+			FOnlineSessionSettings TruncatedSettings;
+			TruncatedSettings.Set(CodecTestKey, TArray<uint8>(Blob.GetData(), Size));
+
+			TArray<FString> Decoded;
+			bTruncatedPassed &= !FOnlineSessionSettingsAccelByte::Get(TruncatedSettings, CodecTestKey, Decoded);
+		}
+		Check(TEXT("Truncated blobs rejected"), bTruncatedPassed);
+	}
+}
+
+void FExecTestSessionArrayCodec::RunMeasurement()
+{
+	TArray<FString> Strings;
+	Strings.Reserve(StringCount);
+	for (int32 Index = 0; Index < StringCount; Index++)
+	{
+		FString String = FString::Printf(TEXT("%d_"), Index);
+		while (String.Len() < StringLength)
+		{
+			String.AppendChar(StaticCast<TCHAR>(TEXT('a') + (String.Len() % 26)));
+		}
+		Strings.Add(String.Left(StringLength));
+	}
+
+	bool bPassed = true;
+	FOnlineSessionSettings Settings;
+
+	const double EncodeStartSeconds = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		FOnlineSessionSettingsAccelByte::Set(Settings, CodecTestKey, Strings);
+	}
+	const double EncodeSeconds = FPlatformTime::Seconds() - EncodeStartSeconds;
+
+	const double DecodeStartSeconds = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		TArray<FString> Decoded;
+		bPassed &= FOnlineSessionSettingsAccelByte::Get(Settings, CodecTestKey, Decoded) && Decoded.Num() == Strings.Num();
+	}
+	const double DecodeSeconds = FPlatformTime::Seconds() - DecodeStartSeconds;
+
+	const TArray<uint8> OriginalBlob = MakeOriginalFormatBlob(Strings);
+	const double ReferenceStartSeconds = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		TArray<FString> Decoded;
+		DecodeOriginalFormatBlob(OriginalBlob, Decoded);
+		bPassed &= Decoded.Num() == Strings.Num();
+	}
+	const double ReferenceSeconds = FPlatformTime::Seconds() - ReferenceStartSeconds;
+
+	TArray<FString> Decoded;
+	FOnlineSessionSettingsAccelByte::Get(Settings, CodecTestKey, Decoded);
+	bPassed &= Decoded == Strings;
+
+	Check(FString::Printf(TEXT("%d strings of length %d: encode %.3f us, decode %.3f us, original decode %.3f us per array")
+		, StringCount
+		, StringLength
+		, EncodeSeconds * 1000000.0 / Iterations
+		, DecodeSeconds * 1000000.0 / Iterations
+		, ReferenceSeconds * 1000000.0 / Iterations)
+		, bPassed);
+}
+
+#endif
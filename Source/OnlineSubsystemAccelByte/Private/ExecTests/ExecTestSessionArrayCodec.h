@@ -0,0 +1,64 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test for the codec that stores array session settings as blobs.
+ *
+ * Checks that string and double arrays survive a round trip, including empty arrays, empty strings and non ASCII
+ * characters, that blobs in the original zero terminated string format are still read, and that truncated blobs are
+ * rejected. Then times encoding and decoding a large string array, against a decode in the original one character at a
+ * time manner.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST SESSIONARRAYCODEC [StringCount] [StringLength] [Iterations]
+ */
+class FExecTestSessionArrayCodec : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the session array codec test.
+	 *
+	 * @param InStringCount Amount of strings in the array that is timed
+	 * @param InStringLength Length of each of those strings
+	 * @param InIterations Amount of times that the array is encoded and decoded
+	 */
+	FExecTestSessionArrayCodec(UWorld* InWorld, const FName& InSubsystemName, int32 InStringCount, int32 InStringLength, int32 InIterations);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("SESSIONARRAYCODEC");
+	}
+
+private:
+
+	/** Amount of strings in the array that is timed */
+	int32 StringCount;
+
+	/** Length of each of those strings */
+	int32 StringLength;
+
+	/** Amount of times that the array is encoded and decoded */
+	int32 Iterations;
+
+	/** Check round trips, the original format and truncated blobs */
+	void RunChecks();
+
+	/** Time encoding and decoding against the original decode, checking that every decoded array matches the encoded one */
+	void RunMeasurement();
+
+};
+
+#endif
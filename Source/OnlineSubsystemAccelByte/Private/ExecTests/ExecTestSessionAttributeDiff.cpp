@@ -0,0 +1,132 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestSessionAttributeDiff.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "Utilities/AccelByteJsonDiff.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	int32 GetSerializedSize(const TSharedRef<FJsonObject>& Object)
+	{
+		FString Serialized;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Serialized);
+		FJsonSerializer::Serialize(Object, Writer);
+		return FTCHARToUTF8(*Serialized).Length();
+	}
+}
+
+FExecTestSessionAttributeDiff::FExecTestSessionAttributeDiff(UWorld* InWorld, const FName& InSubsystemName, int32 InAttributeCount)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, AttributeCount(InAttributeCount)
+{
+}
+
+bool FExecTestSessionAttributeDiff::Run()
+{
+	if (AttributeCount <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestSessionAttributeDiff, attribute count %d must be positive"), AttributeCount);
+		return CompleteTest(false);
+	}
+
+	RunChecks();
+	RunSizeComparison();
+	return CompleteTest();
+}
+
+void FExecTestSessionAttributeDiff::CheckDiff(const TCHAR* CheckName
+	, const TSharedPtr<FJsonObject>& OldObject
+	, const TSharedRef<FJsonObject>& NewObject
+	, const TArray<FString>& ExpectedChangedNames
+	, const TArray<FString>& ExpectedRemovedNames)
+{
+	const TSharedRef<FJsonObject> ChangedFields = MakeShared<FJsonObject>();
+	TArray<FString> RemovedNames;
+	const bool bHasDifference = FAccelByteJsonDiff::DiffTopLevelFields(OldObject, NewObject, ChangedFields, RemovedNames);
+
+	bool bPassed = bHasDifference == (ExpectedChangedNames.Num() > 0 || ExpectedRemovedNames.Num() > 0);
+	bPassed &= ChangedFields->Values.Num() == ExpectedChangedNames.Num();
+	for (const FString& Name : ExpectedChangedNames)
+	{
+		bPassed &= ChangedFields->HasField(Name);
+	}
+	bPassed &= RemovedNames.Num() == ExpectedRemovedNames.Num();
+	for (const FString& Name : ExpectedRemovedNames)
+	{
+		bPassed &= RemovedNames.Contains(Name);
+	}
+
+	Check(FString::Printf(TEXT("%s: %d changed, %d removed"), CheckName, ChangedFields->Values.Num(), RemovedNames.Num()), bPassed);
+}
+
+void FExecTestSessionAttributeDiff::RunChecks()
+{
+	const TSharedRef<FJsonObject> Nested = MakeShared<FJsonObject>();
+	Nested->SetStringField(TEXT("MAP"), TEXT("Arena"));
+	Nested->SetArrayField(TEXT("MODES"), { MakeShared<FJsonValueString>(TEXT("CTF")), MakeShared<FJsonValueString>(TEXT("TDM")) });
+
+	const TSharedRef<FJsonObject> Old = MakeShared<FJsonObject>();
+	Old->SetStringField(TEXT("REGION"), TEXT("us-west-2"));
+	Old->SetNumberField(TEXT("MAXPLAYERS"), 16);
+	Old->SetBoolField(TEXT("RANKED"), true);
+	Old->SetObjectField(TEXT("MATCH"), Nested);
+
+	// Same values, added in a different order
+	const TSharedRef<FJsonObject> Reordered = MakeShared<FJsonObject>();
+	Reordered->SetObjectField(TEXT("MATCH"), Nested);
+	Reordered->SetBoolField(TEXT("RANKED"), true);
+	Reordered->SetNumberField(TEXT("MAXPLAYERS"), 16.0);
+	Reordered->SetStringField(TEXT("REGION"), TEXT("us-west-2"));
+
+	CheckDiff(TEXT("Equal objects"), Old, Reordered, {}, {});
+
+	const TSharedRef<FJsonObject> Changed = MakeShared<FJsonObject>(*Reordered);
+	Changed->SetNumberField(TEXT("MAXPLAYERS"), 32);
+	Changed->SetStringField(TEXT("PASSWORD"), TEXT("hunter2"));
+	CheckDiff(TEXT("Changed and added fields"), Old, Changed, { TEXT("MAXPLAYERS"), TEXT("PASSWORD") }, {});
+
+	const TSharedRef<FJsonObject> Removed = MakeShared<FJsonObject>(*Reordered);
+	Removed->RemoveField(TEXT("RANKED"));
+	CheckDiff(TEXT("Removed field"), Old, Removed, {}, { TEXT("RANKED") });
+
+	const TSharedRef<FJsonObject> ChangedNested = MakeShared<FJsonObject>(*Nested);
+	ChangedNested->SetArrayField(TEXT("MODES"), { MakeShared<FJsonValueString>(TEXT("CTF")) });
+	const TSharedRef<FJsonObject> NestedChange = MakeShared<FJsonObject>(*Reordered);
+	NestedChange->SetObjectField(TEXT("MATCH"), ChangedNested);
+	CheckDiff(TEXT("Nested change"), Old, NestedChange, { TEXT("MATCH") }, {});
+
+	CheckDiff(TEXT("No previous object"), nullptr, Old, { TEXT("REGION"), TEXT("MAXPLAYERS"), TEXT("RANKED"), TEXT("MATCH") }, {});
+}
+
+void FExecTestSessionAttributeDiff::RunSizeComparison()
+{
+	const TSharedRef<FJsonObject> Old = MakeShared<FJsonObject>();
+	for (int32 Index = 0; Index < AttributeCount; Index++)
+	{
+		Old->SetStringField(FString::Printf(TEXT("ATTRIBUTE_%d"), Index), FString::Printf(TEXT("Value of attribute number %d"), Index));
+	}
+
+	const TSharedRef<FJsonObject> New = MakeShared<FJsonObject>(*Old);
+	New->SetStringField(TEXT("ATTRIBUTE_0"), TEXT("Changed value"));
+
+	const TSharedRef<FJsonObject> ChangedFields = MakeShared<FJsonObject>();
+	TArray<FString> RemovedNames;
+	const double StartTime = FPlatformTime::Seconds();
+	FAccelByteJsonDiff::DiffTopLevelFields(Old, New, ChangedFields, RemovedNames);
+	const double DiffMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	const int32 FullSize = GetSerializedSize(New);
+	const int32 PatchSize = GetSerializedSize(ChangedFields);
+	Check(FString::Printf(TEXT("%d attributes, one changed: full update %d bytes, changed attributes only %d bytes, diff took %.3f ms")
+		, AttributeCount, FullSize, PatchSize, DiffMilliseconds)
+		, ChangedFields->Values.Num() == 1 && RemovedNames.Num() == 0 && PatchSize < FullSize);
+}
+
+#endif
@@ -0,0 +1,66 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test for the structural JSON diff that game session updates use to only send the attributes that changed.
+ *
+ * Checks that equal objects produce no diff regardless of field order, and that changed, added, removed and nested
+ * fields are all detected. Then builds a large attribute set, changes a single attribute, and logs the serialized size
+ * of the full attributes against the size of the changed attributes only.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST SESSIONATTRDIFF [AttributeCount]
+ */
+class FExecTestSessionAttributeDiff : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the session attribute diff test.
+	 *
+	 * @param InAttributeCount Amount of attributes in the large attribute set
+	 */
+	FExecTestSessionAttributeDiff(UWorld* InWorld, const FName& InSubsystemName, int32 InAttributeCount);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("SESSIONATTRDIFF");
+	}
+
+private:
+
+	/** Amount of attributes in the large attribute set */
+	int32 AttributeCount;
+
+	/** Diff two objects and check that exactly the expected top level fields were found changed and removed */
+	void CheckDiff(const TCHAR* CheckName
+		, const TSharedPtr<FJsonObject>& OldObject
+		, const TSharedRef<FJsonObject>& NewObject
+		, const TArray<FString>& ExpectedChangedNames
+		, const TArray<FString>& ExpectedRemovedNames);
+
+	/** Check the diff of small hand made objects */
+	void RunChecks();
+
+	/**
+	 * Compare the serialized size of a full update against a changed attributes only update, checking that the diff only
+	 * held the changed attribute.
+	 */
+	void RunSizeComparison();
+
+};
+
+#endif
@@ -0,0 +1,134 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS && AB_USE_V2_SESSIONS
+
+#include "ExecTestSessionIdIndex.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSessionInterfaceV2AccelByte.h"
+#include "OnlineSubsystemUtils.h"
+
+namespace
+{
+	FOnlineSession MakeSessionWithId(const FString& SessionId)
+	{
+		FOnlineSession Session;
+		Session.SessionInfo = MakeShared<FOnlineSessionInfoAccelByteV2>(SessionId);
+		return Session;
+	}
+}
+
+FExecTestSessionIdIndex::FExecTestSessionIdIndex(UWorld* InWorld, const FName& InSubsystemName, int32 InSessionCount, int32 InLookupCount)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, SessionCount(InSessionCount)
+	, LookupCount(InLookupCount)
+{
+}
+
+bool FExecTestSessionIdIndex::Run()
+{
+	if (SessionCount <= 0 || LookupCount <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestSessionIdIndex, session count %d and lookup count %d must be positive"), SessionCount, LookupCount);
+		return CompleteTest(false);
+	}
+
+	FOnlineSubsystemAccelByte* Subsystem = static_cast<FOnlineSubsystemAccelByte*>(::Online::GetSubsystem(World, SubsystemName));
+	if (Subsystem == nullptr)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestSessionIdIndex, subsystem is invalid"));
+		return CompleteTest(false);
+	}
+
+	// Standalone session interface, so that the made up sessions never show up among the sessions of the game
+	const TSharedRef<FOnlineSessionV2AccelByte, ESPMode::ThreadSafe> SessionInterface = MakeShared<FOnlineSessionV2AccelByte, ESPMode::ThreadSafe>(Subsystem);
+
+	SessionNames.Reserve(SessionCount);
+	SessionIds.Reserve(SessionCount);
+	for (int32 Index = 0; Index < SessionCount; Index++)
+	{
+		const FName SessionName(*FString::Printf(TEXT("SessionIdIndex_%d"), Index));
+		const FString SessionId = FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+		SessionInterface->AddNamedSession(SessionName, MakeSessionWithId(SessionId));
+		SessionNames.Add(SessionName);
+		SessionIds.Add(SessionId);
+	}
+
+	UE_LOG_AB(Log, TEXT("[%s] %d sessions, %d lookups per measurement"), GetResultTag(), SessionCount, LookupCount);
+
+	RunMeasurement(*SessionInterface);
+	RunChecks(*SessionInterface);
+	return CompleteTest();
+}
+
+void FExecTestSessionIdIndex::RunMeasurement(FOnlineSessionV2AccelByte& SessionInterface)
+{
+	// Every fourth lookup is for a session that we are not in, as with notifications that arrive after leaving
+	TArray<FString> LookupIds;
+	LookupIds.Reserve(LookupCount);
+	for (int32 Index = 0; Index < LookupCount; Index++)
+	{
+		LookupIds.Add((Index % 4 == 3) ? FString::Printf(TEXT("unknown%d"), Index) : SessionIds[FMath::RandRange(0, SessionIds.Num() - 1)]);
+	}
+
+	int32 IndexFoundCount = 0;
+	const double StartSeconds = FPlatformTime::Seconds();
+	for (const FString& LookupId : LookupIds)
+	{
+		if (SessionInterface.GetNamedSessionById(LookupId) != nullptr)
+		{
+			IndexFoundCount++;
+		}
+	}
+	const double IndexSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	// Previous approach, every session in the map was walked and its ID compared
+	int32 ScanFoundCount = 0;
+	const double ReferenceStartSeconds = FPlatformTime::Seconds();
+	for (const FString& LookupId : LookupIds)
+	{
+		FScopeLock ScopeLock(&SessionInterface.SessionLock);
+		for (const TPair<FName, TSharedPtr<FNamedOnlineSession>>& SessionPair : SessionInterface.Sessions)
+		{
+			if (SessionPair.Value->GetSessionIdStr().Equals(LookupId))
+			{
+				ScanFoundCount++;
+				break;
+			}
+		}
+	}
+	const double ReferenceSeconds = FPlatformTime::Seconds() - ReferenceStartSeconds;
+
+	UE_LOG_AB(Log, TEXT("[%s] Index %.3f us per lookup, previous scan %.3f us per lookup")
+		, GetResultTag()
+		, IndexSeconds * 1000000.0 / LookupCount
+		, ReferenceSeconds * 1000000.0 / LookupCount);
+
+	Check(FString::Printf(TEXT("Index found %d sessions, previous scan found %d"), IndexFoundCount, ScanFoundCount), IndexFoundCount == ScanFoundCount);
+}
+
+void FExecTestSessionIdIndex::RunChecks(FOnlineSessionV2AccelByte& SessionInterface)
+{
+	const FName SessionName(TEXT("SessionIdIndex_Reused"));
+	const FString FirstSessionId = TEXT("sessionidindexfirst");
+	const FString SecondSessionId = TEXT("sessionidindexsecond");
+
+	FNamedOnlineSession* FirstSession = SessionInterface.AddNamedSession(SessionName, MakeSessionWithId(FirstSessionId));
+	Check(TEXT("Added session is found by its ID"), SessionInterface.GetNamedSessionById(FirstSessionId) == FirstSession);
+
+	// Reusing the name for another session drops the ID of the session that it replaced
+	FNamedOnlineSession* SecondSession = SessionInterface.AddNamedSession(SessionName, MakeSessionWithId(SecondSessionId));
+	Check(TEXT("Reused name drops the ID of the replaced session"), SessionInterface.GetNamedSessionById(FirstSessionId) == nullptr
+		&& SessionInterface.GetNamedSessionById(SecondSessionId) == SecondSession);
+
+	SessionInterface.RemoveNamedSession(SessionName);
+	bool bIdDropped = false;
+	{
+		FScopeLock ScopeLock(&SessionInterface.SessionLock);
+		bIdDropped = !SessionInterface.SessionIdToSessionName.Contains(SecondSessionId);
+	}
+	Check(TEXT("Removed session is dropped from the index"), SessionInterface.GetNamedSessionById(SecondSessionId) == nullptr && bIdDropped);
+}
+
+#endif
@@ -0,0 +1,74 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && AB_USE_V2_SESSIONS
+
+class FOnlineSessionV2AccelByte;
+
+/**
+ * Benchmark for finding a session by its backend ID, as every lobby and DS hub notification for a session does.
+ *
+ * Adds the given amount of local sessions with backend IDs to a standalone session interface, and times looking up known
+ * and unknown IDs through the session ID index. For comparison, the same lookups are also timed with the previous
+ * approach of walking every session. Also checks that the index follows sessions being removed and names being reused.
+ *
+ * The standalone session interface goes away along with its sessions once the benchmark is done, so the sessions of the
+ * game are never touched.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST SESSIONIDINDEX [SessionCount] [LookupCount]
+ */
+class FExecTestSessionIdIndex : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the session ID index benchmark.
+	 *
+	 * @param InSessionCount Amount of sessions to add
+	 * @param InLookupCount Amount of lookups timed for each approach
+	 */
+	FExecTestSessionIdIndex(UWorld* InWorld, const FName& InSubsystemName, int32 InSessionCount, int32 InLookupCount);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("SESSIONIDINDEX");
+	}
+
+private:
+
+	/** Amount of sessions to add */
+	int32 SessionCount;
+
+	/** Amount of lookups timed for each approach */
+	int32 LookupCount;
+
+	/** Names of the sessions added by this benchmark */
+	TArray<FName> SessionNames;
+
+	/** Backend IDs of the sessions added by this benchmark, by the same index as SessionNames */
+	TArray<FString> SessionIds;
+
+	/**
+	 * Time lookups through the index and through the previous scan, and check that both found the same sessions.
+	 */
+	void RunMeasurement(FOnlineSessionV2AccelByte& SessionInterface);
+
+	/**
+	 * Check that the index follows sessions being removed and names being reused.
+	 */
+	void RunChecks(FOnlineSessionV2AccelByte& SessionInterface);
+
+};
+
+#endif
@@ -0,0 +1,144 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS && AB_USE_V2_SESSIONS
+
+#include "ExecTestSessionUpdateBenchmark.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSessionInterfaceV2AccelByte.h"
+#include "OnlineSubsystemUtils.h"
+
+FExecTestSessionUpdateBenchmark::FExecTestSessionUpdateBenchmark(UWorld* InWorld, const FName& InSubsystemName, int32 InSessionCount, int32 InTickCount)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, SessionCount(InSessionCount)
+	, TickCount(InTickCount)
+{
+}
+
+bool FExecTestSessionUpdateBenchmark::Run()
+{
+	if (SessionCount <= 0 || TickCount <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestSessionUpdateBenchmark, session count %d and tick count %d must be positive"), SessionCount, TickCount);
+		return CompleteTest(false);
+	}
+
+	FOnlineSubsystemAccelByte* Subsystem = static_cast<FOnlineSubsystemAccelByte*>(::Online::GetSubsystem(World, SubsystemName));
+	if (Subsystem == nullptr)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestSessionUpdateBenchmark, subsystem is invalid"));
+		return CompleteTest(false);
+	}
+
+	// Standalone session interface, so that the made up sessions never show up among the sessions of the game
+	const TSharedRef<FOnlineSessionV2AccelByte, ESPMode::ThreadSafe> SessionInterface = MakeShared<FOnlineSessionV2AccelByte, ESPMode::ThreadSafe>(Subsystem);
+
+	SessionNames.Reserve(SessionCount);
+	for (int32 Index = 0; Index < SessionCount; Index++)
+	{
+		const FName SessionName(*FString::Printf(TEXT("SessionUpdateBenchmark_%d"), Index));
+		FNamedOnlineSession* Session = SessionInterface->AddNamedSession(SessionName, FOnlineSessionSettings());
+		Session->SessionState = EOnlineSessionState::Creating;
+		SessionNames.Add(SessionName);
+	}
+
+	UE_LOG_AB(Log, TEXT("[%s] %d sessions, %d ticks per measurement"), GetResultTag(), SessionCount, TickCount);
+
+	for (int32 QueuedSessionCount = 0; QueuedSessionCount <= SessionCount; QueuedSessionCount = (QueuedSessionCount == 0) ? 1 : QueuedSessionCount * 10)
+	{
+		RunMeasurement(*SessionInterface, QueuedSessionCount);
+	}
+
+	RunChecks(*SessionInterface);
+	return CompleteTest();
+}
+
+void FExecTestSessionUpdateBenchmark::RunMeasurement(FOnlineSessionV2AccelByte& SessionInterface, int32 QueuedSessionCount) const
+{
+	// Spread the sessions with an update over the whole map, rather than only the first ones that would be visited
+	const int32 Stride = FMath::Max(SessionNames.Num() / FMath::Max(QueuedSessionCount, 1), 1);
+	TArray<FName> QueuedSessionNames;
+	for (int32 Index = 0; Index < SessionNames.Num() && QueuedSessionNames.Num() < QueuedSessionCount; Index += Stride)
+	{
+		QueuedSessionNames.Add(SessionNames[Index]);
+	}
+
+	for (const FName& SessionName : QueuedSessionNames)
+	{
+		SessionInterface.QueuePendingSessionUpdate(SessionName);
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	for (int32 Tick = 0; Tick < TickCount; Tick++)
+	{
+		SessionInterface.UpdateSessionEntries();
+	}
+	const double QueueSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	// Previous approach, every session in the map was visited and looked up in the array of pending session names
+	const TArray<FName> PendingSessionNames = QueuedSessionNames;
+	int32 VisitedCount = 0;
+	const double ReferenceStartSeconds = FPlatformTime::Seconds();
+	for (int32 Tick = 0; Tick < TickCount && PendingSessionNames.Num() > 0; Tick++)
+	{
+		FScopeLock ScopeLock(&SessionInterface.SessionLock);
+		for (const TPair<FName, TSharedPtr<FNamedOnlineSession>>& SessionEntry : SessionInterface.Sessions)
+		{
+			const int32 PendingUpdateIndex = PendingSessionNames.IndexOfByPredicate([SessionName = SessionEntry.Key](const FName& PendingUpdateSessionName) {
+				return PendingUpdateSessionName.IsEqual(SessionName);
+			});
+
+			if (PendingUpdateIndex != INDEX_NONE && SessionEntry.Value->SessionState == EOnlineSessionState::Creating)
+			{
+				VisitedCount++;
+			}
+		}
+	}
+	const double ReferenceSeconds = FPlatformTime::Seconds() - ReferenceStartSeconds;
+
+	UE_LOG_AB(Log, TEXT("[%s] %d sessions with an update: %.3f us per tick, previous scan %.3f us per tick (%d visits)")
+		, GetResultTag()
+		, QueuedSessionNames.Num()
+		, QueueSeconds * 1000000.0 / TickCount
+		, ReferenceSeconds * 1000000.0 / TickCount
+		, VisitedCount);
+
+	// Let the queued updates go again for the next measurement
+	{
+		FScopeLock ScopeLock(&SessionInterface.SessionLock);
+		for (const FName& SessionName : QueuedSessionNames)
+		{
+			SessionInterface.SessionsWithPendingQueuedUpdates.Remove(SessionName);
+			SessionInterface.PendingQueuedUpdateQueue.Remove(SessionName);
+		}
+	}
+}
+
+void FExecTestSessionUpdateBenchmark::RunChecks(FOnlineSessionV2AccelByte& SessionInterface)
+{
+	FScopeLock ScopeLock(&SessionInterface.SessionLock);
+
+	const int32 InitialQueueLength = SessionInterface.PendingQueuedUpdateQueue.Num();
+
+	// Queueing the same session twice only visits it once
+	SessionInterface.QueuePendingSessionUpdate(SessionNames[0]);
+	SessionInterface.QueuePendingSessionUpdate(SessionNames[0]);
+	Check(TEXT("Session queued twice is visited once"), SessionInterface.PendingQueuedUpdateQueue.Num() == InitialQueueLength + 1);
+
+	// A session that is still creating keeps its update queued over a tick
+	SessionInterface.UpdateSessionEntries();
+	Check(TEXT("Update stays queued while the session is creating"), SessionInterface.SessionsWithPendingQueuedUpdates.Contains(SessionNames[0])
+		&& SessionInterface.PendingQueuedUpdateQueue.Num() == SessionInterface.SessionsWithPendingQueuedUpdates.Num());
+
+	// A removed session has its update dropped on the next tick
+	const FName RemovedSessionName(TEXT("SessionUpdateBenchmark_Removed"));
+	SessionInterface.AddNamedSession(RemovedSessionName, FOnlineSessionSettings())->SessionState = EOnlineSessionState::Creating;
+	SessionInterface.QueuePendingSessionUpdate(RemovedSessionName);
+	SessionInterface.RemoveNamedSession(RemovedSessionName);
+	SessionInterface.UpdateSessionEntries();
+	Check(TEXT("Update is dropped for a removed session"), !SessionInterface.SessionsWithPendingQueuedUpdates.Contains(RemovedSessionName)
+		&& !SessionInterface.PendingQueuedUpdateQueue.Contains(RemovedSessionName));
+}
+
+#endif
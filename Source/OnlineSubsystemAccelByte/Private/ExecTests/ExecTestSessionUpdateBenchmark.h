@@ -0,0 +1,74 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && AB_USE_V2_SESSIONS
+
+class FOnlineSessionV2AccelByte;
+
+/**
+ * Benchmark for the per tick cost of checking sessions for queued backend updates, with many sessions of which only a
+ * few have an update queued, as on a dedicated server hosting many sessions at once.
+ *
+ * Adds the given amount of local sessions to a standalone session interface, queues updates for a varying amount of
+ * them, and times UpdateSessionEntries over many ticks. The sessions with an update are kept in the creating state, so
+ * that their update stays queued from tick to tick without touching the backend. For comparison, the same ticks are
+ * also timed with the previous approach of visiting every session and searching an array of pending session names for
+ * it. Also checks that an update queued twice is only visited once, and that updates for removed sessions are dropped.
+ *
+ * The standalone session interface goes away along with its sessions once the benchmark is done, so the sessions of the
+ * game are never touched.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST SESSIONUPDATEBENCH [SessionCount] [TickCount]
+ */
+class FExecTestSessionUpdateBenchmark : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the session update benchmark.
+	 *
+	 * @param InSessionCount Amount of sessions to add
+	 * @param InTickCount Amount of ticks timed for every amount of sessions with an update
+	 */
+	FExecTestSessionUpdateBenchmark(UWorld* InWorld, const FName& InSubsystemName, int32 InSessionCount, int32 InTickCount);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("SESSIONUPDATEBENCH");
+	}
+
+private:
+
+	/** Amount of sessions to add */
+	int32 SessionCount;
+
+	/** Amount of ticks timed for every amount of sessions with an update */
+	int32 TickCount;
+
+	/** Names of the sessions added by this benchmark */
+	TArray<FName> SessionNames;
+
+	/**
+	 * Time the current and the previous approach with the given amount of sessions having an update queued.
+	 */
+	void RunMeasurement(FOnlineSessionV2AccelByte& SessionInterface, int32 QueuedSessionCount) const;
+
+	/**
+	 * Check the bookkeeping of queued updates.
+	 */
+	void RunChecks(FOnlineSessionV2AccelByte& SessionInterface);
+
+};
+
+#endif
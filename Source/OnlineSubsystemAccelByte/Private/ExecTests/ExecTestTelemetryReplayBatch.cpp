@@ -0,0 +1,237 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestTelemetryReplayBatch.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "Utilities/AccelByteTelemetryReplayBatcher.h"
+#include "Utilities/AccelByteTelemetrySpillQueue.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+/** Time between two simulated ticks */
+#define TELEMETRY_REPLAY_TEST_TICK_SECONDS (1.0 / 60.0)
+
+/** Minimum time between two batches in the test */
+#define TELEMETRY_REPLAY_TEST_BATCH_INTERVAL_SECONDS 0.25
+
+/** Events held in memory by the spill queue of the test, few enough that batches are read from the spill file */
+#define TELEMETRY_REPLAY_TEST_MAX_IN_MEMORY_EVENTS 16
+
+/** Longest text payload of the events that are not oversized, two of them fit in the smallest batch size allowed */
+#define TELEMETRY_REPLAY_TEST_MAX_TEXT_LENGTH 2000
+
+/**
+ * Stands in for the telemetry endpoint, recording every request that the replay sends
+ */
+struct FFakeTelemetryEndpoint
+{
+	int32 RequestCount = 0;
+	int64 TotalBytes = 0;
+	int32 MaxRequestBytes = 0;
+	int32 MaxRequestEvents = 0;
+
+	/** Index payload field of every event received, per local user, in the order received */
+	TMap<int32, TArray<int32>> LocalUserNumToReceivedIndices;
+
+	/** Whether a request went past the limits without being a single oversized event, or came too soon after another */
+	bool bHasOversizedRequest = false;
+	bool bHasEarlyRequest = false;
+
+	double LastRequestTimeInSeconds = -1.0;
+
+	void Receive(double CurrentTimeInSeconds, int32 LocalUserNum, const TArray<TSharedPtr<FAccelByteModelsTelemetryBody>>& Batch, int32 BatchSize, int32 MaxBatchEvents, int32 MaxBatchSize)
+	{
+		RequestCount++;
+		TotalBytes += BatchSize;
+		MaxRequestBytes = FMath::Max(MaxRequestBytes, BatchSize);
+		MaxRequestEvents = FMath::Max(MaxRequestEvents, Batch.Num());
+		bHasOversizedRequest |= Batch.Num() > MaxBatchEvents || (Batch.Num() > 1 && BatchSize > MaxBatchSize);
+		bHasEarlyRequest |= LastRequestTimeInSeconds >= 0.0 && CurrentTimeInSeconds - LastRequestTimeInSeconds < TELEMETRY_REPLAY_TEST_BATCH_INTERVAL_SECONDS - KINDA_SMALL_NUMBER;
+		LastRequestTimeInSeconds = CurrentTimeInSeconds;
+
+		TArray<int32>& ReceivedIndices = LocalUserNumToReceivedIndices.FindOrAdd(LocalUserNum);
+		for (const TSharedPtr<FAccelByteModelsTelemetryBody>& Event : Batch)
+		{
+			int32 Index = INDEX_NONE;
+			Event->Payload->TryGetNumberField(TEXT("Index"), Index);
+			ReceivedIndices.Add(Index);
+		}
+	}
+};
+
+static TSharedPtr<FAccelByteModelsTelemetryBody> MakeReplayTestEvent(int32 Index, int32 TextLength)
+{
+	TSharedPtr<FAccelByteModelsTelemetryBody> Event = MakeShared<FAccelByteModelsTelemetryBody>();
+	Event->EventNamespace = TEXT("exectest");
+	Event->EventName = TEXT("TelemetryReplayBatch");
+	Event->ClientTimestamp = FDateTime::UtcNow();
+	Event->Payload = MakeShared<FJsonObject>();
+	Event->Payload->SetStringField(TEXT("PreDefinedEventName"), TEXT("TelemetryReplayBatch"));
+	Event->Payload->SetNumberField(TEXT("Index"), Index);
+	Event->Payload->SetStringField(TEXT("Text"), FString::ChrN(TextLength, TEXT('x')));
+	return Event;
+}
+
+FExecTestTelemetryReplayBatch::FExecTestTelemetryReplayBatch(UWorld* InWorld, const FName& InSubsystemName, int32 InEventCount, int32 InMaxBatchEvents, int32 InMaxBatchSizeKB)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, EventCount(InEventCount)
+	, MaxBatchEvents(InMaxBatchEvents)
+	, MaxBatchSizeKB(InMaxBatchSizeKB)
+{
+}
+
+bool FExecTestTelemetryReplayBatch::Run()
+{
+	// Batching has to be able to pair events up, otherwise sending fewer requests than events cannot be expected
+	if (EventCount < 4 || MaxBatchEvents < 2 || MaxBatchSizeKB < 8)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestTelemetryReplayBatch, event count %d and max batch events %d must be at least 4 and 2, and max batch size %d KB at least 8")
+			, EventCount, MaxBatchEvents, MaxBatchSizeKB);
+		return CompleteTest(false);
+	}
+
+	const FString FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByte"), TEXT("ExecTestTelemetryReplayBatch.bin"));
+	IFileManager::Get().Delete(*FilePath);
+
+	FAccelByteTelemetrySpillQueue Queue(TELEMETRY_REPLAY_TEST_MAX_IN_MEMORY_EVENTS);
+	if (!Queue.OpenSpillFile(FilePath, MAX_int32))
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestTelemetryReplayBatch, spill file %s could not be opened"), *FilePath);
+		return CompleteTest(false);
+	}
+
+	const int32 MaxBatchSize = MaxBatchSizeKB * 1024;
+	FAccelByteTelemetryReplayBatcher Batcher(MaxBatchEvents, MaxBatchSize, TELEMETRY_REPLAY_TEST_BATCH_INTERVAL_SECONDS);
+
+	// The first local user logs in with a backlog of events of varying sizes, one of them larger than a whole batch
+	TArray<int32> ExpectedFirstUserIndices;
+	int64 UnbatchedTotalBytes = 0;
+	const int32 OversizedIndex = EventCount / 2;
+	for (int32 Index = 0; Index < EventCount; Index++)
+	{
+		const int32 TextLength = (Index == OversizedIndex) ? MaxBatchSize + 1 : (Index * 37) % TELEMETRY_REPLAY_TEST_MAX_TEXT_LENGTH;
+		const TSharedPtr<FAccelByteModelsTelemetryBody> Event = MakeReplayTestEvent(Index, TextLength);
+		UnbatchedTotalBytes += FAccelByteTelemetryReplayBatcher::GetEventSize(*Event);
+		Queue.Enqueue(0, Event);
+		ExpectedFirstUserIndices.Add(Index);
+	}
+
+	// A second local user logs in right after, and a third logs out before any of its events went out
+	const int32 SecondUserEventCount = FMath::Max(EventCount / 10, 1);
+	TArray<int32> ExpectedSecondUserIndices;
+	for (int32 Index = 0; Index < SecondUserEventCount; Index++)
+	{
+		const TSharedPtr<FAccelByteModelsTelemetryBody> Event = MakeReplayTestEvent(Index, 100);
+		UnbatchedTotalBytes += FAccelByteTelemetryReplayBatcher::GetEventSize(*Event);
+		Queue.Enqueue(1, Event);
+		ExpectedSecondUserIndices.Add(Index);
+	}
+	for (int32 Index = 0; Index < SecondUserEventCount; Index++)
+	{
+		Queue.Enqueue(2, MakeReplayTestEvent(Index, 100));
+	}
+
+	Batcher.Add(0);
+	Batcher.Add(1);
+	Batcher.Add(2);
+	const int32 TotalEventCount = EventCount + SecondUserEventCount;
+	Check(TEXT("Logging out stops the replay of a local user and drops its events"), Batcher.Remove(2)
+		&& Queue.RemoveEvents(2) == SecondUserEventCount
+		&& Queue.GetEventCount() == TotalEventCount);
+
+	// Tick at a steady frame rate until the replay has drained, checking that no tick sends more than one batch, and that
+	// the events of a batch are still in the spill queue while they are being handed over
+	FFakeTelemetryEndpoint Endpoint;
+	const double StartTimeInSeconds = 1000.0;
+	double CurrentTimeInSeconds = StartTimeInSeconds;
+	int32 TickCount = 0;
+	int32 TicksWithBatchCount = 0;
+	bool bOneBatchPerTick = true;
+	bool bIsQueuedWhileSent = true;
+	bool bIsCommittedOnceSent = true;
+	const int32 MaxTickCount = (TotalEventCount + 1) * FMath::CeilToInt(TELEMETRY_REPLAY_TEST_BATCH_INTERVAL_SECONDS / TELEMETRY_REPLAY_TEST_TICK_SECONDS + 1);
+	while (Batcher.GetReplayCount() > 0 && TickCount < MaxTickCount)
+	{
+		const int32 RequestCountBeforeTick = Endpoint.RequestCount;
+		const int32 EventCountBeforeTick = Queue.GetEventCount();
+		const int32 SentCount = Batcher.Tick(CurrentTimeInSeconds, Queue, [&](int32 LocalUserNum, const TArray<TSharedPtr<FAccelByteModelsTelemetryBody>>& Batch, int32 BatchSize)
+		{
+			bIsQueuedWhileSent &= Queue.GetEventCount() == EventCountBeforeTick;
+			Endpoint.Receive(CurrentTimeInSeconds, LocalUserNum, Batch, BatchSize, MaxBatchEvents, MaxBatchSize);
+		});
+		bIsCommittedOnceSent &= Queue.GetEventCount() == EventCountBeforeTick - SentCount;
+
+		const int32 RequestsThisTick = Endpoint.RequestCount - RequestCountBeforeTick;
+		bOneBatchPerTick &= RequestsThisTick <= 1;
+		TicksWithBatchCount += RequestsThisTick;
+
+		TickCount++;
+		CurrentTimeInSeconds += TELEMETRY_REPLAY_TEST_TICK_SECONDS;
+	}
+	const double DrainSeconds = CurrentTimeInSeconds - StartTimeInSeconds;
+
+	UE_LOG_AB(Log, TEXT("[%s] %d events: %d requests averaging %lld bytes (largest %d bytes, %d events) over %d ticks and %.2f s, unbatched %d requests averaging %lld bytes")
+		, GetResultTag()
+		, TotalEventCount
+		, Endpoint.RequestCount
+		, Endpoint.RequestCount > 0 ? Endpoint.TotalBytes / Endpoint.RequestCount : 0
+		, Endpoint.MaxRequestBytes
+		, Endpoint.MaxRequestEvents
+		, TickCount
+		, DrainSeconds
+		, TotalEventCount
+		, UnbatchedTotalBytes / TotalEventCount);
+
+	Check(TEXT("Events stay in the spill queue until their batch is handed over"), bIsQueuedWhileSent);
+	Check(TEXT("Events leave the spill queue once their batch is handed over"), bIsCommittedOnceSent);
+	Check(FString::Printf(TEXT("Replay drained within %d ticks, %d events left"), MaxTickCount, Queue.GetEventCount())
+		, Batcher.GetReplayCount() == 0 && Queue.GetEventCount() == 0);
+	Check(TEXT("Every event arrived once and in order, under its own local user"), Endpoint.LocalUserNumToReceivedIndices.FindRef(0) == ExpectedFirstUserIndices
+		&& Endpoint.LocalUserNumToReceivedIndices.FindRef(1) == ExpectedSecondUserIndices
+		&& !Endpoint.LocalUserNumToReceivedIndices.Contains(2)
+		&& Endpoint.TotalBytes == UnbatchedTotalBytes);
+	Check(TEXT("No batch went past the limits without being a single oversized event"), !Endpoint.bHasOversizedRequest);
+
+	// Every batch but the last of each local user is full by count or by size, apart from those cut short by the oversized
+	// event, which adds one batch of its own and may end the one before it early
+	const int64 MaxRequestCount = FMath::DivideAndRoundUp(UnbatchedTotalBytes, static_cast<int64>(MaxBatchSize))
+		+ FMath::DivideAndRoundUp(TotalEventCount, MaxBatchEvents)
+		+ 2
+		+ 1;
+	Check(FString::Printf(TEXT("Request count %d is within the %lld that the batch limits allow"), Endpoint.RequestCount, MaxRequestCount)
+		, Endpoint.RequestCount >= FMath::DivideAndRoundUp(EventCount, MaxBatchEvents) && Endpoint.RequestCount <= MaxRequestCount);
+	Check(FString::Printf(TEXT("Request count %d is below the %d of sending every event on its own"), Endpoint.RequestCount, TotalEventCount)
+		, Endpoint.RequestCount < TotalEventCount);
+	Check(TEXT("Batches are paced by the interval and spread over several ticks"), bOneBatchPerTick
+		&& !Endpoint.bHasEarlyRequest
+		&& (Endpoint.RequestCount <= 1 || TicksWithBatchCount < TickCount));
+
+	// A local user with nothing to replay still costs a peek, which is paced like a batch so that it is not repeated
+	// every tick
+	const auto SendNothing = [](int32, const TArray<TSharedPtr<FAccelByteModelsTelemetryBody>>&, int32) {};
+	Queue.Enqueue(3, MakeReplayTestEvent(0, 100));
+	Batcher.Add(4);
+	Batcher.Add(3);
+	const double EmptyPeekTimeInSeconds = CurrentTimeInSeconds + TELEMETRY_REPLAY_TEST_BATCH_INTERVAL_SECONDS;
+	const int32 EmptyPeekSentCount = Batcher.Tick(EmptyPeekTimeInSeconds, Queue, SendNothing);
+	const int32 NextTickSentCount = Batcher.Tick(EmptyPeekTimeInSeconds + TELEMETRY_REPLAY_TEST_TICK_SECONDS, Queue, SendNothing);
+	const int32 NextIntervalSentCount = Batcher.Tick(EmptyPeekTimeInSeconds + TELEMETRY_REPLAY_TEST_BATCH_INTERVAL_SECONDS, Queue, SendNothing);
+	Check(TEXT("A tick that finds nothing to send waits the batch interval"), EmptyPeekSentCount == 0
+		&& NextTickSentCount == 0
+		&& NextIntervalSentCount == 1
+		&& Batcher.GetReplayCount() == 0
+		&& Queue.GetEventCount() == 0);
+
+	IFileManager::Get().Delete(*FilePath);
+	return CompleteTest();
+}
+
+#undef TELEMETRY_REPLAY_TEST_TICK_SECONDS
+#undef TELEMETRY_REPLAY_TEST_BATCH_INTERVAL_SECONDS
+#undef TELEMETRY_REPLAY_TEST_MAX_IN_MEMORY_EVENTS
+#undef TELEMETRY_REPLAY_TEST_MAX_TEXT_LENGTH
+
+#endif
@@ -0,0 +1,62 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test for the batched replay of telemetry events cached before login.
+ *
+ * Replays the given amount of cached events of varying sizes for two local users from a spill queue backed by a file into
+ * a stand-in for the telemetry endpoint, which counts the requests it receives and their payload sizes, while ticking at
+ * 60 frames per second. Checks that every event arrives once and in order, that events stay in the spill queue until
+ * their batch is handed over, that no batch goes past the batch limits unless it holds a single oversized event, that
+ * the request count stays within what the batch limits allow and below sending every event on its own, that batches are
+ * at least the batch interval apart and are spread over several ticks, that a tick which finds nothing to send waits
+ * the batch interval as well, and that logging a local user out drops its events before they are sent. Logs the
+ * requests and bytes per request against sending every event on its own.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST TELEMETRYREPLAYBATCH [EventCount] [MaxBatchEvents] [MaxBatchSizeKB]
+ */
+class FExecTestTelemetryReplayBatch : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the telemetry replay batch test.
+	 *
+	 * @param InEventCount Amount of cached events replayed
+	 * @param InMaxBatchEvents Maximum amount of events in a single batch
+	 * @param InMaxBatchSizeKB Maximum estimated size of a single batch in kilobytes
+	 */
+	FExecTestTelemetryReplayBatch(UWorld* InWorld, const FName& InSubsystemName, int32 InEventCount, int32 InMaxBatchEvents, int32 InMaxBatchSizeKB);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("TELEMETRYREPLAYBATCH");
+	}
+
+private:
+
+	/** Amount of cached events replayed */
+	int32 EventCount;
+
+	/** Maximum amount of events in a single batch */
+	int32 MaxBatchEvents;
+
+	/** Maximum estimated size of a single batch in kilobytes */
+	int32 MaxBatchSizeKB;
+
+};
+
+#endif
@@ -0,0 +1,427 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestTelemetrySpill.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "Utilities/AccelByteTelemetrySpillQueue.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+/** Size that the spill file header takes up, a file holding no events is this size */
+#define TELEMETRY_SPILL_TEST_HEADER_SIZE 8
+
+/** Maximum size of the spill file in the runs that are not about the size limit */
+#define TELEMETRY_SPILL_TEST_MAX_FILE_SIZE (1024 * 1024 * 1024)
+
+/** Amount of large events queued to check that a single peek reads a bounded part of the file, well over a megabyte */
+#define TELEMETRY_SPILL_TEST_LARGE_EVENT_COUNT 40
+
+#define TELEMETRY_SPILL_TEST_LARGE_EVENT_PADDING (64 * 1024)
+
+/** Amount of events queued to check when the file is compacted, well past the committed records that the queue lets pile up */
+#define TELEMETRY_SPILL_TEST_COMPACT_EVENT_COUNT 4096
+
+/** Amount of events peeked and committed at once in the compaction run */
+#define TELEMETRY_SPILL_TEST_COMMIT_STEP 256
+
+/** Amount of events queued for each of the local users whose events a later run drops, one with another owner and one with none */
+#define TELEMETRY_SPILL_TEST_UNOWNED_EVENT_COUNT 4
+
+static TSharedPtr<FAccelByteModelsTelemetryBody> MakeTestEvent(int32 Index, const FDateTime& BaseTimestamp, int32 PaddingSize = 0)
+{
+	TSharedPtr<FAccelByteModelsTelemetryBody> Event = MakeShared<FAccelByteModelsTelemetryBody>();
+	Event->EventNamespace = TEXT("exectest");
+	Event->EventName = FString::Printf(TEXT("TelemetrySpill_%d"), Index);
+	Event->ClientTimestamp = BaseTimestamp + FTimespan::FromSeconds(Index);
+	Event->Payload = MakeShared<FJsonObject>();
+	Event->Payload->SetStringField(TEXT("PreDefinedEventName"), TEXT("TelemetrySpill"));
+	Event->Payload->SetNumberField(TEXT("Index"), Index);
+	Event->Payload->SetStringField(TEXT("Text"), FString::Printf(TEXT("Event \"%d\" \u00e9\u65e5"), Index));
+	if (PaddingSize > 0)
+	{
+		Event->Payload->SetStringField(TEXT("Padding"), FString::ChrN(PaddingSize, TEXT('x')));
+	}
+	return Event;
+}
+
+/** Whether a replayed event is the one that MakeTestEvent made for an index */
+static bool IsTestEvent(const TSharedPtr<FAccelByteModelsTelemetryBody>& Event, int32 Index, const FDateTime& BaseTimestamp)
+{
+	int32 PayloadIndex = INDEX_NONE;
+	FString Text;
+	return Event.IsValid()
+		&& Event->Payload.IsValid()
+		&& Event->EventNamespace == TEXT("exectest")
+		&& Event->EventName == FString::Printf(TEXT("TelemetrySpill_%d"), Index)
+		&& Event->ClientTimestamp == BaseTimestamp + FTimespan::FromSeconds(Index)
+		&& Event->Payload->TryGetNumberField(TEXT("Index"), PayloadIndex)
+		&& PayloadIndex == Index
+		&& Event->Payload->TryGetStringField(TEXT("Text"), Text)
+		&& Text == FString::Printf(TEXT("Event \"%d\" \u00e9\u65e5"), Index);
+}
+
+/** Whether peeked events are exactly the expected ones in order, starting at an index of those */
+static bool PeekMatches(const FAccelByteTelemetrySpillQueue::FPeekedEvents& Peeked, const TArray<int32>& ExpectedIndices, int32 StartIndex, const FDateTime& BaseTimestamp)
+{
+	for (int32 Index = 0; Index < Peeked.Events.Num(); Index++)
+	{
+		if (!ExpectedIndices.IsValidIndex(StartIndex + Index) || !IsTestEvent(Peeked.Events[Index], ExpectedIndices[StartIndex + Index], BaseTimestamp))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Replay the events of a local user, and check that they are exactly the expected ones in order.
+ *
+ * @param bOutWasUnlocked Set to whether another thread could get into the queue from the replay function
+ */
+static bool ReplayMatches(FAccelByteTelemetrySpillQueue& Queue, int32 LocalUserNum, const TArray<int32>& ExpectedIndices, const FDateTime& BaseTimestamp, bool* bOutWasUnlocked = nullptr)
+{
+	int32 ReplayedCount = 0;
+	bool bMatches = true;
+	const int32 TakenCount = Queue.ReplayEvents(LocalUserNum, [&](const TSharedPtr<FAccelByteModelsTelemetryBody>& Event)
+	{
+		if (ReplayedCount == 0 && bOutWasUnlocked != nullptr)
+		{
+			*bOutWasUnlocked = Async(EAsyncExecution::Thread, [&Queue]() { return Queue.GetEventCount(); }).WaitFor(FTimespan::FromSeconds(5.0));
+		}
+
+		bMatches &= ExpectedIndices.IsValidIndex(ReplayedCount) && IsTestEvent(Event, ExpectedIndices[ReplayedCount], BaseTimestamp);
+		ReplayedCount++;
+	});
+	return bMatches && ReplayedCount == ExpectedIndices.Num() && TakenCount == ExpectedIndices.Num();
+}
+
+FExecTestTelemetrySpill::FExecTestTelemetrySpill(UWorld* InWorld, const FName& InSubsystemName, int32 InEventCount, int32 InMaxInMemoryEvents)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, EventCount(InEventCount)
+	, MaxInMemoryEvents(InMaxInMemoryEvents)
+{
+}
+
+bool FExecTestTelemetrySpill::Run()
+{
+	if (EventCount < 8 || MaxInMemoryEvents <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestTelemetrySpill, event count %d must be at least 8 and max in memory events %d must be positive"), EventCount, MaxInMemoryEvents);
+		return CompleteTest(false);
+	}
+
+	FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByte"), TEXT("ExecTestTelemetrySpill.bin"));
+	IFileManager::Get().Delete(*FilePath);
+	BaseTimestamp = FDateTime(2024, 1, 1);
+
+	RunMemoryChecks();
+	RunSpillChecks();
+	RunBoundedPeekChecks();
+	RunCompactionChecks();
+	RunTornFileChecks();
+	RunSizeLimitChecks();
+
+	IFileManager::Get().Delete(*FilePath);
+	return CompleteTest();
+}
+
+void FExecTestTelemetrySpill::RunMemoryChecks()
+{
+	// Without a spill file, events past the maximum are dropped, and those kept follow the temporary local user over
+	FAccelByteTelemetrySpillQueue Queue(MaxInMemoryEvents);
+	TArray<int32> ExpectedIndices;
+	for (int32 Index = 0; Index < MaxInMemoryEvents + 10; Index++)
+	{
+		Queue.Enqueue(-1, MakeTestEvent(Index, BaseTimestamp));
+		if (Index < MaxInMemoryEvents)
+		{
+			ExpectedIndices.Add(Index);
+		}
+	}
+	Queue.MoveEvents(-1, 0);
+
+	Check(FString::Printf(TEXT("Memory only queue dropped %d events past its maximum, holds %d"), Queue.GetDroppedEventCount(), Queue.GetInMemoryEventCount())
+		, Queue.GetDroppedEventCount() == 10 && Queue.GetInMemoryEventCount() == MaxInMemoryEvents);
+	Check(TEXT("Memory only queue moved every event off the temporary local user"), Queue.RemoveEvents(-1) == 0);
+
+	bool bWasUnlocked = false;
+	Check(TEXT("Memory only queue replays its events in order"), ReplayMatches(Queue, 0, ExpectedIndices, BaseTimestamp, &bWasUnlocked) && Queue.GetEventCount() == 0);
+	Check(TEXT("Memory only queue replays without holding its lock"), bWasUnlocked);
+}
+
+void FExecTestTelemetrySpill::RunSpillChecks()
+{
+	// The first half is queued before the local user is known, the second half goes to two local users, one of which
+	// gets a quarter of it
+	TArray<int32> FirstUserIndices;
+	TArray<int32> SecondUserIndices;
+	TArray<uint8> CrashedFileBytes;
+	{
+		FAccelByteTelemetrySpillQueue Queue(MaxInMemoryEvents);
+		Check(TEXT("Spill file opens empty"), Queue.OpenSpillFile(FilePath, TELEMETRY_SPILL_TEST_MAX_FILE_SIZE) && Queue.GetEventCount() == 0);
+
+		int32 MaxInMemoryEventCount = 0;
+		const double StartSeconds = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < EventCount; Index++)
+		{
+			const bool bIsFirstHalf = Index < EventCount / 2;
+			const int32 LocalUserNum = (bIsFirstHalf || Index % 4 != 0) ? -1 : 1;
+			Queue.Enqueue(LocalUserNum, MakeTestEvent(Index, BaseTimestamp));
+			(LocalUserNum == 1 ? SecondUserIndices : FirstUserIndices).Add(Index);
+			MaxInMemoryEventCount = FMath::Max(MaxInMemoryEventCount, Queue.GetInMemoryEventCount());
+
+			if (Index == EventCount / 2 - 1)
+			{
+				Queue.MoveEvents(-1, 0);
+			}
+		}
+		const double EnqueueSeconds = FPlatformTime::Seconds() - StartSeconds;
+		SpilledFileSize = Queue.GetSpillFileSize();
+		Queue.MoveEvents(-1, 0);
+
+		UE_LOG_AB(Log, TEXT("[%s] %d events with %d in memory: %.3f us per queued event, %lld bytes spilled")
+			, GetResultTag()
+			, EventCount
+			, MaxInMemoryEvents
+			, EnqueueSeconds * 1000000.0 / EventCount
+			, SpilledFileSize);
+
+		Check(FString::Printf(TEXT("Spilling queue held at most %d events in memory"), MaxInMemoryEventCount), MaxInMemoryEventCount <= MaxInMemoryEvents);
+		Check(TEXT("Spilling queue kept every event"), Queue.GetEventCount() == EventCount && Queue.GetDroppedEventCount() == 0);
+
+		bool bWasUnlocked = false;
+		Check(TEXT("Spilled events of a local user replay in order"), ReplayMatches(Queue, 1, SecondUserIndices, BaseTimestamp, &bWasUnlocked)
+			&& Queue.GetEventCount() == FirstUserIndices.Num());
+		Check(TEXT("Spilled events replay without holding the lock"), bWasUnlocked);
+
+		// Records of committed events are only dropped once they make up most of the file
+		Check(FString::Printf(TEXT("Committed events stay in the file until they make up most of it, %lld bytes of %lld"), Queue.GetSpillFileSize(), SpilledFileSize)
+			, Queue.GetSpillFileSize() >= SpilledFileSize);
+
+		FAccelByteTelemetrySpillQueue::FPeekedEvents Peeked;
+		Check(TEXT("Peek reads the oldest events without removing them"), Queue.PeekEvents(0, 2, Peeked) == 2
+			&& PeekMatches(Peeked, FirstUserIndices, 0, BaseTimestamp)
+			&& Queue.GetEventCount() == FirstUserIndices.Num());
+
+		FAccelByteTelemetrySpillQueue::FPeekedEvents PeekedAgain;
+		Check(TEXT("Uncommitted events are peeked again"), Queue.PeekEvents(0, 2, PeekedAgain) == 2 && PeekMatches(PeekedAgain, FirstUserIndices, 0, BaseTimestamp));
+
+		const int64 PeekedFileSize = Queue.GetSpillFileSize();
+		Check(TEXT("Commit removes only the committed part of a peek"), Queue.CommitEvents(Peeked, 1) == 1 && Queue.GetEventCount() == FirstUserIndices.Num() - 1);
+		Check(TEXT("Commit leaves the spill file as it is"), Queue.GetSpillFileSize() == PeekedFileSize);
+		Check(TEXT("Events committed twice are only removed once"), Queue.CommitEvents(PeekedAgain, 1) == 0 && Queue.GetEventCount() == FirstUserIndices.Num() - 1);
+		Check(TEXT("Peek after a commit starts past the committed events"), Queue.PeekEvents(0, 1, Peeked) == 1 && PeekMatches(Peeked, FirstUserIndices, 1, BaseTimestamp));
+
+		// The first local user logs in, another one logs in as someone else, and a third never does
+		Queue.SetOwner(0, TEXT("TelemetrySpillOwner"));
+		Queue.SetOwner(2, TEXT("TelemetrySpillOtherOwner"));
+		for (int32 Index = 0; Index < TELEMETRY_SPILL_TEST_UNOWNED_EVENT_COUNT; Index++)
+		{
+			Queue.Enqueue(2, MakeTestEvent(EventCount + Index, BaseTimestamp));
+			Queue.Enqueue(5, MakeTestEvent(EventCount + TELEMETRY_SPILL_TEST_UNOWNED_EVENT_COUNT + Index, BaseTimestamp));
+		}
+		Check(TEXT("Setting an owner keeps every event"), Queue.GetEventCount() == FirstUserIndices.Num() - 1 + TELEMETRY_SPILL_TEST_UNOWNED_EVENT_COUNT * 2);
+
+		// Copied while the queue is still around, as a crash would leave the file without the buffered events
+		FFileHelper::LoadFileToArray(CrashedFileBytes, *FilePath);
+	}
+
+	// The queue went away with a peek that was never committed, as a quit mid send does. Those events are written out
+	// along with the buffered ones, and only go to the local user of the same owner, while the committed ones do not
+	// come back.
+	FirstUserIndices.RemoveAt(0);
+	const int32 UnownedEventCount = TELEMETRY_SPILL_TEST_UNOWNED_EVENT_COUNT * 2;
+	{
+		FAccelByteTelemetrySpillQueue Queue(MaxInMemoryEvents);
+		Check(TEXT("Restarted queue picks up every event that was not committed"), Queue.OpenSpillFile(FilePath, TELEMETRY_SPILL_TEST_MAX_FILE_SIZE)
+			&& Queue.GetEventCount() == FirstUserIndices.Num() + UnownedEventCount);
+		Check(TEXT("Removing events of a local user keeps those of a previous run"), Queue.RemoveEvents(3) == 0
+			&& Queue.GetEventCount() == FirstUserIndices.Num() + UnownedEventCount);
+		Check(TEXT("Events of a previous run are not counted for a local user without an owner"), Queue.GetEventCount(3) == 0);
+
+		Queue.SetOwner(3, TEXT("TelemetrySpillOwner"));
+		Check(TEXT("Events of a previous run replay in order to the local user of their owner"), ReplayMatches(Queue, 3, FirstUserIndices, BaseTimestamp)
+			&& Queue.GetEventCount() == 0);
+		Check(FString::Printf(TEXT("Events of a previous run without an owner or of another owner are dropped, %d of %d"), Queue.GetDroppedEventCount(), UnownedEventCount)
+			, Queue.GetDroppedEventCount() == UnownedEventCount);
+		Check(TEXT("File is reset once every event is consumed"), Queue.GetSpillFileSize() == TELEMETRY_SPILL_TEST_HEADER_SIZE);
+	}
+
+	// After a crash the buffered events are lost, while the spilled ones come back with the owner that was set since
+	if (!Check(TEXT("Spill file is readable while the queue is open"), CrashedFileBytes.Num() >= TELEMETRY_SPILL_TEST_HEADER_SIZE))
+	{
+		return;
+	}
+	FFileHelper::SaveArrayToFile(CrashedFileBytes, *FilePath);
+
+	FAccelByteTelemetrySpillQueue Queue(MaxInMemoryEvents);
+	Queue.OpenSpillFile(FilePath, TELEMETRY_SPILL_TEST_MAX_FILE_SIZE);
+	Queue.SetOwner(3, TEXT("TelemetrySpillOwner"));
+
+	int32 ReplayedCount = 0;
+	bool bMatches = true;
+	Queue.ReplayEvents(3, [&](const TSharedPtr<FAccelByteModelsTelemetryBody>& Event)
+	{
+		bMatches &= FirstUserIndices.IsValidIndex(ReplayedCount) && IsTestEvent(Event, FirstUserIndices[ReplayedCount], BaseTimestamp);
+		ReplayedCount++;
+	});
+	Check(FString::Printf(TEXT("Spilled events of an owner replay in order after a crash, %d of %d"), ReplayedCount, FirstUserIndices.Num())
+		, bMatches && (ReplayedCount > 0 || SpilledFileSize <= TELEMETRY_SPILL_TEST_HEADER_SIZE) && Queue.GetEventCount() == 0);
+}
+
+void FExecTestTelemetrySpill::RunBoundedPeekChecks()
+{
+	IFileManager::Get().Delete(*FilePath);
+
+	// Nothing is kept in memory, so that peeks read the file
+	FAccelByteTelemetrySpillQueue Queue(0);
+	Queue.OpenSpillFile(FilePath, TELEMETRY_SPILL_TEST_MAX_FILE_SIZE);
+	TArray<int32> ExpectedIndices;
+	for (int32 Index = 0; Index < TELEMETRY_SPILL_TEST_LARGE_EVENT_COUNT; Index++)
+	{
+		Queue.Enqueue(0, MakeTestEvent(Index, BaseTimestamp, TELEMETRY_SPILL_TEST_LARGE_EVENT_PADDING));
+		ExpectedIndices.Add(Index);
+	}
+
+	FAccelByteTelemetrySpillQueue::FPeekedEvents Peeked;
+	const int32 PeekedCount = Queue.PeekEvents(0, MAX_int32, Peeked);
+	Check(FString::Printf(TEXT("Single peek of a %lld byte file reads part of it, %d of %d events"), Queue.GetSpillFileSize(), PeekedCount, TELEMETRY_SPILL_TEST_LARGE_EVENT_COUNT)
+		, PeekedCount > 0 && PeekedCount < TELEMETRY_SPILL_TEST_LARGE_EVENT_COUNT && PeekMatches(Peeked, ExpectedIndices, 0, BaseTimestamp));
+	Check(TEXT("Large events replay in order over several reads"), ReplayMatches(Queue, 0, ExpectedIndices, BaseTimestamp) && Queue.GetEventCount() == 0);
+}
+
+void FExecTestTelemetrySpill::RunCompactionChecks()
+{
+	IFileManager::Get().Delete(*FilePath);
+
+	FAccelByteTelemetrySpillQueue Queue(0);
+	Queue.OpenSpillFile(FilePath, TELEMETRY_SPILL_TEST_MAX_FILE_SIZE);
+	TArray<int32> ExpectedIndices;
+	for (int32 Index = 0; Index < TELEMETRY_SPILL_TEST_COMPACT_EVENT_COUNT; Index++)
+	{
+		Queue.Enqueue(0, MakeTestEvent(Index, BaseTimestamp));
+		ExpectedIndices.Add(Index);
+	}
+	const int64 FullFileSize = Queue.GetSpillFileSize();
+
+	FAccelByteTelemetrySpillQueue::FPeekedEvents Peeked;
+	Queue.PeekEvents(0, TELEMETRY_SPILL_TEST_COMMIT_STEP, Peeked);
+	int32 CommittedCount = Queue.CommitEvents(Peeked, Peeked.Events.Num());
+	Check(FString::Printf(TEXT("Committing a few events leaves the file as it is, %lld bytes of %lld"), Queue.GetSpillFileSize(), FullFileSize)
+		, CommittedCount == TELEMETRY_SPILL_TEST_COMMIT_STEP && Queue.GetSpillFileSize() == FullFileSize);
+
+	bool bPeeksMatch = true;
+	while (CommittedCount <= TELEMETRY_SPILL_TEST_COMPACT_EVENT_COUNT / 2)
+	{
+		const int32 PeekedCount = Queue.PeekEvents(0, TELEMETRY_SPILL_TEST_COMMIT_STEP, Peeked);
+		bPeeksMatch &= PeekedCount > 0 && PeekMatches(Peeked, ExpectedIndices, CommittedCount, BaseTimestamp);
+		if (!bPeeksMatch)
+		{
+			break;
+		}
+		CommittedCount += Queue.CommitEvents(Peeked, PeekedCount);
+	}
+
+	Check(FString::Printf(TEXT("File is compacted once most of it is committed, %lld bytes of %lld"), Queue.GetSpillFileSize(), FullFileSize)
+		, bPeeksMatch && Queue.GetSpillFileSize() < FullFileSize);
+
+	ExpectedIndices.RemoveAt(0, CommittedCount);
+	Check(TEXT("Events left after compaction replay in order"), ReplayMatches(Queue, 0, ExpectedIndices, BaseTimestamp) && Queue.GetEventCount() == 0);
+}
+
+void FExecTestTelemetrySpill::RunTornFileChecks()
+{
+	// A crash mid write leaves the last record cut short, possibly followed by bytes that never made it to a record
+	const int32 TornEventCount = FMath::Min(EventCount, MaxInMemoryEvents + 4);
+	{
+		IFileManager::Get().Delete(*FilePath);
+		FAccelByteTelemetrySpillQueue Queue(MaxInMemoryEvents);
+		Queue.OpenSpillFile(FilePath, TELEMETRY_SPILL_TEST_MAX_FILE_SIZE);
+		Queue.SetOwner(0, TEXT("TelemetrySpillOwner"));
+		for (int32 Index = 0; Index < TornEventCount; Index++)
+		{
+			Queue.Enqueue(0, MakeTestEvent(Index, BaseTimestamp));
+		}
+	}
+	{
+		TArray<uint8> Bytes;
+		if (!Check(TEXT("Spill file is written"), FFileHelper::LoadFileToArray(Bytes, *FilePath) && Bytes.Num() > 16))
+		{
+			return;
+		}
+		Bytes.SetNum(Bytes.Num() - 5);
+		Bytes.Append({0xde, 0xad, 0xbe, 0xef});
+		FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+
+		TArray<int32> ExpectedIndices;
+		for (int32 Index = 0; Index < TornEventCount - 1; Index++)
+		{
+			ExpectedIndices.Add(Index);
+		}
+		ExpectedIndices.Add(EventCount);
+
+		FAccelByteTelemetrySpillQueue Queue(MaxInMemoryEvents);
+		Check(TEXT("Torn tail is cut back to the last valid record"), Queue.OpenSpillFile(FilePath, TELEMETRY_SPILL_TEST_MAX_FILE_SIZE)
+			&& Queue.GetEventCount() == TornEventCount - 1
+			&& Queue.GetSpillFileSize() < Bytes.Num() - 4);
+		Queue.SetOwner(1, TEXT("TelemetrySpillOwner"));
+		Queue.Enqueue(1, MakeTestEvent(EventCount, BaseTimestamp));
+		Check(TEXT("Events queued after a torn tail replay along with those before it"), Queue.GetEventCount() == TornEventCount
+			&& ReplayMatches(Queue, 1, ExpectedIndices, BaseTimestamp));
+	}
+
+	// A file cut short within its header holds nothing that can be trusted, and is started over
+	const TArray<uint8> Bytes = {0x41, 0x42, 0x54, 0x53, 0x01};
+	FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+
+	FAccelByteTelemetrySpillQueue Queue(MaxInMemoryEvents);
+	Check(TEXT("Torn header starts the file over"), Queue.OpenSpillFile(FilePath, TELEMETRY_SPILL_TEST_MAX_FILE_SIZE)
+		&& Queue.GetEventCount() == 0
+		&& Queue.GetSpillFileSize() == TELEMETRY_SPILL_TEST_HEADER_SIZE);
+	Queue.Enqueue(0, MakeTestEvent(0, BaseTimestamp));
+	Check(TEXT("Events queued after a torn header replay"), ReplayMatches(Queue, 0, {0}, BaseTimestamp));
+}
+
+void FExecTestTelemetrySpill::RunSizeLimitChecks()
+{
+	// Events that would take the file past its maximum size are dropped, and the file stays readable
+	IFileManager::Get().Delete(*FilePath);
+	int64 RecordSize = 0;
+	{
+		FAccelByteTelemetrySpillQueue Queue(0);
+		Queue.OpenSpillFile(FilePath, TELEMETRY_SPILL_TEST_MAX_FILE_SIZE);
+		Queue.Enqueue(0, MakeTestEvent(0, BaseTimestamp));
+		RecordSize = Queue.GetSpillFileSize() - TELEMETRY_SPILL_TEST_HEADER_SIZE;
+		Queue.RemoveEvents(0);
+	}
+	IFileManager::Get().Delete(*FilePath);
+
+	// Nothing is kept in memory, so that every event goes to the file. The first few records are the same size.
+	const int64 MaxFileSize = TELEMETRY_SPILL_TEST_HEADER_SIZE + RecordSize * 3 + RecordSize / 2;
+	FAccelByteTelemetrySpillQueue Queue(0);
+	Queue.OpenSpillFile(FilePath, MaxFileSize);
+	for (int32 Index = 0; Index < EventCount; Index++)
+	{
+		Queue.Enqueue(0, MakeTestEvent(Index, BaseTimestamp));
+	}
+	Check(FString::Printf(TEXT("Events past the maximum file size are dropped, %d of %d"), Queue.GetDroppedEventCount(), EventCount)
+		, Queue.GetEventCount() == 3
+		&& Queue.GetEventCount() + Queue.GetDroppedEventCount() == EventCount
+		&& Queue.GetSpillFileSize() <= MaxFileSize);
+	Check(TEXT("Events kept in a full file replay in order"), ReplayMatches(Queue, 0, {0, 1, 2}, BaseTimestamp));
+}
+
+#undef TELEMETRY_SPILL_TEST_HEADER_SIZE
+#undef TELEMETRY_SPILL_TEST_MAX_FILE_SIZE
+#undef TELEMETRY_SPILL_TEST_LARGE_EVENT_COUNT
+#undef TELEMETRY_SPILL_TEST_LARGE_EVENT_PADDING
+#undef TELEMETRY_SPILL_TEST_COMPACT_EVENT_COUNT
+#undef TELEMETRY_SPILL_TEST_COMMIT_STEP
+#undef TELEMETRY_SPILL_TEST_UNOWNED_EVENT_COUNT
+
+#endif
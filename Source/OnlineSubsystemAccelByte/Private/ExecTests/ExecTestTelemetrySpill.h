@@ -0,0 +1,82 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test for the queue that holds telemetry events sent before login, spilling them to disk past a bound in memory.
+ *
+ * Queues the given amount of events and checks that they are replayed in order with their payloads intact, both while
+ * they fit in memory and once they have spilled, including events moved from the temporary local user, and that the
+ * replay function is called without the lock of the queue held. Checks that peeked events stay queued until committed,
+ * that committing leaves the file as it is until most of it is committed, and that a single peek reads a bounded part of
+ * a large file. Checks that a new queue on the same file hands every event the previous one did not commit to the local
+ * user of the same owner, drops those without an owner or of another owner, and that the spilled events of an owner come
+ * back after a crash. Also checks that a file cut short mid record by a crash keeps every record before the torn one and
+ * accepts new events after it, that a file with a torn header is started over, and that events past the maximum file
+ * size are dropped.
+ * Logs the time taken to queue an event.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST TELEMETRYSPILL [EventCount] [MaxInMemoryEvents]
+ */
+class FExecTestTelemetrySpill : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the telemetry spill test.
+	 *
+	 * @param InEventCount Amount of events queued before login
+	 * @param InMaxInMemoryEvents Maximum amount of events held in memory
+	 */
+	FExecTestTelemetrySpill(UWorld* InWorld, const FName& InSubsystemName, int32 InEventCount, int32 InMaxInMemoryEvents);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("TELEMETRYSPILL");
+	}
+
+private:
+
+	/** Amount of events queued before login */
+	int32 EventCount;
+
+	/** Maximum amount of events held in memory */
+	int32 MaxInMemoryEvents;
+
+	/** Spill file shared by every run, deleted once the test is done */
+	FString FilePath;
+
+	/** Client timestamp of the first test event, later ones are a second apart */
+	FDateTime BaseTimestamp;
+
+	/** Size of the spill file once every event of the spill run was queued */
+	int64 SpilledFileSize = 0;
+
+	void RunMemoryChecks();
+
+	void RunSpillChecks();
+
+	void RunBoundedPeekChecks();
+
+	void RunCompactionChecks();
+
+	/** Check files cut short by a crash, either mid record or within the header */
+	void RunTornFileChecks();
+
+	void RunSizeLimitChecks();
+
+};
+
+#endif
@@ -0,0 +1,266 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestUniqueIdBenchmark.h"
+#include "OnlineSubsystemAccelByteDefines.h"
+#include "Utilities/AccelByteUniqueIdCompactCodec.h"
+#include "Misc/Guid.h"
+#include "Misc/Base64.h"
+#include "Math/RandomStream.h"
+#include "JsonObjectConverter.h"
+
+FExecTestUniqueIdBenchmark::FExecTestUniqueIdBenchmark(UWorld* InWorld, const FName& InSubsystemName, int32 InCount, int32 InDistinctCount)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, Count(InCount)
+	, DistinctCount(InDistinctCount)
+{
+}
+
+bool FExecTestUniqueIdBenchmark::Run()
+{
+	if (Count <= 0 || DistinctCount <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestUniqueIdBenchmark, count %d and distinct count %d must be positive"), Count, DistinctCount);
+		return CompleteTest(false);
+	}
+
+	// Build the encoded strings with interning disabled, so that the first measurement starts from an empty table
+	FUniqueNetIdAccelByteUser::SetInterningEnabled(false);
+
+	Composites.Reserve(DistinctCount);
+	EncodedStrings.Reserve(DistinctCount);
+	for (int32 Index = 0; Index < DistinctCount; Index++)
+	{
+		const FString AccelByteId = FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+		// Mix known, custom and missing platform types, so that every branch of the compact form is exercised
+		const TCHAR* PlatformType = (Index % 3 == 0) ? TEXT("STEAM") : (Index % 3 == 1) ? TEXT("CustomPlatform") : TEXT("");
+		const FString PlatformId = (*PlatformType == TEXT('\0')) ? FString() : FString::Printf(TEXT("%llu"), 76561197960265728ull + Index);
+		const FAccelByteUniqueIdComposite& Composite = Composites.Emplace_GetRef(AccelByteId, PlatformType, PlatformId);
+		EncodedStrings.Add(FUniqueNetIdAccelByteUser::Create(Composite)->ToString());
+	}
+
+	RunMeasurements(false);
+
+	FUniqueNetIdAccelByteUser::SetInterningEnabled(true);
+	RunMeasurements(true);
+
+	RunCompactEncodingMeasurements();
+
+	return CompleteTest();
+}
+
+void FExecTestUniqueIdBenchmark::RunMeasurements(bool bInterningEnabled)
+{
+	// Keep one instance of every distinct ID alive, like the user cache would
+	TArray<FUniqueNetIdAccelByteUserRef> LiveIds;
+	LiveIds.Reserve(DistinctCount);
+	for (const FAccelByteUniqueIdComposite& Composite : Composites)
+	{
+		LiveIds.Add(FUniqueNetIdAccelByteUser::Create(Composite));
+	}
+
+	int32 MismatchCount = 0;
+	for (int32 Index = 0; Index < DistinctCount; Index++)
+	{
+		const FUniqueNetIdAccelByteUserRef FromString = FUniqueNetIdAccelByteUser::Create(EncodedStrings[Index]);
+		MismatchCount += (LiveIds[Index]->Compare(FromString.Get()) && GetTypeHash(LiveIds[Index].Get()) == GetTypeHash(FromString.Get())) ? 0 : 1;
+	}
+	Check(FString::Printf(TEXT("%d of %d IDs created from their string differ from the ID created from their composite"), MismatchCount, DistinctCount)
+		, MismatchCount == 0);
+
+	// Accumulated from every result so that none of the timed work can be optimized away
+	uint64 Checksum = 0;
+
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		Checksum += FUniqueNetIdAccelByteUser::Create(Composites[Index % DistinctCount])->GetAccelByteId().Len();
+	}
+	const double CreateFromCompositeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		Checksum += FUniqueNetIdAccelByteUser::Create(EncodedStrings[Index % DistinctCount])->GetAccelByteId().Len();
+	}
+	const double CreateFromStringSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Half of the comparisons are between equal IDs and half between different ones
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		const FUniqueNetIdAccelByteUserRef& IdA = LiveIds[Index % DistinctCount];
+		const FUniqueNetIdAccelByteUserRef& IdB = LiveIds[((Index & 1) == 0) ? Index % DistinctCount : (Index + 1) % DistinctCount];
+		Checksum += IdA->Compare(IdB.Get()) ? 1 : 0;
+	}
+	const double CompareSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		Checksum += GetTypeHash(LiveIds[Index % DistinctCount].Get());
+	}
+	const double HashSeconds = FPlatformTime::Seconds() - StartTime;
+
+	const double NanosecondsPerOp = 1000000000.0 / Count;
+	UE_LOG_AB(Log, TEXT("[%s] Interning %s, %d operations over %d distinct IDs (checksum %llu)"), GetResultTag()
+		, bInterningEnabled ? TEXT("enabled") : TEXT("disabled"), Count, DistinctCount, Checksum);
+	UE_LOG_AB(Log, TEXT("[%s] Create from composite: %.1f ns/op"), GetResultTag(), CreateFromCompositeSeconds * NanosecondsPerOp);
+	UE_LOG_AB(Log, TEXT("[%s] Create from string: %.1f ns/op"), GetResultTag(), CreateFromStringSeconds * NanosecondsPerOp);
+	UE_LOG_AB(Log, TEXT("[%s] Compare: %.1f ns/op"), GetResultTag(), CompareSeconds * NanosecondsPerOp);
+	UE_LOG_AB(Log, TEXT("[%s] Hash: %.1f ns/op"), GetResultTag(), HashSeconds * NanosecondsPerOp);
+}
+
+void FExecTestUniqueIdBenchmark::RunCompactEncodingMeasurements()
+{
+	const auto MatchesExactly = [](FAccelByteUniqueIdComposite const& A, FAccelByteUniqueIdComposite const& B)
+	{
+		return A.Id.Equals(B.Id, ESearchCase::CaseSensitive)
+			&& A.PlatformType.Equals(B.PlatformType, ESearchCase::CaseSensitive)
+			&& A.PlatformId.Equals(B.PlatformId, ESearchCase::CaseSensitive);
+	};
+
+	// Round trip every distinct ID through both forms, and through user IDs created from the compact string
+	int32 RoundTripFailures = 0;
+	int64 LegacyTotalBytes = 0;
+	int64 CompactTotalBytes = 0;
+	for (int32 Index = 0; Index < DistinctCount; Index++)
+	{
+		const FAccelByteUniqueIdComposite& Composite = Composites[Index];
+
+		TArray<uint8> Bytes;
+		FAccelByteUniqueIdCompactCodec::Encode(Composite, Bytes);
+		CompactTotalBytes += Bytes.Num();
+		LegacyTotalBytes += FTCHARToUTF8(*EncodedStrings[Index]).Length();
+
+		FAccelByteUniqueIdComposite Decoded;
+		int32 BytesRead = 0;
+		const bool bBinaryRoundTrip = FAccelByteUniqueIdCompactCodec::Decode(Bytes.GetData(), Bytes.Num(), Decoded, BytesRead)
+			&& BytesRead == Bytes.Num() && MatchesExactly(Composite, Decoded);
+
+		const FUniqueNetIdAccelByteUserRef FromCompactString = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdCompactCodec::EncodeToString(Composite));
+		const FUniqueNetIdAccelByteUserRef FromLegacyString = FUniqueNetIdAccelByteUser::Create(EncodedStrings[Index]);
+		const bool bStringRoundTrip = MatchesExactly(Composite, FromCompactString->GetCompositeStructure())
+			&& FromCompactString->ToString() == EncodedStrings[Index]
+			&& MatchesExactly(FromCompactString->GetCompositeStructure(), FromLegacyString->GetCompositeStructure());
+
+		if (!bBinaryRoundTrip || !bStringRoundTrip)
+		{
+			RoundTripFailures++;
+			UE_LOG_AB(Warning, TEXT("[%s] Compact ID round trip failed for %s"), GetResultTag(), *Composite.ToString());
+		}
+	}
+
+	// Fuzz the decoder with random buffers and with single byte mutations and truncations of valid buffers. Anything that
+	// decodes has to encode back to the exact bytes that were consumed, or the decoder accepted malformed input.
+	FRandomStream Random(0x0ACCE1B7);
+	int32 FuzzFailures = 0;
+	int32 FuzzDecoded = 0;
+	const int32 FuzzCount = FMath::Min(Count, 100000);
+	for (int32 Index = 0; Index < FuzzCount; Index++)
+	{
+		TArray<uint8> Bytes;
+		if ((Index & 1) == 0)
+		{
+			Bytes.SetNumUninitialized(Random.RandRange(0, 64));
+			for (uint8& Byte : Bytes)
+			{
+				Byte = static_cast<uint8>(Random.RandRange(0, 255));
+			}
+			if (Bytes.Num() > 0 && Random.RandRange(0, 1) == 0)
+			{
+				Bytes[0] = ACCELBYTE_COMPACT_ID_VERSION;
+			}
+		}
+		else
+		{
+			FAccelByteUniqueIdCompactCodec::Encode(Composites[Index % DistinctCount], Bytes);
+			Bytes[Random.RandRange(0, Bytes.Num() - 1)] ^= static_cast<uint8>(Random.RandRange(1, 255));
+			Bytes.SetNum(Random.RandRange(0, Bytes.Num()));
+		}
+
+		FAccelByteUniqueIdComposite Decoded;
+		int32 BytesRead = 0;
+		if (!FAccelByteUniqueIdCompactCodec::Decode(Bytes.GetData(), Bytes.Num(), Decoded, BytesRead))
+		{
+			continue;
+		}
+		FuzzDecoded++;
+
+		TArray<uint8> Reencoded;
+		FAccelByteUniqueIdCompactCodec::Encode(Decoded, Reencoded);
+		if (BytesRead > Bytes.Num() || Reencoded.Num() != BytesRead || FMemory::Memcmp(Reencoded.GetData(), Bytes.GetData(), BytesRead) != 0)
+		{
+			// Non canonical input, such as an overlong varint or a custom platform type that has a known code, is fine
+			// as long as decoding its re-encoded form gives back the same composite
+			FAccelByteUniqueIdComposite Redecoded;
+			int32 RedecodedBytesRead = 0;
+			if (BytesRead > Bytes.Num()
+				|| !FAccelByteUniqueIdCompactCodec::Decode(Reencoded.GetData(), Reencoded.Num(), Redecoded, RedecodedBytesRead)
+				|| !MatchesExactly(Decoded, Redecoded))
+			{
+				FuzzFailures++;
+			}
+		}
+	}
+
+	// Throughput of encoding and decoding both forms
+	uint64 Checksum = 0;
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		FString JsonString;
+		FJsonObjectConverter::UStructToJsonObjectString(Composites[Index % DistinctCount], JsonString);
+		Checksum += FBase64::Encode(JsonString).Len();
+	}
+	const double LegacyEncodeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		FString JsonString;
+		FAccelByteUniqueIdComposite Decoded;
+		FBase64::Decode(EncodedStrings[Index % DistinctCount], JsonString);
+		FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &Decoded, 0, 0);
+		Checksum += Decoded.Id.Len();
+	}
+	const double LegacyDecodeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TArray<TArray<uint8>> CompactBytes;
+	CompactBytes.SetNum(DistinctCount);
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		TArray<uint8>& Bytes = CompactBytes[Index % DistinctCount];
+		Bytes.Reset();
+		FAccelByteUniqueIdCompactCodec::Encode(Composites[Index % DistinctCount], Bytes);
+		Checksum += Bytes.Num();
+	}
+	const double CompactEncodeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		const TArray<uint8>& Bytes = CompactBytes[Index % DistinctCount];
+		FAccelByteUniqueIdComposite Decoded;
+		int32 BytesRead = 0;
+		FAccelByteUniqueIdCompactCodec::Decode(Bytes.GetData(), Bytes.Num(), Decoded, BytesRead);
+		Checksum += Decoded.Id.Len();
+	}
+	const double CompactDecodeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	const double NanosecondsPerOp = 1000000000.0 / Count;
+	UE_LOG_AB(Log, TEXT("[%s] Compact form over %d distinct IDs (checksum %llu)"), GetResultTag(), DistinctCount, Checksum);
+	UE_LOG_AB(Log, TEXT("[%s] Size: legacy %.1f bytes/ID, compact %.1f bytes/ID"), GetResultTag()
+		, static_cast<double>(LegacyTotalBytes) / DistinctCount, static_cast<double>(CompactTotalBytes) / DistinctCount);
+	UE_LOG_AB(Log, TEXT("[%s] Encode: legacy %.1f ns/op, compact %.1f ns/op"), GetResultTag(), LegacyEncodeSeconds * NanosecondsPerOp, CompactEncodeSeconds * NanosecondsPerOp);
+	UE_LOG_AB(Log, TEXT("[%s] Decode: legacy %.1f ns/op, compact %.1f ns/op"), GetResultTag(), LegacyDecodeSeconds * NanosecondsPerOp, CompactDecodeSeconds * NanosecondsPerOp);
+
+	Check(FString::Printf(TEXT("%d of %d IDs failed to round trip through the compact form"), RoundTripFailures, DistinctCount), RoundTripFailures == 0);
+	Check(FString::Printf(TEXT("%d of %d fuzzed inputs decoded, %d of them inconsistently"), FuzzDecoded, FuzzCount, FuzzFailures), FuzzFailures == 0);
+}
+
+#endif
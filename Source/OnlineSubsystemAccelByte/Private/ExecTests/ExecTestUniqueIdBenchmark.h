@@ -0,0 +1,71 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Benchmark for constructing, comparing and hashing FUniqueNetIdAccelByteUser instances. Runs synchronously on the
+ * calling thread, and does not need a logged in user or a backend.
+ *
+ * Every measurement runs once with ID interning disabled and once with it enabled. A set of distinct IDs is kept alive
+ * for the whole run, the same way the user cache keeps IDs of known users alive. IDs created from the composite and from
+ * the encoded string are checked to compare and hash equal.
+ *
+ * The compact ID form is then checked against the legacy form: every distinct ID must round trip through both, random
+ * and mutated inputs must never decode into an ID that fails to round trip, and the size and throughput of both forms
+ * are logged.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST UNIQUEID [Count] [DistinctCount]
+ */
+class FExecTestUniqueIdBenchmark : public FExecTestBase, public TSharedFromThis<FExecTestUniqueIdBenchmark>
+{
+public:
+
+	/**
+	 * Constructs an instance of the unique ID benchmark.
+	 *
+	 * @param InCount Amount of operations to time for each measurement
+	 * @param InDistinctCount Amount of distinct IDs that the operations cycle through
+	 */
+	FExecTestUniqueIdBenchmark(UWorld* InWorld, const FName& InSubsystemName, int32 InCount, int32 InDistinctCount);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("UNIQUEID");
+	}
+
+private:
+
+	/** Amount of operations to time for each measurement */
+	int32 Count;
+
+	/** Amount of distinct IDs that the operations cycle through */
+	int32 DistinctCount;
+
+	/** Composites of every distinct ID */
+	TArray<FAccelByteUniqueIdComposite> Composites;
+
+	/** Encoded string of every distinct ID */
+	TArray<FString> EncodedStrings;
+
+	/** Time and log every measurement with interning either enabled or disabled */
+	void RunMeasurements(bool bInterningEnabled);
+
+	/** Check the compact form round trips and survives fuzzing, and compare its size and throughput to the legacy form */
+	void RunCompactEncodingMeasurements();
+
+};
+
+#endif
@@ -0,0 +1,277 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestUserCacheBenchmark.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSubsystemUtils.h"
+#include "Async/Async.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Math/RandomStream.h"
+#include "Misc/Guid.h"
+
+/** Amount of users put in the cache before measuring */
+#define USER_CACHE_BENCHMARK_USER_COUNT 10000
+
+/** Amount of users that a writer adds at once, roughly the size of a bulk user query */
+#define USER_CACHE_BENCHMARK_BATCH_SIZE 200
+
+/** Only one in this many lookups is timed, to keep the sample arrays small on long runs */
+#define USER_CACHE_BENCHMARK_SAMPLE_INTERVAL 16
+
+/** Amount of purges timed on a cache where nothing has expired */
+#define USER_CACHE_BENCHMARK_IDLE_PURGE_COUNT 1000
+
+/** User limit of the capped cache */
+#define USER_CACHE_BENCHMARK_CAPPED_USER_COUNT 1000
+
+FExecTestUserCacheBenchmark::FExecTestUserCacheBenchmark(UWorld* InWorld, const FName& InSubsystemName, int32 InReaderCount, int32 InWriterCount, double InDurationSeconds)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, ReaderCount(InReaderCount)
+	, WriterCount(InWriterCount)
+	, DurationSeconds(InDurationSeconds)
+{
+}
+
+bool FExecTestUserCacheBenchmark::Run()
+{
+	if (ReaderCount <= 0 || WriterCount < 0 || DurationSeconds <= 0.0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestUserCacheBenchmark, reader count %d and duration %.1f must be positive and writer count %d must not be negative"), ReaderCount, DurationSeconds, WriterCount);
+		return CompleteTest(false);
+	}
+
+	FOnlineSubsystemAccelByte* Subsystem = static_cast<FOnlineSubsystemAccelByte*>(::Online::GetSubsystem(World, SubsystemName));
+	if (Subsystem == nullptr)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestUserCacheBenchmark, subsystem is invalid"));
+		return CompleteTest(false);
+	}
+
+	Users.Reserve(USER_CACHE_BENCHMARK_USER_COUNT);
+	for (int32 Index = 0; Index < USER_CACHE_BENCHMARK_USER_COUNT; Index++)
+	{
+		const FAccelByteUniqueIdComposite Composite(FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower()
+			, TEXT("STEAM")
+			, FString::Printf(TEXT("%llu"), 76561197960265728ull + Index));
+
+		FAccelByteUserInfoRef User = MakeShared<FAccelByteUserInfo, ESPMode::ThreadSafe>();
+		User->Id = FUniqueNetIdAccelByteUser::Create(Composite);
+		User->DisplayName = FString::Printf(TEXT("BenchmarkUser%d"), Index);
+		User->PublicCode = FString::Printf(TEXT("%08X"), Index);
+		Users.Add(User);
+	}
+
+	FOnlineUserCacheAccelByte UserCache(Subsystem);
+	UserCache.AddUsersToCache(Users);
+
+	RunMeasurement(UserCache, 0);
+	if (WriterCount > 0)
+	{
+		RunMeasurement(UserCache, WriterCount);
+	}
+
+	RunPurgeMeasurement(Subsystem);
+
+	return CompleteTest();
+}
+
+TArray<FAccelByteUserInfoRef> FExecTestUserCacheBenchmark::CopyUsers() const
+{
+	TArray<FAccelByteUserInfoRef> Copies;
+	Copies.Reserve(Users.Num());
+	for (const FAccelByteUserInfoRef& Source : Users)
+	{
+		FAccelByteUserInfoRef User = MakeShared<FAccelByteUserInfo, ESPMode::ThreadSafe>();
+		User->Id = Source->Id;
+		User->DisplayName = Source->DisplayName;
+		User->PublicCode = Source->PublicCode;
+		Copies.Add(User);
+	}
+
+	return Copies;
+}
+
+void FExecTestUserCacheBenchmark::RunPurgeMeasurement(FOnlineSubsystemAccelByte* Subsystem)
+{
+	// Nothing has expired yet, so each purge should only look at the least recently accessed user of every shard
+	{
+		FOnlineUserCacheAccelByte UserCache(Subsystem);
+		UserCache.AddUsersToCache(CopyUsers());
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < USER_CACHE_BENCHMARK_IDLE_PURGE_COUNT; Index++)
+		{
+			UserCache.Purge();
+		}
+		const double IdlePurgeSeconds = (FPlatformTime::Seconds() - StartTime) / USER_CACHE_BENCHMARK_IDLE_PURGE_COUNT;
+
+		UE_LOG_AB(Log, TEXT("[%s] Purge over %d users"), GetResultTag(), Users.Num());
+		UE_LOG_AB(Log, TEXT("[%s] Purge with nothing expired: %.2f us/tick"), GetResultTag(), IdlePurgeSeconds * 1000000.0);
+		Check(TEXT("Purge with nothing expired keeps every user"), UserCache.GetCachedUserCount() == Users.Num());
+	}
+
+	// Expire every user and purge with the default per tick limit until the cache is empty
+	{
+		FOnlineUserCacheAccelByte UserCache(Subsystem);
+		UserCache.AddUsersToCache(CopyUsers());
+		UserCache.SetUserCachePurgeTimeoutSeconds(0.0);
+
+		int32 TickCount = 0;
+		double TotalTickSeconds = 0.0;
+		double MaxTickSeconds = 0.0;
+		while (TickCount < Users.Num())
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			const int32 PurgedCount = UserCache.Purge();
+			const double TickSeconds = FPlatformTime::Seconds() - StartTime;
+			if (PurgedCount <= 0)
+			{
+				break;
+			}
+
+			TickCount++;
+			TotalTickSeconds += TickSeconds;
+			MaxTickSeconds = FMath::Max(MaxTickSeconds, TickSeconds);
+		}
+
+		UE_LOG_AB(Log, TEXT("[%s] Purge of every user with the per tick limit: %d ticks, %.2f us/tick avg, %.2f us/tick max"), GetResultTag()
+			, TickCount, (TickCount > 0) ? TotalTickSeconds / TickCount * 1000000.0 : 0.0, MaxTickSeconds * 1000000.0);
+		Check(FString::Printf(TEXT("Purge with the per tick limit left %d expired users"), UserCache.GetCachedUserCount()), UserCache.GetCachedUserCount() == 0);
+	}
+
+	// Same as above, but in a single tick without a limit, for comparison with a full scan
+	{
+		FOnlineUserCacheAccelByte UserCache(Subsystem);
+		UserCache.AddUsersToCache(CopyUsers());
+		UserCache.SetUserCachePurgeTimeoutSeconds(0.0);
+		UserCache.SetMaxUserCachePurgesPerTick(0);
+
+		const double StartTime = FPlatformTime::Seconds();
+		const int32 PurgedCount = UserCache.Purge();
+		const double PurgeSeconds = FPlatformTime::Seconds() - StartTime;
+		Check(FString::Printf(TEXT("Unbounded purge removed %d of %d expired users"), PurgedCount, Users.Num()), PurgedCount == Users.Num());
+
+		UE_LOG_AB(Log, TEXT("[%s] Purge of every user in one unbounded tick: %d users in %.2f us"), GetResultTag(), PurgedCount, PurgeSeconds * 1000000.0);
+	}
+
+	// Fill a capped cache past its limit, the limit is split evenly between shards so allow for the rounding up
+	{
+		FOnlineUserCacheAccelByte UserCache(Subsystem);
+		UserCache.SetMaxCachedUserCount(USER_CACHE_BENCHMARK_CAPPED_USER_COUNT);
+		UserCache.AddUsersToCache(CopyUsers());
+
+		const int32 CachedUserCount = UserCache.GetCachedUserCount();
+		const int32 AllowedUserCount = FMath::DivideAndRoundUp(USER_CACHE_BENCHMARK_CAPPED_USER_COUNT, ACCELBYTE_USER_CACHE_SHARD_COUNT) * ACCELBYTE_USER_CACHE_SHARD_COUNT;
+		Check(FString::Printf(TEXT("Cache limited to %d users holds %d users after adding %d"), USER_CACHE_BENCHMARK_CAPPED_USER_COUNT, CachedUserCount, Users.Num())
+			, CachedUserCount <= AllowedUserCount);
+	}
+}
+
+void FExecTestUserCacheBenchmark::RunMeasurement(FOnlineUserCacheAccelByte& UserCache, int32 ActiveWriterCount)
+{
+	FThreadSafeBool bShouldStop = false;
+	FThreadSafeCounter64 LookupCount;
+	FThreadSafeCounter64 MissCount;
+	FThreadSafeCounter64 InsertCount;
+
+	TArray<TArray<uint64>> SampleCyclesPerReader;
+	SampleCyclesPerReader.SetNum(ReaderCount);
+
+	TArray<TFuture<void>> Threads;
+	for (int32 ReaderIndex = 0; ReaderIndex < ReaderCount; ReaderIndex++)
+	{
+		TArray<uint64>& SampleCycles = SampleCyclesPerReader[ReaderIndex];
+		Threads.Add(Async(EAsyncExecution::Thread, [this, &UserCache, &bShouldStop, &LookupCount, &MissCount, &SampleCycles, ReaderIndex]()
+		{
+			FRandomStream Stream(ReaderIndex + 1);
+			int64 Lookups = 0;
+			int64 Misses = 0;
+			while (!bShouldStop)
+			{
+				const FAccelByteUniqueIdComposite& Composite = Users[Stream.RandHelper(Users.Num())]->Id->GetCompositeStructure();
+
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				const bool bFound = UserCache.GetUser(Composite).IsValid();
+				const uint64 ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+
+				if ((Lookups % USER_CACHE_BENCHMARK_SAMPLE_INTERVAL) == 0)
+				{
+					SampleCycles.Add(ElapsedCycles);
+				}
+				Lookups++;
+				Misses += bFound ? 0 : 1;
+			}
+
+			LookupCount.Add(Lookups);
+			MissCount.Add(Misses);
+		}));
+	}
+
+	for (int32 WriterIndex = 0; WriterIndex < ActiveWriterCount; WriterIndex++)
+	{
+		Threads.Add(Async(EAsyncExecution::Thread, [this, &UserCache, &bShouldStop, &InsertCount, WriterIndex]()
+		{
+			FRandomStream Stream(-(WriterIndex + 1));
+			while (!bShouldStop)
+			{
+				// Add fresh copies of existing users, like a query task refreshing stale users would
+				TArray<FAccelByteUserInfoRef> Batch;
+				Batch.Reserve(USER_CACHE_BENCHMARK_BATCH_SIZE);
+				for (int32 Index = 0; Index < USER_CACHE_BENCHMARK_BATCH_SIZE; Index++)
+				{
+					const FAccelByteUserInfoRef& Source = Users[Stream.RandHelper(Users.Num())];
+					FAccelByteUserInfoRef User = MakeShared<FAccelByteUserInfo, ESPMode::ThreadSafe>();
+					User->Id = Source->Id;
+					User->DisplayName = Source->DisplayName;
+					User->PublicCode = Source->PublicCode;
+					Batch.Add(User);
+				}
+
+				UserCache.AddUsersToCache(Batch);
+				InsertCount.Add(Batch.Num());
+			}
+		}));
+	}
+
+	FPlatformProcess::Sleep(static_cast<float>(DurationSeconds));
+	bShouldStop = true;
+	for (TFuture<void>& Thread : Threads)
+	{
+		Thread.Wait();
+	}
+
+	TArray<uint64> SampleCycles;
+	for (const TArray<uint64>& ReaderSampleCycles : SampleCyclesPerReader)
+	{
+		SampleCycles.Append(ReaderSampleCycles);
+	}
+	SampleCycles.Sort();
+
+	const auto GetPercentileMicroseconds = [&SampleCycles](double Percentile) -> double
+	{
+		if (SampleCycles.Num() <= 0)
+		{
+			return 0.0;
+		}
+
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile / 100.0 * SampleCycles.Num()) - 1, 0, SampleCycles.Num() - 1);
+		return FPlatformTime::ToSeconds64(SampleCycles[Index]) * 1000000.0;
+	};
+
+	UE_LOG_AB(Log, TEXT("[%s] %d reader(s) and %d writer(s) over %d users for %.1f seconds"), GetResultTag()
+		, ReaderCount, ActiveWriterCount, Users.Num(), DurationSeconds);
+	UE_LOG_AB(Log, TEXT("[%s] Lookups: %.0f/s, p50 %.2f us, p99 %.2f us, p99.9 %.2f us, max %.2f us"), GetResultTag()
+		, LookupCount.GetValue() / DurationSeconds
+		, GetPercentileMicroseconds(50.0)
+		, GetPercentileMicroseconds(99.0)
+		, GetPercentileMicroseconds(99.9)
+		, GetPercentileMicroseconds(100.0));
+	UE_LOG_AB(Log, TEXT("[%s] Inserts: %.0f users/s"), GetResultTag(), InsertCount.GetValue() / DurationSeconds);
+	Check(FString::Printf(TEXT("%lld of %lld lookups missed a cached user"), MissCount.GetValue(), LookupCount.GetValue()), MissCount.GetValue() == 0);
+}
+
+#endif
@@ -0,0 +1,75 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineUserCacheAccelByte.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Stress benchmark for the user cache, measuring lookup latency on reader threads while writer threads keep adding
+ * batches of users, the same way query tasks do when they complete. Uses its own user cache instance filled with fake
+ * users, so it does not need a logged in user or a backend and does not touch the subsystem's cache.
+ *
+ * Lookups are first measured without any writers as a baseline, then again with the writers running. Every lookup is
+ * expected to hit, any miss fails the test.
+ *
+ * Purging is then measured on separate cache instances: the cost of a purge when nothing has expired, the cost per tick
+ * of purging every user with the per tick limit, and the cost of purging every user in a single unbounded tick. Finally
+ * a cache with a user limit is filled past that limit, and it is checked that the limit is respected.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST USERCACHE [ReaderCount] [WriterCount] [DurationSeconds]
+ */
+class FExecTestUserCacheBenchmark : public FExecTestBase, public TSharedFromThis<FExecTestUserCacheBenchmark>
+{
+public:
+
+	/**
+	 * Constructs an instance of the user cache benchmark.
+	 *
+	 * @param InReaderCount Amount of threads looking up users
+	 * @param InWriterCount Amount of threads adding batches of users
+	 * @param InDurationSeconds How long each measurement runs for
+	 */
+	FExecTestUserCacheBenchmark(UWorld* InWorld, const FName& InSubsystemName, int32 InReaderCount, int32 InWriterCount, double InDurationSeconds);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("USERCACHE");
+	}
+
+private:
+
+	/** Amount of threads looking up users */
+	int32 ReaderCount;
+
+	/** Amount of threads adding batches of users */
+	int32 WriterCount;
+
+	/** How long each measurement runs for */
+	double DurationSeconds;
+
+	/** Users that are in the cache, looked up by the readers and added again by the writers */
+	TArray<FAccelByteUserInfoRef> Users;
+
+	/** Run readers, along with the given amount of writers, against the cache and log the lookup latency */
+	void RunMeasurement(FOnlineUserCacheAccelByte& UserCache, int32 ActiveWriterCount);
+
+	/** Time purges of fresh and expired caches, and check that the cache limit is respected */
+	void RunPurgeMeasurement(FOnlineSubsystemAccelByte* Subsystem);
+
+	/** Create new instances of every user, as a user can only be held by one cache at a time */
+	TArray<FAccelByteUserInfoRef> CopyUsers() const;
+
+};
+
+#endif
@@ -0,0 +1,337 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestUserCacheSnapshot.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSubsystemUtils.h"
+#include "Utilities/AccelByteUserCacheSnapshot.h"
+#include "HAL/FileManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+
+/** Namespace and base URL that the snapshot of the test is written for */
+#define USER_CACHE_SNAPSHOT_TEST_NAMESPACE TEXT("exectest")
+#define USER_CACHE_SNAPSHOT_TEST_BASE_URL TEXT("https://example.com")
+
+/** Amount of corrupted copies of the snapshot read in each corruption check */
+#define USER_CACHE_SNAPSHOT_TEST_CORRUPTION_ITERATIONS 256
+
+/** Fixed seed, so that a failing corruption check can be reproduced */
+#define USER_CACHE_SNAPSHOT_TEST_SEED 0x41424355
+
+static bool AreLinkedPlatformsEqual(const FAccelByteLinkedUserInfo& Left, const FAccelByteLinkedUserInfo& Right)
+{
+	return Left.Id.IsValid() && Right.Id.IsValid()
+		&& Left.Id->GetAccelByteId() == Right.Id->GetAccelByteId()
+		&& Left.Id->GetPlatformType() == Right.Id->GetPlatformType()
+		&& Left.Id->GetPlatformId() == Right.Id->GetPlatformId()
+		&& Left.PlatformId == Right.PlatformId
+		&& Left.DisplayName == Right.DisplayName
+		&& Left.AvatarUrl == Right.AvatarUrl;
+}
+
+static bool AreUsersEqual(const FAccelByteUserInfo& Left, const FAccelByteUserInfo& Right)
+{
+	if (!Left.Id.IsValid() || !Right.Id.IsValid()
+		|| Left.Id->GetAccelByteId() != Right.Id->GetAccelByteId()
+		|| Left.Id->GetPlatformType() != Right.Id->GetPlatformType()
+		|| Left.Id->GetPlatformId() != Right.Id->GetPlatformId()
+		|| Left.DisplayName != Right.DisplayName
+		|| Left.UniqueDisplayName != Right.UniqueDisplayName
+		|| Left.PublicCode != Right.PublicCode
+		|| Left.GameAvatarUrl != Right.GameAvatarUrl
+		|| Left.PublisherAvatarUrl != Right.PublisherAvatarUrl
+		|| Left.LinkedPlatformInfo.Num() != Right.LinkedPlatformInfo.Num())
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Left.LinkedPlatformInfo.Num(); Index++)
+	{
+		if (!AreLinkedPlatformsEqual(Left.LinkedPlatformInfo[Index], Right.LinkedPlatformInfo[Index]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+FExecTestUserCacheSnapshot::FExecTestUserCacheSnapshot(UWorld* InWorld, const FName& InSubsystemName, int32 InUserCount)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, UserCount(InUserCount)
+{
+}
+
+bool FExecTestUserCacheSnapshot::Run()
+{
+	if (UserCount <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestUserCacheSnapshot, user count %d must be positive"), UserCount);
+		return CompleteTest(false);
+	}
+
+	FOnlineSubsystemAccelByte* Subsystem = static_cast<FOnlineSubsystemAccelByte*>(::Online::GetSubsystem(World, SubsystemName));
+	if (Subsystem == nullptr)
+	{
+		UE_LOG_AB(Error, TEXT("Could not start FExecTestUserCacheSnapshot, subsystem is invalid"));
+		return CompleteTest(false);
+	}
+
+	Users.Reserve(UserCount);
+	for (int32 Index = 0; Index < UserCount; Index++)
+	{
+		const FString AccelByteId = FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+		const FString SteamId = FString::Printf(TEXT("%llu"), 76561197960265728ull + Index);
+
+		FAccelByteUserInfoRef User = MakeShared<FAccelByteUserInfo, ESPMode::ThreadSafe>();
+
+		// Every other user has no platform information, and every third user has a display name outside of ASCII
+		User->Id = (Index % 2 == 0)
+			? FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(AccelByteId, TEXT("STEAM"), SteamId))
+			: FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(AccelByteId));
+		User->DisplayName = (Index % 3 == 0) ? FString::Printf(TEXT("Spieler\u00FC%d\u30E6\u30FC\u30B6\u30FC"), Index) : FString::Printf(TEXT("SnapshotUser%d"), Index);
+		User->UniqueDisplayName = FString::Printf(TEXT("snapshot_user_%d"), Index);
+		User->PublicCode = FString::Printf(TEXT("%08X"), Index);
+		User->GameAvatarUrl = FString::Printf(TEXT("https://example.com/avatars/game/%d.png"), Index);
+
+		if (Index % 2 == 0)
+		{
+			FAccelByteLinkedUserInfo& LinkedInfo = User->LinkedPlatformInfo.AddDefaulted_GetRef();
+			LinkedInfo.Id = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(AccelByteId, TEXT("STEAM"), SteamId));
+			LinkedInfo.PlatformId = SteamId;
+			LinkedInfo.DisplayName = User->DisplayName;
+		}
+
+		Users.Add(User);
+	}
+
+	RunRoundTrip();
+	RunCorruption();
+	RunFile();
+	RunRestore(Subsystem);
+	return CompleteTest();
+}
+
+bool FExecTestUserCacheSnapshot::AreUsersFromSnapshot(const TArray<FAccelByteUserInfoRef>& RestoredUsers) const
+{
+	TMap<FString, FAccelByteUserInfoRef> UsersById;
+	UsersById.Reserve(Users.Num());
+	for (const FAccelByteUserInfoRef& User : Users)
+	{
+		UsersById.Add(User->Id->GetAccelByteId(), User);
+	}
+
+	for (const FAccelByteUserInfoRef& RestoredUser : RestoredUsers)
+	{
+		const FAccelByteUserInfoRef* FoundUser = UsersById.Find(RestoredUser->Id->GetAccelByteId());
+		if (FoundUser == nullptr || !AreUsersEqual(FoundUser->Get(), RestoredUser.Get()))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FExecTestUserCacheSnapshot::RunRoundTrip()
+{
+	const double EncodeStartSeconds = FPlatformTime::Seconds();
+	FAccelByteUserCacheSnapshot Snapshot(USER_CACHE_SNAPSHOT_TEST_NAMESPACE, USER_CACHE_SNAPSHOT_TEST_BASE_URL);
+	for (const FAccelByteUserInfoRef& User : Users)
+	{
+		Snapshot.AddUser(User.Get());
+	}
+	Snapshot.Serialize(SnapshotBytes);
+	HeaderSize = Snapshot.GetHeaderSize();
+	const double EncodeSeconds = FPlatformTime::Seconds() - EncodeStartSeconds;
+
+	const double DecodeStartSeconds = FPlatformTime::Seconds();
+	TArray<FAccelByteUserInfoRef> RestoredUsers;
+	int32 CorruptRecordCount = 0;
+	const bool bWasRead = FAccelByteUserCacheSnapshot::Deserialize(SnapshotBytes.GetData(), SnapshotBytes.Num(), USER_CACHE_SNAPSHOT_TEST_NAMESPACE, USER_CACHE_SNAPSHOT_TEST_BASE_URL, RestoredUsers, CorruptRecordCount);
+	const double DecodeSeconds = FPlatformTime::Seconds() - DecodeStartSeconds;
+
+	bool bPassed = bWasRead && CorruptRecordCount == 0 && RestoredUsers.Num() == Users.Num();
+	for (int32 Index = 0; bPassed && Index < Users.Num(); Index++)
+	{
+		bPassed = AreUsersEqual(Users[Index].Get(), RestoredUsers[Index].Get());
+	}
+
+	// Writing the restored users again has to give the same records, which also covers the last updated times
+	if (bPassed)
+	{
+		FAccelByteUserCacheSnapshot RewrittenSnapshot(USER_CACHE_SNAPSHOT_TEST_NAMESPACE, USER_CACHE_SNAPSHOT_TEST_BASE_URL);
+		for (const FAccelByteUserInfoRef& User : RestoredUsers)
+		{
+			RewrittenSnapshot.AddUser(User.Get());
+		}
+
+		TArray<uint8> RewrittenBytes;
+		RewrittenSnapshot.Serialize(RewrittenBytes);
+		bPassed = RewrittenBytes.Num() == SnapshotBytes.Num()
+			&& FMemory::Memcmp(RewrittenBytes.GetData() + HeaderSize
+				, SnapshotBytes.GetData() + HeaderSize
+				, SnapshotBytes.Num() - HeaderSize) == 0;
+	}
+
+	Check(FString::Printf(TEXT("Round trip of %d users, %d bytes (%.1f per user), encode %.2fms, decode %.2fms")
+		, Users.Num()
+		, SnapshotBytes.Num()
+		, static_cast<double>(SnapshotBytes.Num()) / Users.Num()
+		, EncodeSeconds * 1000.0
+		, DecodeSeconds * 1000.0)
+		, bPassed);
+}
+
+void FExecTestUserCacheSnapshot::RunCorruption()
+{
+	FRandomStream Random(USER_CACHE_SNAPSHOT_TEST_SEED);
+
+	// Truncating anywhere in the header discards the snapshot, truncating past it keeps only records that are whole
+	bool bTruncationPassed = true;
+	int32 TruncationCount = 0;
+	const int32 TruncationStep = FMath::Max(SnapshotBytes.Num() / USER_CACHE_SNAPSHOT_TEST_CORRUPTION_ITERATIONS, 1);
+	for (int32 Length = 0; Length < SnapshotBytes.Num(); Length += (Length < HeaderSize * 2) ? 1 : TruncationStep)
+	{
+		TArray<FAccelByteUserInfoRef> RestoredUsers;
+		int32 CorruptRecordCount = 0;
+		const bool bWasRead = FAccelByteUserCacheSnapshot::Deserialize(SnapshotBytes.GetData(), Length, USER_CACHE_SNAPSHOT_TEST_NAMESPACE, USER_CACHE_SNAPSHOT_TEST_BASE_URL, RestoredUsers, CorruptRecordCount);
+		const bool bExpectedRead = Length >= HeaderSize + Users.Num() * 4;
+		if (bWasRead != bExpectedRead
+			|| RestoredUsers.Num() + CorruptRecordCount != (bWasRead ? Users.Num() : 0)
+			|| (bWasRead && CorruptRecordCount == 0)
+			|| !AreUsersFromSnapshot(RestoredUsers))
+		{
+			UE_LOG_AB(Warning, TEXT("[%s] Snapshot truncated to %d bytes gave %d users and %d corrupt records"), GetResultTag(), Length, RestoredUsers.Num(), CorruptRecordCount);
+			bTruncationPassed = false;
+		}
+		TruncationCount++;
+	}
+
+	// A flipped byte may cost records, but must never crash or change a user that is read back
+	bool bFlipPassed = true;
+	int32 TotalCorruptRecordCount = 0;
+	for (int32 Iteration = 0; Iteration < USER_CACHE_SNAPSHOT_TEST_CORRUPTION_ITERATIONS; Iteration++)
+	{
+		TArray<uint8> CorruptBytes = SnapshotBytes;
+		const int32 FlipCount = Random.RandRange(1, 8);
+		for (int32 Flip = 0; Flip < FlipCount; Flip++)
+		{
+			CorruptBytes[Random.RandRange(0, CorruptBytes.Num() - 1)] ^= static_cast<uint8>(Random.RandRange(1, 255));
+		}
+
+		TArray<FAccelByteUserInfoRef> RestoredUsers;
+		int32 CorruptRecordCount = 0;
+		FAccelByteUserCacheSnapshot::Deserialize(CorruptBytes.GetData(), CorruptBytes.Num(), USER_CACHE_SNAPSHOT_TEST_NAMESPACE, USER_CACHE_SNAPSHOT_TEST_BASE_URL, RestoredUsers, CorruptRecordCount);
+		TotalCorruptRecordCount += CorruptRecordCount;
+		if (RestoredUsers.Num() > Users.Num() || !AreUsersFromSnapshot(RestoredUsers))
+		{
+			UE_LOG_AB(Warning, TEXT("[%s] Snapshot with %d flipped bytes gave %d users that were not written"), GetResultTag(), FlipCount, RestoredUsers.Num());
+			bFlipPassed = false;
+		}
+	}
+
+	// Snapshots that are not ours, or of another version, are discarded whole
+	bool bHeaderPassed = true;
+	{
+		TArray<FAccelByteUserInfoRef> RestoredUsers;
+		int32 CorruptRecordCount = 0;
+
+		TArray<uint8> BadMagicBytes = SnapshotBytes;
+		BadMagicBytes[0] ^= 0xFF;
+		bHeaderPassed &= !FAccelByteUserCacheSnapshot::Deserialize(BadMagicBytes.GetData(), BadMagicBytes.Num(), USER_CACHE_SNAPSHOT_TEST_NAMESPACE, USER_CACHE_SNAPSHOT_TEST_BASE_URL, RestoredUsers, CorruptRecordCount);
+
+		// Bump the version and fix up the header CRC, as a newer build would write it
+		TArray<uint8> NewerVersionBytes = SnapshotBytes;
+		NewerVersionBytes[4] = static_cast<uint8>(ACCELBYTE_USER_CACHE_SNAPSHOT_VERSION + 1);
+		const uint32 HeaderCrc = FCrc::MemCrc32(NewerVersionBytes.GetData(), HeaderSize - 4);
+		FMemory::Memcpy(NewerVersionBytes.GetData() + HeaderSize - 4, &HeaderCrc, 4);
+		bHeaderPassed &= !FAccelByteUserCacheSnapshot::Deserialize(NewerVersionBytes.GetData(), NewerVersionBytes.Num(), USER_CACHE_SNAPSHOT_TEST_NAMESPACE, USER_CACHE_SNAPSHOT_TEST_BASE_URL, RestoredUsers, CorruptRecordCount);
+
+		bHeaderPassed &= !FAccelByteUserCacheSnapshot::Deserialize(nullptr, 0, USER_CACHE_SNAPSHOT_TEST_NAMESPACE, USER_CACHE_SNAPSHOT_TEST_BASE_URL, RestoredUsers, CorruptRecordCount);
+
+		TArray<uint8> GarbageBytes;
+		GarbageBytes.SetNumUninitialized(SnapshotBytes.Num());
+		for (uint8& Byte : GarbageBytes)
+		{
+			Byte = static_cast<uint8>(Random.RandRange(0, 255));
+		}
+		bHeaderPassed &= !FAccelByteUserCacheSnapshot::Deserialize(GarbageBytes.GetData(), GarbageBytes.Num(), USER_CACHE_SNAPSHOT_TEST_NAMESPACE, USER_CACHE_SNAPSHOT_TEST_BASE_URL, RestoredUsers, CorruptRecordCount);
+		bHeaderPassed &= RestoredUsers.Num() == 0;
+	}
+
+	// Snapshots written for another namespace or environment are discarded whole, even though they are intact
+	bool bScopePassed = true;
+	{
+		TArray<FAccelByteUserInfoRef> RestoredUsers;
+		int32 CorruptRecordCount = 0;
+		bScopePassed &= !FAccelByteUserCacheSnapshot::Deserialize(SnapshotBytes.GetData(), SnapshotBytes.Num(), TEXT("othernamespace"), USER_CACHE_SNAPSHOT_TEST_BASE_URL, RestoredUsers, CorruptRecordCount);
+		bScopePassed &= !FAccelByteUserCacheSnapshot::Deserialize(SnapshotBytes.GetData(), SnapshotBytes.Num(), USER_CACHE_SNAPSHOT_TEST_NAMESPACE, TEXT("https://dev.example.com"), RestoredUsers, CorruptRecordCount);
+		bScopePassed &= RestoredUsers.Num() == 0;
+	}
+
+	Check(FString::Printf(TEXT("Truncation at %d lengths"), TruncationCount), bTruncationPassed);
+	Check(FString::Printf(TEXT("Random byte flips (%d records skipped)"), TotalCorruptRecordCount), bFlipPassed);
+	Check(TEXT("Bad header"), bHeaderPassed);
+	Check(TEXT("Other namespace or base URL"), bScopePassed);
+}
+
+void FExecTestUserCacheSnapshot::RunFile()
+{
+	const FString FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByte"), TEXT("UserCacheSnapshotTest.bin"));
+
+	TArray<FAccelByteUserInfoRef> RestoredUsers;
+	int32 CorruptRecordCount = 0;
+	const bool bWasSaved = FAccelByteUserCacheSnapshot::SaveToFile(FilePath, SnapshotBytes);
+	const bool bWasLoaded = FAccelByteUserCacheSnapshot::LoadFromFile(FilePath, USER_CACHE_SNAPSHOT_TEST_NAMESPACE, USER_CACHE_SNAPSHOT_TEST_BASE_URL, RestoredUsers, CorruptRecordCount);
+	IFileManager::Get().Delete(*FilePath);
+
+	Check(FString::Printf(TEXT("Save to and load from '%s'"), *FilePath)
+		, bWasSaved && bWasLoaded && CorruptRecordCount == 0 && RestoredUsers.Num() == Users.Num() && AreUsersFromSnapshot(RestoredUsers));
+}
+
+void FExecTestUserCacheSnapshot::RunRestore(FOnlineSubsystemAccelByte* Subsystem)
+{
+	TArray<FAccelByteUserInfoRef> RestoredUsers;
+	int32 CorruptRecordCount = 0;
+	FAccelByteUserCacheSnapshot::Deserialize(SnapshotBytes.GetData(), SnapshotBytes.Num(), USER_CACHE_SNAPSHOT_TEST_NAMESPACE, USER_CACHE_SNAPSHOT_TEST_BASE_URL, RestoredUsers, CorruptRecordCount);
+
+	// The users of this test were never updated from the backend, so they are only fresh without staleness checks
+	int32 StaleRestoredCount = 0;
+	{
+		FOnlineUserCacheAccelByte UserCache(Subsystem);
+		StaleRestoredCount = UserCache.RestoreUsersToCache(RestoredUsers);
+	}
+
+	// Users queried during this session win over the ones from the snapshot
+	const int32 CachedUserCount = RestoredUsers.Num() / 2;
+	int32 RestoredCount = 0;
+	int32 TotalCachedUserCount = 0;
+	{
+		TArray<FAccelByteUserInfoRef> SessionUsers;
+		for (int32 Index = 0; Index < CachedUserCount; Index++)
+		{
+			SessionUsers.Add(Users[Index]);
+		}
+
+		FOnlineUserCacheAccelByte UserCache(Subsystem);
+		UserCache.SetStalenessCheckEnabled(false);
+		UserCache.AddUsersToCache(SessionUsers);
+		RestoredCount = UserCache.RestoreUsersToCache(RestoredUsers);
+		TotalCachedUserCount = UserCache.GetCachedUserCount();
+	}
+
+	Check(FString::Printf(TEXT("Restore into cache, %d stale users restored, %d of %d users restored with %d already cached")
+		, StaleRestoredCount
+		, RestoredCount
+		, RestoredUsers.Num()
+		, CachedUserCount)
+		, StaleRestoredCount == 0 && RestoredCount == RestoredUsers.Num() - CachedUserCount && TotalCachedUserCount == RestoredUsers.Num());
+}
+
+#endif
@@ -0,0 +1,73 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+#include "OnlineUserCacheAccelByte.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test for the on-disk user cache snapshot, run entirely locally without any backend calls.
+ *
+ * Checks that a snapshot survives a round trip unchanged and logs its size and encode and decode times. Then checks that
+ * truncated snapshots, snapshots with random bytes flipped, snapshots with a bad magic or version and random garbage are
+ * all read without crashing, never yielding a user that differs from the one written, and that a snapshot written for
+ * another namespace or base URL is discarded. Finally writes a snapshot to and
+ * reads it back from the saved directory, and restores it into a user cache, checking that stale users and users that
+ * are already cached are skipped.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST USERCACHESNAPSHOT [UserCount]
+ */
+class FExecTestUserCacheSnapshot : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the user cache snapshot test.
+	 *
+	 * @param InUserCount Amount of users to write to the snapshot
+	 */
+	FExecTestUserCacheSnapshot(UWorld* InWorld, const FName& InSubsystemName, int32 InUserCount);
+
+	virtual bool Run() override;
+
+protected:
+
+	virtual const TCHAR* GetResultTag() const override
+	{
+		return TEXT("USERCACHESNAPSHOT");
+	}
+
+private:
+
+	/** Amount of users to write to the snapshot */
+	int32 UserCount;
+
+	/** Users written to the snapshot */
+	TArray<FAccelByteUserInfoRef> Users;
+
+	/** Serialized snapshot of Users */
+	TArray<uint8> SnapshotBytes;
+
+	/** Size of the header of SnapshotBytes, the offset table and user records start after it */
+	int32 HeaderSize = 0;
+
+	/** Check that every user read from a snapshot is identical to the user written with the same ID */
+	bool AreUsersFromSnapshot(const TArray<FAccelByteUserInfoRef>& RestoredUsers) const;
+
+	void RunRoundTrip();
+
+	void RunCorruption();
+
+	void RunFile();
+
+	void RunRestore(FOnlineSubsystemAccelByte* Subsystem);
+
+};
+
+#endif
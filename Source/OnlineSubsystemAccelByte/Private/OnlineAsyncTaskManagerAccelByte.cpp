@@ -4,24 +4,243 @@
 
 #include "OnlineAsyncTaskManagerAccelByte.h"
 #include "OnlineSubsystemAccelByte.h"
+#include "AsyncTasks/OnlineAsyncTaskAccelByte.h"
+
+const EAccelByteAsyncTaskPriority FOnlineAsyncTaskManagerAccelByte::AdmissionOrder[] = {
+	EAccelByteAsyncTaskPriority::Normal,
+	EAccelByteAsyncTaskPriority::Normal,
+	EAccelByteAsyncTaskPriority::Normal,
+	EAccelByteAsyncTaskPriority::Background
+};
 
 FOnlineAsyncTaskManagerAccelByte::FOnlineAsyncTaskManagerAccelByte(FOnlineSubsystemAccelByte* ParentSubsystem)
 	: AccelByteSubsystem(ParentSubsystem)
 {
+	const TCHAR* ConfigKeys[AB_ASYNC_TASK_PRIORITY_COUNT] = {
+		TEXT("CriticalAsyncTaskConcurrencyLimit"),
+		TEXT("NormalAsyncTaskConcurrencyLimit"),
+		TEXT("BackgroundAsyncTaskConcurrencyLimit")
+	};
+
+	for (int32 Index = 0; Index < AB_ASYNC_TASK_PRIORITY_COUNT; Index++)
+	{
+		if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), ConfigKeys[Index], MaxParallelTasksPerPriority[Index]))
+		{
+			UE_LOG_AB(Verbose, TEXT("'%s' is not specified in DefaultEngine.ini, or on command line. Defaulting to %d."), ConfigKeys[Index], MaxParallelTasksPerPriority[Index]);
+		}
+	}
+}
+
+FOnlineAsyncTaskManagerAccelByte::~FOnlineAsyncTaskManagerAccelByte()
+{
+	// Pending and attached tasks were never handed to the base manager, so nothing else will clean them up
+	{
+		FScopeLock Lock(&SchedulerLock);
+		for (int32 Index = 0; Index < AB_ASYNC_TASK_PRIORITY_COUNT; Index++)
+		{
+			FOnlineAsyncTask* Task = nullptr;
+			while (PendingParallelTasks[Index].Dequeue(Task))
+			{
+				delete Task;
+			}
+			PendingParallelTaskCount[Index] = 0;
+		}
+	}
+
+	FScopeLock Lock(&CoalescingLock);
+	for (const TPair<FString, FCoalescedTaskGroup>& Pair : CoalescedTaskGroups)
+	{
+		for (FOnlineAsyncTaskAccelByte* AttachedTask : Pair.Value.AttachedTasks)
+		{
+			delete AttachedTask;
+		}
+	}
+	CoalescedTaskGroups.Empty();
+	CoalescingKeyByInFlightTask.Empty();
 }
 
 void FOnlineAsyncTaskManagerAccelByte::OnlineTick()
 {
 	check(AccelByteSubsystem);
 	check(FPlatformTLS::GetCurrentThreadId() == OnlineThreadId);
+
+	AdmitPendingParallelTasks();
+}
+
+void FOnlineAsyncTaskManagerAccelByte::AddToParallelTasksWithPriority(FOnlineAsyncTask* NewTask, EAccelByteAsyncTaskPriority Priority)
+{
+	if (NewTask == nullptr)
+	{
+		return;
+	}
+
+	const int32 Index = static_cast<int32>(Priority);
+	{
+		FScopeLock Lock(&SchedulerLock);
+
+		// Only skip the queue if no one of the same class is already waiting, otherwise we would break FIFO order
+		if (PendingParallelTaskCount[Index] > 0 || !HasFreeSlot(Priority))
+		{
+			PendingParallelTasks[Index].Enqueue(NewTask);
+			PendingParallelTaskCount[Index]++;
+			UE_LOG_AB(VeryVerbose, TEXT("Deferring %s priority async task, %d in flight and %d pending for this priority."), *AsyncTaskPriorityToString(Priority), ActiveParallelTaskCount[Index], PendingParallelTaskCount[Index]);
+			return;
+		}
+
+		MarkAdmitted(NewTask, Priority);
+	}
+
+	// Added outside of the scheduler lock, as the base manager may initialize the task which in turn can dispatch more tasks
+	AddToParallelTasks(NewTask);
+}
+
+void FOnlineAsyncTaskManagerAccelByte::ReleaseParallelTaskSlot(FOnlineAsyncTask* CompletedTask)
+{
+	FScopeLock Lock(&SchedulerLock);
+
+	EAccelByteAsyncTaskPriority Priority;
+	if (ActiveParallelTaskPriorities.RemoveAndCopyValue(CompletedTask, Priority))
+	{
+		ActiveParallelTaskCount[static_cast<int32>(Priority)]--;
+	}
+}
+
+int32 FOnlineAsyncTaskManagerAccelByte::GetPendingParallelTaskCount(EAccelByteAsyncTaskPriority Priority) const
+{
+	FScopeLock Lock(&SchedulerLock);
+	return PendingParallelTaskCount[static_cast<int32>(Priority)];
+}
+
+int32 FOnlineAsyncTaskManagerAccelByte::GetActiveParallelTaskCount(EAccelByteAsyncTaskPriority Priority) const
+{
+	FScopeLock Lock(&SchedulerLock);
+	return ActiveParallelTaskCount[static_cast<int32>(Priority)];
+}
+
+int32 FOnlineAsyncTaskManagerAccelByte::GetMaxParallelTasksForPriority(EAccelByteAsyncTaskPriority Priority) const
+{
+	FScopeLock Lock(&SchedulerLock);
+	return MaxParallelTasksPerPriority[static_cast<int32>(Priority)];
+}
+
+void FOnlineAsyncTaskManagerAccelByte::SetMaxParallelTasksForPriority(EAccelByteAsyncTaskPriority Priority, int32 Limit)
+{
+	FScopeLock Lock(&SchedulerLock);
+	MaxParallelTasksPerPriority[static_cast<int32>(Priority)] = Limit;
+}
+
+bool FOnlineAsyncTaskManagerAccelByte::HasFreeSlot(EAccelByteAsyncTaskPriority Priority) const
+{
+	const int32 Index = static_cast<int32>(Priority);
+	return MaxParallelTasksPerPriority[Index] <= 0 || ActiveParallelTaskCount[Index] < MaxParallelTasksPerPriority[Index];
 }
 
-void FOnlineAsyncTaskManagerAccelByte::CheckMaxParallelTasks()
+void FOnlineAsyncTaskManagerAccelByte::MarkAdmitted(FOnlineAsyncTask* Task, EAccelByteAsyncTaskPriority Priority)
 {
-#if !UE_BUILD_SHIPPING && (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 27)
-	if (MaxParallelTasks == ParallelTasks.Num())
+	ActiveParallelTaskCount[static_cast<int32>(Priority)]++;
+	ActiveParallelTaskPriorities.Add(Task, Priority);
+}
+
+void FOnlineAsyncTaskManagerAccelByte::AdmitPendingParallelTasks()
+{
+	TArray<FOnlineAsyncTask*> AdmittedTasks;
+	{
+		FScopeLock Lock(&SchedulerLock);
+
+		const auto TryAdmitOne = [this, &AdmittedTasks](EAccelByteAsyncTaskPriority Priority) -> bool
+		{
+			const int32 Index = static_cast<int32>(Priority);
+			FOnlineAsyncTask* Task = nullptr;
+			if (PendingParallelTaskCount[Index] <= 0 || !HasFreeSlot(Priority) || !PendingParallelTasks[Index].Dequeue(Task))
+			{
+				return false;
+			}
+
+			PendingParallelTaskCount[Index]--;
+			MarkAdmitted(Task, Priority);
+			AdmittedTasks.Add(Task);
+			return true;
+		};
+
+		// Critical tasks never wait behind lower priority classes
+		while (TryAdmitOne(EAccelByteAsyncTaskPriority::Critical))
+		{
+		}
+
+		// Hand the remaining slots to Normal and Background tasks in a weighted round robin, stopping once a full round
+		// over AdmissionOrder could not admit anything
+		const int32 OrderNum = UE_ARRAY_COUNT(AdmissionOrder);
+		int32 RoundsWithoutAdmission = 0;
+		while (RoundsWithoutAdmission < OrderNum)
+		{
+			const EAccelByteAsyncTaskPriority Priority = AdmissionOrder[AdmissionCursor];
+			AdmissionCursor = (AdmissionCursor + 1) % OrderNum;
+
+			RoundsWithoutAdmission = TryAdmitOne(Priority) ? 0 : RoundsWithoutAdmission + 1;
+		}
+	}
+
+	for (FOnlineAsyncTask* Task : AdmittedTasks)
+	{
+		AddToParallelTasks(Task);
+	}
+}
+
+bool FOnlineAsyncTaskManagerAccelByte::TryCoalesceTask(FOnlineAsyncTaskAccelByte* NewTask)
+{
+	if (NewTask == nullptr)
+	{
+		return false;
+	}
+
+	const FString CoalescingKey = NewTask->GetCoalescingKey();
+	if (CoalescingKey.IsEmpty())
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&CoalescingLock);
+
+	FCoalescedTaskGroup* Group = CoalescedTaskGroups.Find(CoalescingKey);
+	if (Group == nullptr)
+	{
+		FCoalescedTaskGroup& NewGroup = CoalescedTaskGroups.Add(CoalescingKey);
+		NewGroup.InFlightTask = NewTask;
+		CoalescingKeyByInFlightTask.Add(static_cast<FOnlineAsyncItem*>(NewTask), CoalescingKey);
+		return false;
+	}
+
+	Group->AttachedTasks.Add(NewTask);
+	UE_LOG_AB(Verbose, TEXT("Coalesced async task with key '%s' into the in flight task, %d task(s) now attached."), *CoalescingKey, Group->AttachedTasks.Num());
+	return true;
+}
+
+int32 FOnlineAsyncTaskManagerAccelByte::GetCoalescedTaskCount(const FString& CoalescingKey) const
+{
+	FScopeLock Lock(&CoalescingLock);
+
+	const FCoalescedTaskGroup* Group = CoalescedTaskGroups.Find(CoalescingKey);
+	return (Group != nullptr) ? Group->AttachedTasks.Num() : 0;
+}
+
+void FOnlineAsyncTaskManagerAccelByte::CompleteCoalescedTasks(FOnlineAsyncTaskAccelByte* CompletedTask)
+{
+	FCoalescedTaskGroup Group;
+	{
+		FScopeLock Lock(&CoalescingLock);
+
+		// Removing the group here means that identical tasks dispatched from now on start a request of their own
+		FString CoalescingKey;
+		if (!CoalescingKeyByInFlightTask.RemoveAndCopyValue(static_cast<FOnlineAsyncItem*>(CompletedTask), CoalescingKey))
+		{
+			return;
+		}
+		CoalescedTaskGroups.RemoveAndCopyValue(CoalescingKey, Group);
+	}
+
+	for (FOnlineAsyncTaskAccelByte* AttachedTask : Group.AttachedTasks)
 	{
-		UE_LOG(LogAccelByteOSS, Warning, TEXT("The number of Parallel Tasks has reached it cap: %d, Please put some delay between each tasks."), MaxParallelTasks);
+		AttachedTask->CompleteAsCoalescedTask(*CompletedTask);
+		AddToOutQueue(AttachedTask);
 	}
-#endif
 }
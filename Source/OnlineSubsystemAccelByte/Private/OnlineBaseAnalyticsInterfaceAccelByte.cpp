@@ -4,6 +4,7 @@
 #include "OnlineBaseAnalyticsInterfaceAccelByte.h"
 #include "OnlineSubsystemAccelByteInternalHelpers.h"
 #include "OnlineSubsystemUtils.h"
+#include "Misc/Paths.h"
 
 #define ONLINE_ERROR_NAMESPACE "FOnlineAccelByteAnalytics"
 void FOnlineBaseAnalyticsAccelByte::OnSuccess(int32 LocalUserNum, FString EventName)
@@ -49,49 +50,130 @@ void FOnlineBaseAnalyticsAccelByte::OnLocalUserNumCachedSuccess()
 }
 #undef ONLINE_ERROR_NAMESPACE
 
-void FOnlineBaseAnalyticsAccelByte::AddToCache(int32 LocalUserNum, const TSharedPtr<FAccelByteModelsTelemetryBody>& Cache)
+/**
+ * Load a setting of the events cached before login that has to be greater than zero, keeping the default otherwise.
+ */
+static void LoadPositiveCachedEventsConfig(const TCHAR* Key, int32& Value)
 {
-	FScopeLock ScopeLock(&CachedEventsLock);
-	auto CachedEvent =  CachedEvents.Find(LocalUserNum);
-	if (CachedEvent == nullptr)
+	const int32 DefaultValue = Value;
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), Key, Value))
+	{
+		UE_LOG_AB(Verbose, TEXT("'%s' is not specified in DefaultEngine.ini, or on command line. Defaulting to %d."), Key, Value);
+	}
+	else if (Value <= 0)
 	{
-		CachedEvents.Emplace(LocalUserNum, TArray<TSharedPtr<FAccelByteModelsTelemetryBody>>());
-		CachedEvent = CachedEvents.Find(LocalUserNum);
+		UE_LOG_AB(Warning, TEXT("'%s' is set to %d in DefaultEngine.ini, or on command line, but has to be greater than zero. Defaulting to %d."), Key, Value, DefaultValue);
+		Value = DefaultValue;
 	}
-	CachedEvent->Add(Cache);
 }
 
-void FOnlineBaseAnalyticsAccelByte::MoveTempUserCachedEvent(int32 To)
+void FOnlineBaseAnalyticsAccelByte::Init()
 {
-	FScopeLock ScopeLock(&CachedEventsLock);
-	const int32 TempLocalUserNum = -1;
-	auto CachedEvent = CachedEvents.Find(TempLocalUserNum);
-	if (CachedEvent != nullptr)
+	int32 MaxInMemoryEvents = 256;
+	LoadPositiveCachedEventsConfig(TEXT("TelemetryEventSpillMaxInMemoryEvents"), MaxInMemoryEvents);
+	CachedEvents.SetMaxInMemoryEvents(MaxInMemoryEvents);
+
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableBatchedTelemetryReplay"), bIsCachedEventReplayBatched))
+	{
+		UE_LOG_AB(Verbose, TEXT("'bEnableBatchedTelemetryReplay' is not specified in DefaultEngine.ini, or on command line. Defaulting to '%s'."), LOG_BOOL_FORMAT(bIsCachedEventReplayBatched));
+	}
+
+	int32 ReplayMaxBatchEvents = 50;
+	LoadPositiveCachedEventsConfig(TEXT("TelemetryReplayMaxBatchEvents"), ReplayMaxBatchEvents);
+	int32 ReplayMaxBatchSizeKB = 64;
+	LoadPositiveCachedEventsConfig(TEXT("TelemetryReplayMaxBatchSizeKB"), ReplayMaxBatchSizeKB);
+	CachedEventReplay.SetBatchLimits(ReplayMaxBatchEvents, ReplayMaxBatchSizeKB * 1024);
+
+	// Using int here as 'LoadABConfigFallback' does not have an override for double values
+	int32 ReplayBatchIntervalMilliseconds = 1000;
+	LoadPositiveCachedEventsConfig(TEXT("TelemetryReplayBatchIntervalMilliseconds"), ReplayBatchIntervalMilliseconds);
+	double ReplayBatchIntervalSeconds = ReplayBatchIntervalMilliseconds / 1000.0;
+
+	// The SDK sends what it has queued once per batch frequency, so there is no point in handing it batches any faster
+	if (bIsHaveSettingInterval && SettingInterval > 0)
+	{
+		ReplayBatchIntervalSeconds = SettingInterval;
+	}
+	CachedEventReplay.SetBatchInterval(ReplayBatchIntervalSeconds);
+
+	// Dedicated servers have no login to wait for, so they have nothing to spill
+	bool bEnableSpillFile = true;
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableTelemetryEventSpillFile"), bEnableSpillFile))
 	{
-		CachedEvents.Emplace(To, *CachedEvent);
-		CachedEvents.Remove(TempLocalUserNum);
+		UE_LOG_AB(Verbose, TEXT("'bEnableTelemetryEventSpillFile' is not specified in DefaultEngine.ini, or on command line. Defaulting to '%s'."), LOG_BOOL_FORMAT(bEnableSpillFile));
 	}
+	if (!bEnableSpillFile || CachedEventsName.IsEmpty() || IsRunningDedicatedServer() || AccelByteSubsystem == nullptr)
+	{
+		return;
+	}
+
+	int32 MaxFileSizeMB = 64;
+	LoadPositiveCachedEventsConfig(TEXT("TelemetryEventSpillMaxFileSizeMB"), MaxFileSizeMB);
+
+	const FString FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByte"), FString::Printf(TEXT("%s_%s.bin"), *CachedEventsName, *AccelByteSubsystem->GetInstanceName().ToString()));
+	if (!CachedEvents.OpenSpillFile(FilePath, static_cast<int64>(MaxFileSizeMB) * 1024 * 1024))
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to open telemetry spill file %s, events cached before login are kept in memory only"), *FilePath);
+		return;
+	}
+
+	const int32 PreviousRunEventCount = CachedEvents.GetEventCount();
+	if (PreviousRunEventCount > 0)
+	{
+		UE_LOG_AB(Log, TEXT("Found %d telemetry events left in %s by a previous run, replaying those owned by the next user to log in"), PreviousRunEventCount, *FilePath);
+		SetDelegatesAndInterval(-1);
+	}
+}
+
+void FOnlineBaseAnalyticsAccelByte::Tick(float DeltaTime)
+{
+	CachedEventReplay.Tick(FPlatformTime::Seconds(), CachedEvents, [this](int32 LocalUserNum, const TArray<TSharedPtr<FAccelByteModelsTelemetryBody>>& Batch, int32 BatchSize)
+	{
+		UE_LOG_AB(Verbose, TEXT("Replaying a batch of %d cached telemetry events (%d bytes) for local user %d"), Batch.Num(), BatchSize, LocalUserNum);
+		for (const TSharedPtr<FAccelByteModelsTelemetryBody>& Cache : Batch)
+		{
+			SendCachedEvent(LocalUserNum, Cache);
+		}
+	});
+}
+
+void FOnlineBaseAnalyticsAccelByte::AddToCache(int32 LocalUserNum, const TSharedPtr<FAccelByteModelsTelemetryBody>& Cache)
+{
+	CachedEvents.Enqueue(LocalUserNum, Cache);
+}
+
+void FOnlineBaseAnalyticsAccelByte::MoveTempUserCachedEvent(int32 To)
+{
+	const int32 TempLocalUserNum = -1;
+	CachedEvents.MoveEvents(TempLocalUserNum, To);
 }
 
 void FOnlineBaseAnalyticsAccelByte::OnLoginSuccess(int32 LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FOnlineErrorAccelByte& Error)
 {
-	if (bWasSuccessful)
+	if (!bWasSuccessful)
 	{
-		FScopeLock ScopeLock(&CachedEventsLock);
-		auto CachedEvent = CachedEvents.Find(LocalUserNum);
+		return;
+	}
+
+	// Events left by a previous run are only replayed for the user that owned them
+	const FUniqueNetIdAccelByteUserPtr AccelByteUserId = FUniqueNetIdAccelByteUser::TryCast(UserId);
+	CachedEvents.SetOwner(LocalUserNum, AccelByteUserId.IsValid() ? AccelByteUserId->GetAccelByteId() : FString());
+
+	// Batched replays pull their events from the spill queue in Tick, spread over as many ticks as the batch limits call
+	// for, so that events stay in the spill queue until they are sent
+	if (bIsCachedEventReplayBatched)
+	{
+		CachedEventReplay.Add(LocalUserNum);
+		return;
+	}
 
-		if (CachedEvent != nullptr)
+	CachedEvents.ReplayEvents(LocalUserNum, [this, LocalUserNum](const TSharedPtr<FAccelByteModelsTelemetryBody>& Cache)
+	{
+		if (Cache.IsValid())
 		{
-			for (const auto& Cache : *CachedEvent)
-			{
-				if (Cache.IsValid())
-				{
-					SendCachedEvent(LocalUserNum, Cache);
-				}
-			}
-			CachedEvent->Empty();
+			SendCachedEvent(LocalUserNum, Cache);
 		}
-	}
+	});
 }
 
 void FOnlineBaseAnalyticsAccelByte::OnLogoutSuccess(int32 LocalUserNum, bool bWasSuccessful, const FOnlineErrorAccelByte& Error)
@@ -99,8 +181,8 @@ void FOnlineBaseAnalyticsAccelByte::OnLogoutSuccess(int32 LocalUserNum, bool bWa
 	if (bWasSuccessful)
 	{
 		SetEventIntervalMap.Remove(LocalUserNum);
-		FScopeLock ScopeLock(&CachedEventsLock);
-		CachedEvents.Remove(LocalUserNum);
+		CachedEventReplay.Remove(LocalUserNum);
+		CachedEvents.RemoveEvents(LocalUserNum);
 	}
 }
 
@@ -48,7 +48,25 @@ bool FOnlineChatAccelByte::GetFromWorld(const UWorld* World, FOnlineChatAccelByt
 
 FOnlineChatAccelByte::FOnlineChatAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
 	: AccelByteSubsystem(InSubsystem)
-{}
+{
+	int32 ConfigMaxCachedChatMessagesPerRoom = MaxCachedChatMessagesPerRoom;
+	if (FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("MaxCachedChatMessagesPerRoom"), ConfigMaxCachedChatMessagesPerRoom))
+	{
+		MaxCachedChatMessagesPerRoom = FMath::Max(ConfigMaxCachedChatMessagesPerRoom, 1);
+	}
+
+	int32 ConfigTopicQueryPageSize = TopicQueryPageSize;
+	if (FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("ChatTopicQueryPageSize"), ConfigTopicQueryPageSize))
+	{
+		TopicQueryPageSize = FMath::Max(ConfigTopicQueryPageSize, 1);
+	}
+
+	int32 ConfigMaxTopicQueryPagesInFlight = MaxTopicQueryPagesInFlight;
+	if (FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("MaxChatTopicQueryPagesInFlight"), ConfigMaxTopicQueryPagesInFlight))
+	{
+		MaxTopicQueryPagesInFlight = FMath::Max(ConfigMaxTopicQueryPagesInFlight, 1);
+	}
+}
 
 bool FOnlineChatAccelByte::Connect(int32 LocalUserNum)
 {
@@ -535,27 +553,25 @@ bool FOnlineChatAccelByte::GetLastMessages(
 		RoomIdToLoad = PersonalChatTopicId(AccelByteUserId->GetAccelByteId(), RoomId);
 	}
 
-	FChatRoomIdToChatMessages* RoomIdToChatMessages = UserIdToChatRoomMessagesCached.Find(AccelByteUserId);
+	FChatRoomIdToChatMessageRingBuffer* RoomIdToChatMessages = UserIdToChatRoomMessagesCached.Find(AccelByteUserId);
 	if (RoomIdToChatMessages == nullptr)
 	{
 		AB_OSS_INTERFACE_TRACE_END_VERBOSITY(Warning, TEXT("Failed to get last messages from room with ID %s as the room was not found!"), *RoomId);
 		return false;
 	}
-	TArray<TSharedRef<FChatMessage>>* Messages = RoomIdToChatMessages->Find(RoomIdToLoad);
+	const FChatMessageRingBuffer* Messages = RoomIdToChatMessages->Find(RoomIdToLoad);
 	if (Messages == nullptr)
 	{
 		AB_OSS_INTERFACE_TRACE_END_VERBOSITY(Warning, TEXT("Failed to get last messages from room with ID %s as the room has no messages!"), *RoomId);
 		return false;
 	}
 
-	TArray<TSharedRef<FChatMessage>> MsgList = *Messages;
-
-	const int32 TotalMessages = MsgList.Num();
-	const int32 LastIndex = FMath::Max(TotalMessages - NumMessages, 0);
-	for (int32 i = TotalMessages - 1; i >= LastIndex; i--)
+	// Newest message first, read straight out of the cache rather than copying the room history
+	OutMessages.Reserve(OutMessages.Num() + FMath::Clamp(NumMessages, 0, Messages->Num()));
+	Messages->ForEachFromNewest(NumMessages, [&OutMessages](const TSharedRef<FChatMessage>& Message)
 	{
-		OutMessages.Add(MsgList[i]);
-	}
+		OutMessages.Add(Message);
+	});
 
 	AB_OSS_INTERFACE_TRACE_END(TEXT("Number of messages: %d"), OutMessages.Num());
 
@@ -675,14 +691,15 @@ void FOnlineChatAccelByte::AddChatRoomMembers(TArray<FAccelByteUserInfoRef> User
 
 void FOnlineChatAccelByte::AddChatMessage(FUniqueNetIdAccelByteUserRef AccelByteUserId, const FChatRoomId& ChatRoomId, TSharedRef<FChatMessage> ChatMessage)
 {
-	FChatRoomIdToChatMessages& RoomIdToChatMessages = UserIdToChatRoomMessagesCached.FindOrAdd(AccelByteUserId);
-	TArray<TSharedRef<FChatMessage>>& ChatMessages = RoomIdToChatMessages.FindOrAdd(ChatRoomId);
-	ChatMessages.Add(ChatMessage);
-	if (ChatMessages.Num() > 1000)
+	FChatRoomIdToChatMessageRingBuffer& RoomIdToChatMessages = UserIdToChatRoomMessagesCached.FindOrAdd(AccelByteUserId);
+	FChatMessageRingBuffer* ChatMessages = RoomIdToChatMessages.Find(ChatRoomId);
+	if (ChatMessages == nullptr)
 	{
-		// TODO: optimize this expensive operation
-		ChatMessages.RemoveAt(0);
+		ChatMessages = &RoomIdToChatMessages.Add(ChatRoomId, FChatMessageRingBuffer(MaxCachedChatMessagesPerRoom));
 	}
+
+	// Once the room is full this overwrites its oldest message in place
+	ChatMessages->Add(MoveTemp(ChatMessage));
 }
 
 FAccelByteChatRoomMemberRef FOnlineChatAccelByte::GetAccelByteChatRoomMember(const FString& UserId)
@@ -700,6 +717,14 @@ FAccelByteChatRoomMemberRef FOnlineChatAccelByte::GetAccelByteChatRoomMember(con
 	return Member;
 }
 
+TSharedRef<FAccelByteChatMessage> FOnlineChatAccelByte::CreateChatMessage(const FAccelByteModelsChatNotif& ChatNotif)
+{
+	// A handful of senders usually make up most of the messages of a room, so rather than building a new ID for every
+	// message, reuse the ID of the cached member. Only a sender seen for the first time has an ID built for them.
+	const FAccelByteChatRoomMemberRef Member = GetAccelByteChatRoomMember(ChatNotif.From);
+	return MakeShared<FAccelByteChatMessage>(Member->GetUserId(), Member->GetNickname(), ChatNotif.Message, ChatNotif.CreatedAt);
+}
+
 void FOnlineChatAccelByte::RegisterChatDelegates(const FUniqueNetId& PlayerId)
 {
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("PlayerId: %s"), *PlayerId.ToDebugString());
@@ -768,17 +793,9 @@ void FOnlineChatAccelByte::RegisterChatDelegates(const FUniqueNetId& PlayerId)
 	ApiClient->Chat.SetSystemMessageNotifDelegate(OnSystemMessageDelegate);
 	//~ End Chat Notifications
 
-	// Cache topic data
-	FAccelByteModelsChatQueryTopicRequest QueryTopicRequest;
-	// TODO: get all topic data if the user has more that 200 topics (should be working for most of cases now)
-	QueryTopicRequest.Offset = 0;
-	QueryTopicRequest.Limit = 200;
-	const FOnChatQueryRoomComplete OnQueryTopicResponse = FOnChatQueryRoomComplete::CreateThreadSafeSP(SharedThis(this), &FOnlineChatAccelByte::OnQueryChatRoomInfoComplete);
-
-	FOnlineAsyncTaskInfo TaskInfo;
-	TaskInfo.Type = ETypeOfOnlineAsyncTask::Parallel;
-	TaskInfo.bCreateEpicForThis = true;
-	AccelByteSubsystem->CreateAndDispatchAsyncTask<FOnlineAsyncTaskAccelByteChatQueryRoom>(TaskInfo, AccelByteSubsystem, PlayerId, QueryTopicRequest, OnQueryTopicResponse);
+	// Cache topic data, the first page is queried right away and any further pages in the background. Each page adds
+	// its topics to the cache as it comes back.
+	StartTopicQuery(LocalUserNum, PlayerId.AsShared());
 
 	AB_OSS_INTERFACE_TRACE_END(TEXT(""));
 }
@@ -866,7 +883,7 @@ void FOnlineChatAccelByte::OnAddToTopicNotification(const FAccelByteModelsChatUp
 	}
 	else
 	{
-		UE_LOG_AB(Verbose, TEXT("ChatRoomInfo for room ID %s found. Current member num: %d, adding member with ID %s"), *AddTopicEvent.TopicId, (*ChatRoomInfo)->GetMembers().Num(), *AddTopicEvent.SenderId);
+		UE_LOG_AB(Verbose, TEXT("ChatRoomInfo for room ID %s found. Current member num: %d, adding member with ID %s"), *AddTopicEvent.TopicId, (*ChatRoomInfo)->GetMemberCount(), *AddTopicEvent.SenderId);
 		(*ChatRoomInfo)->AddMember(AddTopicEvent.SenderId);
 				
 		FAccelByteChatRoomMemberRef* MemberPtr = UserIdToChatRoomMemberCached.Find(AddTopicEvent.SenderId);
@@ -924,15 +941,10 @@ void FOnlineChatAccelByte::OnReceivedChatNotification(const FAccelByteModelsChat
 		return;
 	}
 
-	FAccelByteUniqueIdComposite SenderCompositeId;
-	SenderCompositeId.Id = ChatNotif.From;
-	FUniqueNetIdAccelByteUserPtr SenderUserId = FUniqueNetIdAccelByteUser::Create(SenderCompositeId);
-
 	FChatRoomId OutChatRoomId = ChatNotif.TopicId;
 	const EAccelByteChatRoomType RoomType = GetChatRoomType(ChatNotif.TopicId);
 
-	FAccelByteChatRoomMemberRef Member = GetAccelByteChatRoomMember(ChatNotif.From);
-	TSharedRef<FAccelByteChatMessage> OutChatMessage = MakeShared<FAccelByteChatMessage>(SenderUserId.ToSharedRef(), Member->GetNickname(), ChatNotif.Message, ChatNotif.CreatedAt);
+	TSharedRef<FAccelByteChatMessage> OutChatMessage = CreateChatMessage(ChatNotif);
 
 	const FUniqueNetIdAccelByteUserRef AccelByteUserId = FUniqueNetIdAccelByteUser::CastChecked(LocalUserId.ToSharedRef());
 	AddChatMessage(AccelByteUserId, OutChatRoomId, OutChatMessage);
@@ -1051,9 +1063,66 @@ void FOnlineChatAccelByte::OnSystemMessageNotification(const FAccelByteModelsCha
 	AB_OSS_INTERFACE_TRACE_END(TEXT(""));
 }
 
-void FOnlineChatAccelByte::OnQueryChatRoomInfoComplete(bool bWasSuccessful, TArray<FAccelByteChatRoomInfoRef> RoomList, int32 LocalUserNum)
+void FOnlineChatAccelByte::StartTopicQuery(int32 LocalUserNum, const FUniqueNetIdRef& LocalUserId)
+{
+	// Replaces the query of a previous connection if it is still running, its pages are ignored from then on
+	const TSharedRef<FAccelBytePagedQuery, ESPMode::ThreadSafe> TopicQuery = MakeShared<FAccelBytePagedQuery, ESPMode::ThreadSafe>(TopicQueryPageSize, MaxTopicQueryPagesInFlight);
+	LocalUserNumToTopicQuery.Add(LocalUserNum, TopicQuery);
+	SendTopicQueryPages(LocalUserNum, LocalUserId, TopicQuery);
+}
+
+void FOnlineChatAccelByte::SendTopicQueryPages(int32 LocalUserNum, const FUniqueNetIdRef& LocalUserId, const TSharedRef<FAccelBytePagedQuery, ESPMode::ThreadSafe>& TopicQuery)
+{
+	TopicQuery->SendPendingPages([this, LocalUserNum, LocalUserId, &TopicQuery](int32 PageIndex, int32 Offset, int32 Limit)
+	{
+		SendTopicQueryPage(LocalUserNum, LocalUserId, PageIndex, Offset, Limit, TopicQuery);
+	});
+}
+
+void FOnlineChatAccelByte::SendTopicQueryPage(int32 LocalUserNum, const FUniqueNetIdRef& LocalUserId, int32 PageIndex, int32 Offset, int32 Limit, const TSharedRef<FAccelBytePagedQuery, ESPMode::ThreadSafe>& TopicQuery)
 {
-	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("Room length %d"), RoomList.Num());
+	FAccelByteModelsChatQueryTopicRequest QueryTopicRequest;
+	QueryTopicRequest.Offset = Offset;
+	QueryTopicRequest.Limit = Limit;
+	const FOnChatQueryRoomComplete OnQueryTopicResponse = FOnChatQueryRoomComplete::CreateThreadSafeSP(SharedThis(this), &FOnlineChatAccelByte::OnQueryChatRoomInfoComplete, LocalUserId, PageIndex, TopicQuery);
+
+	FOnlineAsyncTaskInfo TaskInfo;
+	TaskInfo.Type = ETypeOfOnlineAsyncTask::Parallel;
+	TaskInfo.bCreateEpicForThis = true;
+	AccelByteSubsystem->CreateAndDispatchAsyncTask<FOnlineAsyncTaskAccelByteChatQueryRoom>(TaskInfo, AccelByteSubsystem, LocalUserId.Get(), QueryTopicRequest, OnQueryTopicResponse);
+}
+
+void FOnlineChatAccelByte::OnQueryChatRoomInfoComplete(bool bWasSuccessful, TArray<FAccelByteChatRoomInfoRef> RoomList, int32 LocalUserNum, FUniqueNetIdRef LocalUserId, int32 PageIndex, TSharedRef<FAccelBytePagedQuery, ESPMode::ThreadSafe> TopicQuery)
+{
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("Page %d, room length %d"), PageIndex, RoomList.Num());
+
+	// The rooms of this page are already cached by the query task, only the paging is left to handle here
+	const TSharedRef<FAccelBytePagedQuery, ESPMode::ThreadSafe>* CurrentTopicQuery = LocalUserNumToTopicQuery.Find(LocalUserNum);
+	if (CurrentTopicQuery == nullptr || *CurrentTopicQuery != TopicQuery)
+	{
+		AB_OSS_INTERFACE_TRACE_END(TEXT("Topic query was replaced by a newer connection, ignoring page %d"), PageIndex);
+		return;
+	}
+
+	if (!bWasSuccessful)
+	{
+		if (TopicQuery->Fail())
+		{
+			UE_LOG_AB(Warning, TEXT("Failed to query topic page %d for user at index %d, %d topics were cached before the failure"), PageIndex, LocalUserNum, TopicQuery->GetItemCount());
+		}
+		LocalUserNumToTopicQuery.Remove(LocalUserNum);
+		AB_OSS_INTERFACE_TRACE_END(TEXT(""));
+		return;
+	}
+
+	if (TopicQuery->CompletePage(PageIndex, RoomList.Num()))
+	{
+		LocalUserNumToTopicQuery.Remove(LocalUserNum);
+		AB_OSS_INTERFACE_TRACE_END(TEXT("Queried all %d topics"), TopicQuery->GetItemCount());
+		return;
+	}
+
+	SendTopicQueryPages(LocalUserNum, LocalUserId, TopicQuery);
 
 	AB_OSS_INTERFACE_TRACE_END(TEXT(""));
 }
@@ -1193,7 +1262,7 @@ FAccelByteChatRoomInfoRef FAccelByteChatRoomInfo::Create()
 
 bool FAccelByteChatRoomInfo::HasMember(const FString& UserId) const
 {
-	return TopicData.Members.Contains(UserId);
+	return MemberIndices.Contains(UserId);
 }
 
 const TArray<FString>& FAccelByteChatRoomInfo::GetMembers() const
@@ -1201,9 +1270,15 @@ const TArray<FString>& FAccelByteChatRoomInfo::GetMembers() const
 	return TopicData.Members;
 }
 
+int32 FAccelByteChatRoomInfo::GetMemberCount() const
+{
+	return TopicData.Members.Num();
+}
+
 void FAccelByteChatRoomInfo::SetTopicData(const FAccelByteModelsChatTopicQueryData& InTopicData)
 {
 	TopicData = InTopicData;
+	RebuildMemberIndices();
 
     // NOTE: actually the topic don't have an owner, so we set first member as the owner
 	if (TopicData.Members.Num() > 0)
@@ -1240,12 +1315,51 @@ void FAccelByteChatRoomInfo::UpdateTopicData(const FAccelByteModelsChatUpdateTop
 
 void FAccelByteChatRoomInfo::AddMember(const FString& UserId)
 {
-	TopicData.Members.AddUnique(UserId);
+	if (MemberIndices.Contains(UserId))
+	{
+		return;
+	}
+
+	MemberIndices.Add(UserId, TopicData.Members.Add(UserId));
 }
 
 void FAccelByteChatRoomInfo::RemoveMember(const FString& UserId)
 {
-	TopicData.Members.Remove(UserId);
+	int32 MemberIndex = INDEX_NONE;
+	if (!MemberIndices.RemoveAndCopyValue(UserId, MemberIndex))
+	{
+		return;
+	}
+
+	// Move the last member into the freed slot rather than shifting every member after it
+	TopicData.Members.RemoveAtSwap(MemberIndex);
+	if (MemberIndex < TopicData.Members.Num())
+	{
+		MemberIndices.FindChecked(TopicData.Members[MemberIndex]) = MemberIndex;
+	}
+}
+
+void FAccelByteChatRoomInfo::RebuildMemberIndices()
+{
+	MemberIndices.Reset();
+	MemberIndices.Reserve(TopicData.Members.Num());
+
+	int32 UniqueCount = 0;
+	for (int32 Index = 0; Index < TopicData.Members.Num(); Index++)
+	{
+		if (MemberIndices.Contains(TopicData.Members[Index]))
+		{
+			continue;
+		}
+
+		MemberIndices.Add(TopicData.Members[Index], UniqueCount);
+		if (UniqueCount != Index)
+		{
+			TopicData.Members[UniqueCount] = MoveTemp(TopicData.Members[Index]);
+		}
+		UniqueCount++;
+	}
+	TopicData.Members.SetNum(UniqueCount);
 }
 
 bool FOnlineChatAccelByte::UpdateUserAccount(const int32 LocalUserNum)
@@ -36,6 +36,7 @@
 #include "AsyncTasks/Identity/OnlineAsyncTaskAccelByteGenerateCodeForPublisherToken.h"
 #include "AsyncTasks/LoginQueue/OnlineAsyncTaskAccelByteLoginQueueCancelTicket.h"
 #include "OnlineSessionInterfaceV2AccelByte.h"
+#include "OnlineUserCacheAccelByte.h"
 
 using namespace AccelByte;
 
@@ -853,6 +854,14 @@ void FOnlineIdentityAccelByte::OnLogout(const int32 LocalUserNum, bool bWasSucce
 	}
 #endif
 
+	// Queries still waiting to be batched would otherwise be dispatched for a user that is no longer logged in
+	const FOnlineSubsystemAccelBytePtr LogoutSubsystem = AccelByteSubsystem.Pin();
+	const FOnlineUserCacheAccelBytePtr UserCache = LogoutSubsystem.IsValid() ? LogoutSubsystem->GetUserCache() : nullptr;
+	if (UserCache.IsValid())
+	{
+		UserCache->FailPendingUserQueries(LocalUserNum);
+	}
+
 	// Signal to game client that log out has completed
 	TriggerOnLogoutCompleteDelegates(LocalUserNum, bWasSuccessful);
 	TriggerAccelByteOnLogoutCompleteDelegates(LocalUserNum, bWasSuccessful, ONLINE_ERROR_ACCELBYTE(bWasSuccessful? TEXT("") : TEXT("error-failed-to-logout"), bWasSuccessful? EOnlineErrorResult::Success : EOnlineErrorResult::RequestFailure));
@@ -1667,6 +1667,12 @@ void FOnlineSessionV1AccelByte::OnValidQueryPacketReceived(uint8* PacketData, in
 		if (Session && IsSessionJoinable(*Session))
 		{
 			FNboSerializeToBufferAccelByte Packet(LAN_BEACON_MAX_PACKET_SIZE);
+
+			// Compact IDs can only be read by clients that have the compact ID codec, so they are opt in
+			bool bUseCompactUniqueIdSerialization = false;
+			FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bUseCompactUniqueIdSerialization"), bUseCompactUniqueIdSerialization);
+			Packet.SetUseCompactUniqueIds(bUseCompactUniqueIdSerialization);
+
 			LANSessionManager.CreateHostResponsePacket(Packet, ClientNonce);
 			AppendSessionToPacket(Packet, Session);
 			if (!Packet.HasOverflow())
@@ -81,6 +81,20 @@ using namespace AccelByte;
 
 #define ONLINE_ERROR_NAMESPACE "FOnlineSessionV2AccelByte"
 #define ACCELBYTE_P2P_TRAVEL_URL_FORMAT TEXT("accelbyte.%s:%d")
+#define MATCH_TICKET_CHECK_POLL_KEY TEXT("MatchTicketCheck")
+
+namespace
+{
+	FString MakeSessionServerCheckPollKey(const FUniqueNetIdPtr& SearchingPlayerId, const FName SessionName)
+	{
+		return FString::Printf(TEXT("SessionServerCheck:%s:%s"), *SessionName.ToString(), SearchingPlayerId.IsValid() ? *SearchingPlayerId->ToString() : TEXT(""));
+	}
+
+	FString MakeSessionInviteCheckPollKey(const FUniqueNetIdPtr& SearchingPlayerId, const FString& SessionId)
+	{
+		return FString::Printf(TEXT("SessionInviteCheck:%s:%s"), *SessionId, SearchingPlayerId.IsValid() ? *SearchingPlayerId->ToString() : TEXT(""));
+	}
+}
 
 FOnlineSessionInfoAccelByteV2::FOnlineSessionInfoAccelByteV2(const FString& SessionIdStr)
 	: SessionId(FUniqueNetIdAccelByteResource::Create(SessionIdStr))
@@ -716,6 +730,12 @@ void FOnlineSessionV2AccelByte::Init()
 		bManualRegisterServer = false;
 	}
 
+	if (FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bUseSessionAttributeMergePatch"), bUseSessionAttributeMergePatch) == false)
+	{
+		// If the configuration field not found
+		bUseSessionAttributeMergePatch = false;
+	}
+
 	if (IsRunningDedicatedServer())
 	{
 		const FOnServerReceivedSessionDelegate OnServerReceivedSessionDelegate = FOnServerReceivedSessionDelegate::CreateThreadSafeSP(SharedThis(this), &FOnlineSessionV2AccelByte::OnServerReceivedSessionComplete_Internal);
@@ -737,51 +757,56 @@ void FOnlineSessionV2AccelByte::UpdateSessionEntries()
 	
 	FScopeLock ScopeLock(&SessionLock);
 
-	for (TPair<FName, TSharedPtr<FNamedOnlineSession>>& SessionEntry : Sessions)
+	// Take every queued session off the queue before applying any update, so that updates queued while these are being
+	// applied are picked up on the next tick. Sessions that still have to wait are queued again as we go.
+	TArray<FName> SessionNamesToUpdate = MoveTemp(PendingQueuedUpdateQueue);
+	PendingQueuedUpdateQueue.Reset();
+	for (const FName& SessionName : SessionNamesToUpdate)
 	{
-		int32 PendingUpdateIndex = SessionsWithPendingQueuedUpdates.IndexOfByPredicate([SessionName = SessionEntry.Key](const FName& PendingUpdateSessionName) {
-			return PendingUpdateSessionName.IsEqual(SessionName);
-		});
+		SessionsWithPendingQueuedUpdates.Remove(SessionName);
+	}
 
-		if (PendingUpdateIndex == INDEX_NONE)
+	for (const FName& SessionName : SessionNamesToUpdate)
+	{
+		// Looked up again for every session, as the delegates fired for previous sessions may have removed this one
+		const TSharedPtr<FNamedOnlineSession>* FoundSession = Sessions.Find(SessionName);
+		if (FoundSession == nullptr)
 		{
-			// Session does not have an update pending, bail out
+			// Session was removed after the update was queued, so there is nothing left to apply the update to
 			continue;
 		}
 
-		if (!ensure(SessionEntry.Value.IsValid()))
+		const TSharedPtr<FNamedOnlineSession> Session = *FoundSession;
+		if (!ensure(Session.IsValid()))
 		{
 			UE_LOG_AB(Warning, TEXT("Could not check session for updates as the session is invalid!"));
 			continue;
 		}
 
-		if (SessionEntry.Value->SessionState == EOnlineSessionState::Creating || SessionEntry.Value->SessionState == EOnlineSessionState::Destroying)
+		if (Session->SessionState == EOnlineSessionState::Creating || Session->SessionState == EOnlineSessionState::Destroying)
 		{
 			// Do not attempt to update a session that is creating or destroying, as those states will not have valid session
 			// info or backend data
-			UE_LOG_AB(VeryVerbose, TEXT("Ignoring updating session named %s as it is still in the %s state."), *SessionEntry.Key.ToString(), EOnlineSessionState::ToString(SessionEntry.Value->SessionState));
+			UE_LOG_AB(VeryVerbose, TEXT("Ignoring updating session named %s as it is still in the %s state."), *SessionName.ToString(), EOnlineSessionState::ToString(Session->SessionState));
 
-			// #NOTE Intentionally not removing pending update here to account for a race condition between websocket notification and join/create completion
+			// #NOTE Intentionally keeping the pending update here to account for a race condition between websocket notification and join/create completion
+			QueuePendingSessionUpdate(SessionName);
 			continue;
 		}
 
-		TSharedPtr<FOnlineSessionInfoAccelByteV2> SessionInfo = StaticCastSharedPtr<FOnlineSessionInfoAccelByteV2>(SessionEntry.Value->SessionInfo);
+		TSharedPtr<FOnlineSessionInfoAccelByteV2> SessionInfo = StaticCastSharedPtr<FOnlineSessionInfoAccelByteV2>(Session->SessionInfo);
 		if (!ensure(SessionInfo.IsValid()))
 		{
+			// Pending update stays removed as we do not have a way to retrieve the latest update data
 			UE_LOG_AB(Warning, TEXT("Could not check session for updates as the session doesn't have a valid session info object!"));
-
-			// Remove the pending update as we do not have a way to retrieve the latest update data
-			SessionsWithPendingQueuedUpdates.RemoveAt(PendingUpdateIndex);
 			continue;
 		}
 
 		const TSharedPtr<FAccelByteModelsV2BaseSession> ExistingBackendData = SessionInfo->GetBackendSessionData();
 		if (!ensure(ExistingBackendData.IsValid()))
 		{
+			// Pending update stays removed as we do not have a way to compare existing data with latest update
 			UE_LOG_AB(Warning, TEXT("Could not check session for updates as the session info doesn't have a valid backend session data object!"));
-
-			// Remove the pending update as we do not have a way to compare existing data with latest update
-			SessionsWithPendingQueuedUpdates.RemoveAt(PendingUpdateIndex);
 			continue;
 		}
 
@@ -791,23 +816,23 @@ void FOnlineSessionV2AccelByte::UpdateSessionEntries()
 		if (!bHasUpdateToApply)
 		{
 			SessionInfo->SetLatestBackendSessionDataUpdate(nullptr);
-			SessionsWithPendingQueuedUpdates.RemoveAt(PendingUpdateIndex);
 			continue;
 		}
 
 		bool bIsConnectingToP2P = false;
 
-		const EAccelByteV2SessionType SessionType = GetSessionTypeFromSettings(SessionEntry.Value->SessionSettings);
+		const EAccelByteV2SessionType SessionType = GetSessionTypeFromSettings(Session->SessionSettings);
 		if (SessionType == EAccelByteV2SessionType::PartySession)
 		{
 			const TSharedPtr<FAccelByteModelsV2PartySession> PartySessionData = StaticCastSharedPtr<FAccelByteModelsV2PartySession>(LatestUpdate);
 			if (!ensure(PartySessionData.IsValid()))
 			{
 				UE_LOG_AB(Warning, TEXT("Could not update session as the new session data is invalid!"));
+				QueuePendingSessionUpdate(SessionName);
 				continue;
 			}
 
-			UpdateInternalPartySession(SessionEntry.Key, PartySessionData.ToSharedRef().Get());
+			UpdateInternalPartySession(SessionName, PartySessionData.ToSharedRef().Get());
 		}
 		else if (SessionType == EAccelByteV2SessionType::GameSession)
 		{
@@ -815,21 +840,23 @@ void FOnlineSessionV2AccelByte::UpdateSessionEntries()
 			if (!ensure(GameSessionData.IsValid()))
 			{
 				UE_LOG_AB(Warning, TEXT("Could not update session as the new session data is invalid!"));
+				QueuePendingSessionUpdate(SessionName);
 				continue;
 			}
 
-			UpdateInternalGameSession(SessionEntry.Key, GameSessionData.ToSharedRef().Get(), bIsConnectingToP2P);
+			UpdateInternalGameSession(SessionName, GameSessionData.ToSharedRef().Get(), bIsConnectingToP2P);
 		}
 		else
 		{
 			UE_LOG_AB(Warning, TEXT("Could not update session as the session's type is neither Game nor Party!"));
+			QueuePendingSessionUpdate(SessionName);
 			continue;
 		}
 
 		if (SessionInfo->GetDSReadyUpdateReceived())
 		{
 			SessionInfo->SetDSReadyUpdateReceived(false);
-			TriggerOnSessionServerUpdateDelegates(SessionEntry.Value->SessionName);
+			TriggerOnSessionServerUpdateDelegates(Session->SessionName);
 		}
 
 		SessionInfo->SetLatestBackendSessionDataUpdate(nullptr);
@@ -837,12 +864,21 @@ void FOnlineSessionV2AccelByte::UpdateSessionEntries()
 		// If the client is connecting to P2P, the connecting finished delegate will fire the session update complete delegate
 		if (!bIsConnectingToP2P)
 		{
-			TriggerOnUpdateSessionCompleteDelegates(SessionEntry.Value->SessionName, true);
-			TriggerOnSessionUpdateReceivedDelegates(SessionEntry.Value->SessionName);
+			TriggerOnUpdateSessionCompleteDelegates(Session->SessionName, true);
+			TriggerOnSessionUpdateReceivedDelegates(Session->SessionName);
 		}
+	}
+}
+
+void FOnlineSessionV2AccelByte::QueuePendingSessionUpdate(const FName& SessionName)
+{
+	FScopeLock ScopeLock(&SessionLock);
 
-		// Clear the pending update entry to signal that the update is finished
-		SessionsWithPendingQueuedUpdates.RemoveAt(PendingUpdateIndex);
+	bool bIsAlreadyPending = false;
+	SessionsWithPendingQueuedUpdates.Add(SessionName, &bIsAlreadyPending);
+	if (!bIsAlreadyPending)
+	{
+		PendingQueuedUpdateQueue.Add(SessionName);
 	}
 }
 
@@ -1023,21 +1059,21 @@ void FOnlineSessionV2AccelByte::FinalizeStartMatchmakingComplete()
 
 void FOnlineSessionV2AccelByte::StartMatchTicketCheckPoll()
 {
-	NextMatchmakingDetailPollTime = FDateTime::UtcNow() + FTimespan::FromSeconds(MatchTicketCheckInitialDelay);
+	PollScheduler.Schedule(MATCH_TICKET_CHECK_POLL_KEY, FPlatformTime::Seconds() + MatchTicketCheckInitialDelay, [this]() { CheckMatchmakingProgress(); });
 
-	UE_LOG_AB(VeryVerbose, TEXT("Start match ticket check poll, current time %s, next poll time %s"), *FDateTime::UtcNow().ToString(), *NextMatchmakingDetailPollTime.ToString());
+	UE_LOG_AB(VeryVerbose, TEXT("Start match ticket check poll, current time %s, next poll in %d seconds"), *FDateTime::UtcNow().ToString(), MatchTicketCheckInitialDelay);
 }
 
 void FOnlineSessionV2AccelByte::SetMatchTicketCheckPollToNextPollTime()
 {
-	NextMatchmakingDetailPollTime = FDateTime::UtcNow() + FTimespan::FromSeconds(MatchTicketCheckPollInterval);
-	UE_LOG_AB(VeryVerbose, TEXT("Set match ticket check next poll, current time %s, next poll time %s"), *FDateTime::UtcNow().ToString(), *NextMatchmakingDetailPollTime.ToString());
+	PollScheduler.Schedule(MATCH_TICKET_CHECK_POLL_KEY, FPlatformTime::Seconds() + MatchTicketCheckPollInterval, [this]() { CheckMatchmakingProgress(); });
+	UE_LOG_AB(VeryVerbose, TEXT("Set match ticket check next poll, current time %s, next poll in %d seconds"), *FDateTime::UtcNow().ToString(), MatchTicketCheckPollInterval);
 }
 
 void FOnlineSessionV2AccelByte::StopMatchTicketCheckPoll()
 {
 	UE_LOG_AB(VeryVerbose, TEXT("stop match ticket check next poll"));
-	NextMatchmakingDetailPollTime = FDateTime(0);
+	PollScheduler.Cancel(MATCH_TICKET_CHECK_POLL_KEY);
 }
 
 void FOnlineSessionV2AccelByte::SendDSStatusChangedNotif(const int32 LocalUserNum, const TSharedPtr<FAccelByteModelsV2GameSession>& SessionData)
@@ -1099,21 +1135,13 @@ void FOnlineSessionV2AccelByte::CheckMatchmakingProgress()
 		return;
 	}
 
-	// Not the time to trigger match detail polling, early exit
-	if(FDateTime::UtcNow() < NextMatchmakingDetailPollTime || NextMatchmakingDetailPollTime == FDateTime(0))
-	{
-		return;
-	}
-
-	UE_LOG_AB(VeryVerbose, TEXT("Checking match ticket details from poll, current time %s, poll time %s"), *FDateTime::UtcNow().ToString(), *NextMatchmakingDetailPollTime.ToString());
+	UE_LOG_AB(VeryVerbose, TEXT("Checking match ticket details from poll, current time %s"), *FDateTime::UtcNow().ToString());
 
 	GetMatchTicketDetailsCompleteDelegateHandle = AddOnGetMatchTicketDetailsCompleteDelegate_Handle(
 		FOnGetMatchTicketDetailsCompleteDelegate::CreateThreadSafeSP(AsShared(), &FOnlineSessionV2AccelByte::OnMatchTicketCheckGetMatchTicketDetails));
 	
 	AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteGetV2MatchmakingTicketDetails>(AccelByteSubsystem,
 		CurrentMatchmakingSearchHandle->SearchingPlayerId.ToSharedRef().Get(), CurrentMatchmakingSearchHandle->GetTicketId());
-
-	StopMatchTicketCheckPoll();
 }
 
 void FOnlineSessionV2AccelByte::SendSessionInviteNotif(int32 LocalUserNum, const FString& SessionId) const
@@ -1146,50 +1174,28 @@ void FOnlineSessionV2AccelByte::SendSessionInviteNotif(int32 LocalUserNum, const
 void FOnlineSessionV2AccelByte::StartSessionInviteCheckPoll(const FUniqueNetIdPtr& SearchingPlayerId,
 	const FString& SessionId)
 {
-	FScopeLock ScopeLock(&SessionInviteCheckTimesLock);
-
-	FSessionInviteCheckPollItem PollItem;
-	PollItem.SessionId = SessionId;
-	PollItem.SearchingPlayerId = SearchingPlayerId;
-	PollItem.NextPollTime = FDateTime::UtcNow()+ FTimespan::FromSeconds(SessionInviteCheckPollInitialDelay);
-	
-	SessionInviteCheckPollTimes.Emplace(PollItem);
+	PollScheduler.Schedule(MakeSessionInviteCheckPollKey(SearchingPlayerId, SessionId), FPlatformTime::Seconds() + SessionInviteCheckPollInitialDelay
+		, [this, SearchingPlayerId, SessionId]() { CheckSessionInviteAfterMatchFound(SearchingPlayerId, SessionId); });
 	
-	UE_LOG_AB(VeryVerbose, TEXT("Start session invite check poll for session id %s, user %s, current time %s, next poll time %s"),
-		*SessionId, *SearchingPlayerId->ToDebugString(), *FDateTime::UtcNow().ToString(), *PollItem.NextPollTime.ToString())
+	UE_LOG_AB(VeryVerbose, TEXT("Start session invite check poll for session id %s, user %s, current time %s, next poll in %d seconds"),
+		*SessionId, *SearchingPlayerId->ToDebugString(), *FDateTime::UtcNow().ToString(), SessionInviteCheckPollInitialDelay)
 }
 
 void FOnlineSessionV2AccelByte::SetSessionInviteCheckPollNextPollTime(const FUniqueNetIdPtr& SearchingPlayerId,
 	const FString& SessionId)
 {
-	FScopeLock ScopeLock(&SessionInviteCheckTimesLock);
-
-	FSessionInviteCheckPollItem PollItem;
-	PollItem.SessionId = SessionId;
-	PollItem.SearchingPlayerId = SearchingPlayerId;
-	PollItem.NextPollTime = FDateTime::UtcNow()+ FTimespan::FromSeconds(SessionInviteCheckPollInterval);
-	
-	SessionInviteCheckPollTimes.Emplace(PollItem);
+	PollScheduler.Schedule(MakeSessionInviteCheckPollKey(SearchingPlayerId, SessionId), FPlatformTime::Seconds() + SessionInviteCheckPollInterval
+		, [this, SearchingPlayerId, SessionId]() { CheckSessionInviteAfterMatchFound(SearchingPlayerId, SessionId); });
 
-	UE_LOG_AB(VeryVerbose, TEXT("Set session invite check poll for session id %s, user %s, current time %s, next poll time %s"),
-		*SessionId, *SearchingPlayerId->ToDebugString(), *FDateTime::UtcNow().ToString(), *PollItem.NextPollTime.ToString())
+	UE_LOG_AB(VeryVerbose, TEXT("Set session invite check poll for session id %s, user %s, current time %s, next poll in %d seconds"),
+		*SessionId, *SearchingPlayerId->ToDebugString(), *FDateTime::UtcNow().ToString(), SessionInviteCheckPollInterval)
 }
 
 void FOnlineSessionV2AccelByte::StopSessionInviteCheckPoll(const FUniqueNetIdPtr& SearchingPlayerId,
 	const FString& SessionId)
 {
 	UE_LOG_AB(VeryVerbose, TEXT("Stopping session invite check poll. Session id %s, player %s"), *SessionId, *SearchingPlayerId->ToDebugString());
-	FScopeLock ScopeLock(&SessionInviteCheckTimesLock);
-
-	const int32 PollItemIndex = SessionInviteCheckPollTimes.IndexOfByPredicate([&](const FSessionInviteCheckPollItem& PollItem)
-	{
-		return SearchingPlayerId == PollItem.SearchingPlayerId && SessionId == PollItem.SessionId;
-	});
-
-	if(PollItemIndex != INDEX_NONE)
-	{
-		SessionInviteCheckPollTimes.RemoveAt(PollItemIndex);
-	}
+	PollScheduler.Cancel(MakeSessionInviteCheckPollKey(SearchingPlayerId, SessionId));
 }
 
 void FOnlineSessionV2AccelByte::OnSessionInviteCheckGetSession(int32 LocalUserNum, bool bWasSuccessful, const FOnlineSessionSearchResult& OnlineSearchResult)
@@ -1255,48 +1261,26 @@ void FOnlineSessionV2AccelByte::OnSessionInviteCheckGetSession(int32 LocalUserNu
 
 void FOnlineSessionV2AccelByte::StartSessionServerCheckPoll(const FUniqueNetIdPtr& SearchingPlayerId, const FName SessionName)
 {
-	FScopeLock ScopeLock(&SessionServerCheckTimesLock);
-
-	FSessionServerCheckPollItem PollItem;
-	PollItem.SessionName = SessionName;
-	PollItem.SearchingPlayerId = SearchingPlayerId;
-	PollItem.NextPollTime = FDateTime::UtcNow()+ FTimespan::FromSeconds(SessionServerCheckPollInitialDelay);
-	
-	SessionServerCheckPollTimes.Emplace(PollItem);
+	PollScheduler.Schedule(MakeSessionServerCheckPollKey(SearchingPlayerId, SessionName), FPlatformTime::Seconds() + SessionServerCheckPollInitialDelay
+		, [this, SearchingPlayerId, SessionName]() { CheckSessionServerProgress(SearchingPlayerId, SessionName); });
 	
-	UE_LOG_AB(VeryVerbose, TEXT("Start session server check poll for session name %s, user %s, current time %s, next poll time %s"),
-		*SessionName.ToString(), *SearchingPlayerId->ToDebugString(), *FDateTime::UtcNow().ToString(), *PollItem.NextPollTime.ToString())
+	UE_LOG_AB(VeryVerbose, TEXT("Start session server check poll for session name %s, user %s, current time %s, next poll in %d seconds"),
+		*SessionName.ToString(), *SearchingPlayerId->ToDebugString(), *FDateTime::UtcNow().ToString(), SessionServerCheckPollInitialDelay)
 }
 
 void FOnlineSessionV2AccelByte::SetSessionServerCheckPollNextPollTime(const FUniqueNetIdPtr& SearchingPlayerId, const FName SessionName)
 {
-	FScopeLock ScopeLock(&SessionServerCheckTimesLock);
+	PollScheduler.Schedule(MakeSessionServerCheckPollKey(SearchingPlayerId, SessionName), FPlatformTime::Seconds() + SessionServerCheckPollInterval
+		, [this, SearchingPlayerId, SessionName]() { CheckSessionServerProgress(SearchingPlayerId, SessionName); });
 
-	FSessionServerCheckPollItem PollItem;
-	PollItem.SessionName = SessionName;
-	PollItem.SearchingPlayerId = SearchingPlayerId;
-	PollItem.NextPollTime = FDateTime::UtcNow()+ FTimespan::FromSeconds(SessionServerCheckPollInterval);
-	
-	SessionServerCheckPollTimes.Emplace(PollItem);
-
-	UE_LOG_AB(VeryVerbose, TEXT("Set session server check poll for session name %s, user %s, current time %s, next poll time %s"),
-		*SessionName.ToString(), *SearchingPlayerId->ToDebugString(), *FDateTime::UtcNow().ToString(), *PollItem.NextPollTime.ToString())
+	UE_LOG_AB(VeryVerbose, TEXT("Set session server check poll for session name %s, user %s, current time %s, next poll in %d seconds"),
+		*SessionName.ToString(), *SearchingPlayerId->ToDebugString(), *FDateTime::UtcNow().ToString(), SessionServerCheckPollInterval)
 }
 
 void FOnlineSessionV2AccelByte::StopSessionServerCheckPoll(const FUniqueNetIdPtr& SearchingPlayerId, const FName SessionName)
 {
 	UE_LOG_AB(VeryVerbose, TEXT("Stopping session server check poll. Session name %s, player %s"), *SessionName.ToString(), *SearchingPlayerId->ToDebugString());
-	FScopeLock ScopeLock(&SessionServerCheckTimesLock);
-
-	const int32 PollItemIndex = SessionServerCheckPollTimes.IndexOfByPredicate([&](const FSessionServerCheckPollItem& PollItem)
-	{
-		return SearchingPlayerId == PollItem.SearchingPlayerId && SessionName == PollItem.SessionName;
-	});
-
-	if(PollItemIndex != INDEX_NONE)
-	{
-		SessionServerCheckPollTimes.RemoveAt(PollItemIndex);
-	}
+	PollScheduler.Cancel(MakeSessionServerCheckPollKey(SearchingPlayerId, SessionName));
 }
 
 void FOnlineSessionV2AccelByte::OnSessionServerCheckGetSession(int LocalUserNum, bool bWasSuccessful, const FOnlineSessionSearchResult& OnlineSessionSearchResult)
@@ -1367,94 +1351,55 @@ void FOnlineSessionV2AccelByte::OnSessionServerCheckGetSession(int LocalUserNum,
 	AB_OSS_INTERFACE_TRACE_END(TEXT(""));
 }
 
-void FOnlineSessionV2AccelByte::CheckSessionServerProgress()
+void FOnlineSessionV2AccelByte::CheckSessionServerProgress(const FUniqueNetIdPtr& SearchingPlayerId, const FName SessionName)
 {
 	if(!bSessionServerCheckPollEnabled)
 	{
 		return;
 	}
 
-	FScopeLock ScopeLock(&SessionServerCheckTimesLock);
-
-	TArray<int32> PollItemIndexesToRemove;
-	for(int i = 0; i < SessionServerCheckPollTimes.Num(); i++)
+	const FNamedOnlineSession* NamedSession = GetNamedSession(SessionName);
+	if(NamedSession == nullptr || !NamedSession->SessionInfo.IsValid())
 	{
-		FSessionServerCheckPollItem PollItem = SessionServerCheckPollTimes[i];
-		if(FDateTime::UtcNow() < PollItem.NextPollTime)
-		{
-			continue;
-		}
-
-		const FNamedOnlineSession* NamedSession = GetNamedSession(PollItem.SessionName);
-		if(NamedSession == nullptr)
-		{
-			UE_LOG_AB(Log, TEXT("Session with name %s doesn't exist to check session server progress for user %s, removing from poll list"), *PollItem.SessionName.ToString(), *PollItem.SearchingPlayerId->ToDebugString());
-			PollItemIndexesToRemove.Insert(i, 0);
-			continue;
-		}
-
-		UE_LOG_AB(VeryVerbose, TEXT("Checking session server progress, session name %s player %s polltime %s current time %s"), *PollItem.SessionName.ToString(), *PollItem.SearchingPlayerId->ToDebugString(), *PollItem.NextPollTime.ToString(), *FDateTime::UtcNow().ToString());
-
-		AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteFindV2GameSessionById>(AccelByteSubsystem,
-			PollItem.SearchingPlayerId.ToSharedRef().Get(), NamedSession->SessionInfo->GetSessionId(), OnSessionServerCheckGetSessionDelegate);
-
-		PollItemIndexesToRemove.Insert(i, 0);
+		UE_LOG_AB(Log, TEXT("Session with name %s doesn't exist to check session server progress for user %s, dropping poll"), *SessionName.ToString(), *SearchingPlayerId->ToDebugString());
+		return;
 	}
 
-	// remove already triggered check poll times
-	for(const int32 Index : PollItemIndexesToRemove)
-	{
-		SessionServerCheckPollTimes.RemoveAt(Index);
-	}
+	UE_LOG_AB(VeryVerbose, TEXT("Checking session server progress, session name %s player %s current time %s"), *SessionName.ToString(), *SearchingPlayerId->ToDebugString(), *FDateTime::UtcNow().ToString());
+
+	AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteFindV2GameSessionById>(AccelByteSubsystem,
+		SearchingPlayerId.ToSharedRef().Get(), NamedSession->SessionInfo->GetSessionId(), OnSessionServerCheckGetSessionDelegate);
 }
 
-void FOnlineSessionV2AccelByte::CheckSessionInviteAfterMatchFound()
+void FOnlineSessionV2AccelByte::CheckSessionInviteAfterMatchFound(const FUniqueNetIdPtr& SearchingPlayerId, const FString& SessionId)
 {
 	if(!bSessionInviteCheckPollEnabled)
 	{
 		return;
 	}
 
-	FScopeLock ScopeLock(&SessionInviteCheckTimesLock);
-
-	TArray<int32> PollTimeIndexesToRemove;
-	for(int i = 0; i < SessionInviteCheckPollTimes.Num(); i++)
+	// if we already received an invite of this session or we already joined the session, drop this poll.
+	const bool bSessionJoined = GetNamedSessionById(SessionId) != nullptr;
+	const bool bInviteReceived = SessionInvites.ContainsByPredicate([&SessionId](const FOnlineSessionInviteAccelByte& Invite)
 	{
-		FSessionInviteCheckPollItem PollItem = SessionInviteCheckPollTimes[i];
-
-		// check time if the poll should trigger
-		if(FDateTime::UtcNow() < PollItem.NextPollTime)
-		{
-			continue;
-		}
-
-		// if we already received an invite of this session or we already joined the session, remove this item from poll list.
-		const bool bSessionJoined = GetNamedSessionById(PollItem.SessionId) != nullptr;
-		const bool bInviteReceived = SessionInvites.ContainsByPredicate([&PollItem](const FOnlineSessionInviteAccelByte& Invite)
-		{
-			return Invite.Session.GetSessionIdStr() == PollItem.SessionId;
-		});
-		if(bInviteReceived || bSessionJoined)
-		{
-			UE_LOG_AB(VeryVerbose, TEXT("Checking session invite after match found, session id %s invite already received removing from poll"), *PollItem.SessionId);
-			PollTimeIndexesToRemove.Insert(i, 0);
-			continue;
-		}
-
-		FUniqueNetIdPtr SessionNetId = CreateSessionIdFromString(PollItem.SessionId);
+		return Invite.Session.GetSessionIdStr() == SessionId;
+	});
+	if(bInviteReceived || bSessionJoined)
+	{
+		UE_LOG_AB(VeryVerbose, TEXT("Checking session invite after match found, session id %s invite already received dropping poll"), *SessionId);
+		return;
+	}
 
-		UE_LOG_AB(VeryVerbose, TEXT("Checking session invite after match found, session id %s player %s polltime %s current time %s"), *PollItem.SessionId, *PollItem.SearchingPlayerId->ToDebugString(), *PollItem.NextPollTime.ToString(), *FDateTime::UtcNow().ToString());
-		AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteFindV2GameSessionById>(AccelByteSubsystem,
-			PollItem.SearchingPlayerId.ToSharedRef().Get(), SessionNetId.ToSharedRef().Get(), OnSessionInviteCheckGetSessionDelegate);
+	FUniqueNetIdPtr SessionNetId = CreateSessionIdFromString(SessionId);
 
-		PollTimeIndexesToRemove.Insert(i, 0);
-	}
+	UE_LOG_AB(VeryVerbose, TEXT("Checking session invite after match found, session id %s player %s current time %s"), *SessionId, *SearchingPlayerId->ToDebugString(), *FDateTime::UtcNow().ToString());
+	AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteFindV2GameSessionById>(AccelByteSubsystem,
+		SearchingPlayerId.ToSharedRef().Get(), SessionNetId.ToSharedRef().Get(), OnSessionInviteCheckGetSessionDelegate);
+}
 
-	// remove already triggered check poll times
-	for(const int32 Index : PollTimeIndexesToRemove)
-	{
-		SessionInviteCheckPollTimes.RemoveAt(Index);
-	}
+void FOnlineSessionV2AccelByte::DumpScheduledPolls(FOutputDevice& Ar) const
+{
+	PollScheduler.Dump(Ar, FPlatformTime::Seconds());
 }
 
 void FOnlineSessionV2AccelByte::Tick(float DeltaTime)
@@ -1468,11 +1413,8 @@ void FOnlineSessionV2AccelByte::Tick(float DeltaTime)
 	
 	UpdateSessionEntries();
 
-	CheckMatchmakingProgress();
-
-	CheckSessionServerProgress();
-
-	CheckSessionInviteAfterMatchFound();
+	// Fires the match ticket, session server and session invite check polls that are due
+	PollScheduler.Tick(CurrentTimeSeconds);
 }
 
 void FOnlineSessionV2AccelByte::RegisterSessionNotificationDelegates(const FUniqueNetId& PlayerId)
@@ -1637,6 +1579,7 @@ FNamedOnlineSession* FOnlineSessionV2AccelByte::AddNamedSession(FName SessionNam
 	FScopeLock ScopeLock(&SessionLock);
 
 	TSharedPtr<FNamedOnlineSession> NewNamedSession = MakeShared<FNamedOnlineSession>(SessionName, SessionSettings);
+	RemoveSessionIdFromIndex(SessionName);
 	Sessions.Emplace(SessionName, NewNamedSession);
 
 	return NewNamedSession.Get();
@@ -1647,7 +1590,9 @@ FNamedOnlineSession* FOnlineSessionV2AccelByte::AddNamedSession(FName SessionNam
 	FScopeLock ScopeLock(&SessionLock);
 
 	TSharedPtr<FNamedOnlineSession> NewNamedSession = MakeShared<FNamedOnlineSession>(SessionName, Session);
+	RemoveSessionIdFromIndex(SessionName);
 	Sessions.Emplace(SessionName, NewNamedSession);
+	AddSessionIdToIndex(SessionName, *NewNamedSession);
 
 	return NewNamedSession.Get();
 }
@@ -1681,9 +1626,44 @@ FNamedOnlineSession* FOnlineSessionV2AccelByte::GetNamedSession(FName SessionNam
 void FOnlineSessionV2AccelByte::RemoveNamedSession(FName SessionName)
 {
 	FScopeLock ScopeLock(&SessionLock);
+	RemoveSessionIdFromIndex(SessionName);
 	Sessions.Remove(SessionName);
 }
 
+void FOnlineSessionV2AccelByte::AddSessionIdToIndex(const FName& SessionName, const FOnlineSession& Session)
+{
+	if (!Session.SessionInfo.IsValid() || !Session.SessionInfo->IsValid())
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&SessionLock);
+	SessionIdToSessionName.Add(Session.GetSessionIdStr(), SessionName);
+}
+
+void FOnlineSessionV2AccelByte::RemoveSessionIdFromIndex(const FName& SessionName)
+{
+	const TSharedPtr<FNamedOnlineSession>* FoundSession = Sessions.Find(SessionName);
+	if (FoundSession == nullptr || !FoundSession->IsValid())
+	{
+		return;
+	}
+
+	const TSharedPtr<FOnlineSessionInfo>& SessionInfo = (*FoundSession)->SessionInfo;
+	if (!SessionInfo.IsValid() || !SessionInfo->IsValid())
+	{
+		return;
+	}
+
+	// Only drop the entry if it still points at this session, another session may have taken over the ID since
+	const FString SessionId = (*FoundSession)->GetSessionIdStr();
+	const FName* IndexedSessionName = SessionIdToSessionName.Find(SessionId);
+	if (IndexedSessionName != nullptr && *IndexedSessionName == SessionName)
+	{
+		SessionIdToSessionName.Remove(SessionId);
+	}
+}
+
 bool FOnlineSessionV2AccelByte::HasPresenceSession()
 {
 	return false;
@@ -1937,6 +1917,7 @@ void FOnlineSessionV2AccelByte::FinalizeCreateGameSession(const FName& SessionNa
 		SessionInfo->SetSessionMemberStorage(MemberUniqueNetId, MemberStorages.Value);
 	}
 	NewSession->SessionInfo = SessionInfo;
+	AddSessionIdToIndex(SessionName, *NewSession);
 
 	// Closed and invite only sessions populate the private connection num, open populates the public num
 	if (BackendSessionInfo.Configuration.Joinability == EAccelByteV2SessionJoinability::INVITE_ONLY || BackendSessionInfo.Configuration.Joinability == EAccelByteV2SessionJoinability::CLOSED)
@@ -2010,6 +1991,7 @@ void FOnlineSessionV2AccelByte::FinalizeCreatePartySession(const FName& SessionN
 	TSharedRef<FOnlineSessionInfoAccelByteV2> SessionInfo = MakeShared<FOnlineSessionInfoAccelByteV2>(BackendSessionInfo.ID);
 	SessionInfo->SetBackendSessionData(MakeShared<FAccelByteModelsV2PartySession>(BackendSessionInfo));
 	Session->SessionInfo = SessionInfo;
+	AddSessionIdToIndex(SessionName, *Session);
 
 	// Parties are always invite only, so we just want to update the private connection num
 	Session->SessionSettings.NumPrivateConnections = BackendSessionInfo.Configuration.MaxPlayers;
@@ -4824,15 +4806,20 @@ bool FOnlineSessionV2AccelByte::LeaveRestoredSession(const FUniqueNetId& LocalUs
 FNamedOnlineSession* FOnlineSessionV2AccelByte::GetNamedSessionById(const FString& SessionIdString)
 {
 	FScopeLock ScopeLock(&SessionLock);
-	for (const TPair<FName, TSharedPtr<FNamedOnlineSession>>& SessionPair : Sessions)
+
+	const FName* SessionName = SessionIdToSessionName.Find(SessionIdString);
+	if (SessionName == nullptr)
 	{
-		if (SessionPair.Value->GetSessionIdStr().Equals(SessionIdString))
-		{
-			return SessionPair.Value.Get();
-		}
+		return nullptr;
 	}
 
-	return nullptr;
+	const TSharedPtr<FNamedOnlineSession>* FoundSession = Sessions.Find(*SessionName);
+	if (FoundSession == nullptr || !FoundSession->IsValid() || !(*FoundSession)->GetSessionIdStr().Equals(SessionIdString))
+	{
+		return nullptr;
+	}
+
+	return FoundSession->Get();
 }
 
 void FOnlineSessionV2AccelByte::RegisterServer(FName SessionName, const FOnRegisterServerComplete& Delegate)
@@ -5537,7 +5524,7 @@ void FOnlineSessionV2AccelByte::EnqueueBackendDataUpdate(const FName& SessionNam
 	// pending update to process
 	if (bShouldUpdate || bIsDSReadyUpdate)
 	{
-		SessionsWithPendingQueuedUpdates.AddUnique(SessionName);
+		QueuePendingSessionUpdate(SessionName);
 	}
 
 	AB_OSS_INTERFACE_TRACE_END(TEXT(""));
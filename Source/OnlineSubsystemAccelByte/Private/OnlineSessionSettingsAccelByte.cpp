@@ -9,42 +9,129 @@
 
 constexpr auto DATA_OFFSET = sizeof(uint8);
 
+/**
+ * Set on the data type byte of string arrays written with the length prefixed codec, so that they can be told apart from
+ * the original zero terminated format, which is still read for blobs created before it.
+ *
+ * Length prefixed layout: data type byte with this flag set, uint8 codec version, two reserved bytes, uint32 string
+ * count, one uint32 length in TCHARs per string, then the characters of every string back to back without terminators.
+ * Every length and the character area start on a four byte boundary, so that they can be bulk copied as is.
+ */
+constexpr uint8 ARRAY_FIELD_LENGTH_PREFIXED_FLAG = 0x80;
+constexpr uint8 ARRAY_FIELD_CODEC_VERSION = 2;
+constexpr auto LENGTH_PREFIXED_HEADER_SIZE = sizeof(uint8) * 4 + sizeof(uint32);
+
 #pragma region Conversion utility functions
 
-static void ConvertArrayToBytes(const TArray<FString>& InArray, TArray<uint8>& OutArray)
+static ESessionSettingsAccelByteArrayFieldType GetArrayFieldTypeFromBytes(const TArray<uint8>& InArray)
 {
-	// Prefix the output bytes with the data type
-	OutArray.Add(StaticCast<uint8>(ESessionSettingsAccelByteArrayFieldType::STRINGS));
+	if (InArray.Num() < DATA_OFFSET)
+	{
+		return ESessionSettingsAccelByteArrayFieldType::INVALID;
+	}
+
+	return StaticCast<ESessionSettingsAccelByteArrayFieldType>(InArray[0] & ~ARRAY_FIELD_LENGTH_PREFIXED_FLAG);
+}
 
-	TArray<uint8>::SizeType ByteIndex = DATA_OFFSET;
-	for (const auto& String : InArray)
+static void ConvertArrayToBytes(const TArray<FString>& InArray, TArray<uint8>& OutArray)
+{
+	const int32 LengthsSize = InArray.Num() * sizeof(uint32);
+	int32 CharactersSize = 0;
+	for (const FString& String : InArray)
 	{
-		const auto Bytes = String.Len() * sizeof(TCHAR);
+		CharactersSize += String.Len() * sizeof(TCHAR);
+	}
+
+	// Size the output once, then fill the header, the lengths and the characters in place
+	OutArray.SetNumUninitialized(LENGTH_PREFIXED_HEADER_SIZE + LengthsSize + CharactersSize);
+	uint8* Data = OutArray.GetData();
+	Data[0] = StaticCast<uint8>(ESessionSettingsAccelByteArrayFieldType::STRINGS) | ARRAY_FIELD_LENGTH_PREFIXED_FLAG;
+	Data[1] = ARRAY_FIELD_CODEC_VERSION;
+	Data[2] = 0;
+	Data[3] = 0;
 
-		// Copy the string to the output bytes array
-		OutArray.AddUninitialized(Bytes + sizeof(TCHAR));
-		FMemory::Memcpy(OutArray.GetData() + ByteIndex, *String, Bytes);
-		ByteIndex += Bytes;
+	const uint32 Count = InArray.Num();
+	FMemory::Memcpy(Data + 4, &Count, sizeof(uint32));
 
-		// Insert a TCHAR with value 0 to delineate the end of each string in the array 
-		FMemory::Memset(OutArray.GetData() + ByteIndex, 0, sizeof(TCHAR));
-		ByteIndex += sizeof(TCHAR);
+	uint8* LengthData = Data + LENGTH_PREFIXED_HEADER_SIZE;
+	uint8* CharacterData = LengthData + LengthsSize;
+	for (const FString& String : InArray)
+	{
+		const uint32 Length = String.Len();
+		FMemory::Memcpy(LengthData, &Length, sizeof(uint32));
+		LengthData += sizeof(uint32);
+
+		if (Length > 0)
+		{
+			FMemory::Memcpy(CharacterData, *String, Length * sizeof(TCHAR));
+			CharacterData += Length * sizeof(TCHAR);
+		}
 	}
 }
 
 static void ConvertArrayToBytes(const TArray<double>& InArray, TArray<uint8>& OutArray)
 {
-	// Prefix the output bytes with the data type
-	OutArray.Add(StaticCast<uint8>(ESessionSettingsAccelByteArrayFieldType::DOUBLES));
-	// Add enough fields to serialize all of the values in InArray
-	OutArray.AddUninitialized(sizeof(double) * InArray.Num());
+	// Prefix the output bytes with the data type, followed by every value of InArray as is
+	OutArray.SetNumUninitialized(DATA_OFFSET + sizeof(double) * InArray.Num());
+	OutArray[0] = StaticCast<uint8>(ESessionSettingsAccelByteArrayFieldType::DOUBLES);
+	if (InArray.Num() > 0)
+	{
+		FMemory::Memcpy(OutArray.GetData() + DATA_OFFSET, InArray.GetData(), sizeof(double) * InArray.Num());
+	}
+}
 
-	TArray<uint8>::SizeType ByteIndex = DATA_OFFSET;
-	for (const auto& Number : InArray)
+static bool ConvertLengthPrefixedBytesToArray(const TArray<uint8>& InArray, TArray<FString>& OutArray)
+{
+	if (InArray.Num() < LENGTH_PREFIXED_HEADER_SIZE || InArray[1] != ARRAY_FIELD_CODEC_VERSION)
 	{
-		FMemory::Memcpy(OutArray.GetData() + ByteIndex, &Number, sizeof(double));
-		ByteIndex += sizeof(double);
+		return false;
 	}
+
+	const uint8* Data = InArray.GetData();
+	uint32 Count = 0;
+	FMemory::Memcpy(&Count, Data + 4, sizeof(uint32));
+
+	// Validate every length against the size of the blob before allocating anything for the strings
+	const uint64 LengthsSize = StaticCast<uint64>(Count) * sizeof(uint32);
+	if (LengthsSize > StaticCast<uint64>(InArray.Num() - LENGTH_PREFIXED_HEADER_SIZE))
+	{
+		return false;
+	}
+
+	const uint8* LengthData = Data + LENGTH_PREFIXED_HEADER_SIZE;
+	const uint8* CharacterData = LengthData + LengthsSize;
+	uint64 CharactersSize = 0;
+	for (uint32 Index = 0; Index < Count; Index++)
+	{
+		uint32 Length = 0;
+		FMemory::Memcpy(&Length, LengthData + Index * sizeof(uint32), sizeof(uint32));
+		CharactersSize += StaticCast<uint64>(Length) * sizeof(TCHAR);
+	}
+
+	if (CharactersSize != StaticCast<uint64>(InArray.Num() - LENGTH_PREFIXED_HEADER_SIZE) - LengthsSize)
+	{
+		return false;
+	}
+
+	OutArray.Reserve(OutArray.Num() + StaticCast<int32>(Count));
+	for (uint32 Index = 0; Index < Count; Index++)
+	{
+		uint32 Length = 0;
+		FMemory::Memcpy(&Length, LengthData + Index * sizeof(uint32), sizeof(uint32));
+
+		FString& String = OutArray.AddDefaulted_GetRef();
+		if (Length > 0)
+		{
+			// Copy the characters straight into the string storage, with room for the terminator
+			TArray<TCHAR>& CharArray = String.GetCharArray();
+			CharArray.SetNumUninitialized(Length + 1);
+			FMemory::Memcpy(CharArray.GetData(), CharacterData, Length * sizeof(TCHAR));
+			CharArray[Length] = TEXT('\0');
+			CharacterData += Length * sizeof(TCHAR);
+		}
+	}
+
+	return true;
 }
 
 static bool ConvertBytesToArray(const TArray<uint8>& InArray, TArray<FString>& OutArray)
@@ -54,32 +141,46 @@ static bool ConvertBytesToArray(const TArray<uint8>& InArray, TArray<FString>& O
 		return false;
 	}
 
-	const auto DataType = StaticCast<ESessionSettingsAccelByteArrayFieldType>(InArray[0]);
-	const auto DataSize = InArray.Num() - DATA_OFFSET;
+	if (GetArrayFieldTypeFromBytes(InArray) != ESessionSettingsAccelByteArrayFieldType::STRINGS)
+	{
+		return false;
+	}
 
-	// Ensure that the data type field is correct, and that the number of bytes is evenly divisible by the number of
-	// bytes in a TCHAR to avoid reading outside of the bounds of InArray
-	if (DataType != ESessionSettingsAccelByteArrayFieldType::STRINGS || DataSize % sizeof(TCHAR) != 0)
+	if ((InArray[0] & ARRAY_FIELD_LENGTH_PREFIXED_FLAG) != 0)
+	{
+		return ConvertLengthPrefixedBytesToArray(InArray, OutArray);
+	}
+
+	// Original format, every string is followed by a TCHAR with value 0. Ensure that the number of bytes is evenly
+	// divisible by the number of bytes in a TCHAR to avoid reading outside of the bounds of InArray
+	const auto DataSize = InArray.Num() - DATA_OFFSET;
+	if (DataSize % sizeof(TCHAR) != 0)
 	{
 		return false;
 	}
 
-	FString String = TEXT("");
-	for (TArray<uint8>::SizeType i = DATA_OFFSET; i < DataSize + DATA_OFFSET; i += sizeof(TCHAR))
+	const int32 CharCount = StaticCast<int32>(DataSize / sizeof(TCHAR));
+	int32 StringStart = 0;
+	for (int32 CharIndex = 0; CharIndex < CharCount; CharIndex++)
 	{
 		TCHAR Char;
-		FMemory::Memcpy(&Char, InArray.GetData() + i, sizeof(TCHAR));
-
-		// When serializing, we inserted a TCHAR with value 0 to separate the array items
-		if (Char == 0)
+		FMemory::Memcpy(&Char, InArray.GetData() + DATA_OFFSET + CharIndex * sizeof(TCHAR), sizeof(TCHAR));
+		if (Char != 0)
 		{
-			OutArray.Add(String);
-			String = TEXT("");
+			continue;
 		}
-		else
+
+		// Copy the whole string at once now that its end is known
+		const int32 Length = CharIndex - StringStart;
+		FString& String = OutArray.AddDefaulted_GetRef();
+		if (Length > 0)
 		{
-			String.AppendChar(Char);
+			TArray<TCHAR>& CharArray = String.GetCharArray();
+			CharArray.SetNumUninitialized(Length + 1);
+			FMemory::Memcpy(CharArray.GetData(), InArray.GetData() + DATA_OFFSET + StringStart * sizeof(TCHAR), Length * sizeof(TCHAR));
+			CharArray[Length] = TEXT('\0');
 		}
+		StringStart = CharIndex + 1;
 	}
 
 	return true;
@@ -102,11 +203,11 @@ static bool ConvertBytesToArray(const TArray<uint8>& InArray, TArray<double>& Ou
 		return false;
 	}
 
-	for (TArray<uint8>::SizeType i = DATA_OFFSET; i < DataSize + DATA_OFFSET; i += sizeof(double))
+	const int32 Count = StaticCast<int32>(DataSize / sizeof(double));
+	if (Count > 0)
 	{
-		double Number;
-		FMemory::Memcpy(&Number, InArray.GetData() + i, sizeof(double));
-		OutArray.Add(Number);
+		const int32 StartIndex = OutArray.AddUninitialized(Count);
+		FMemory::Memcpy(OutArray.GetData() + StartIndex, InArray.GetData() + DATA_OFFSET, DataSize);
 	}
 
 	return true;
@@ -240,24 +341,19 @@ template ONLINESUBSYSTEMACCELBYTE_API bool FOnlineSearchSettingsAccelByte::GetIn
 ESessionSettingsAccelByteArrayFieldType FOnlineSearchSettingsAccelByte::GetArrayFieldType(const FOnlineSearchSettings& SearchSettings, FName Key)
 {
 	TArray<uint8> RawArray;
-	if (!SearchSettings.Get(Key, RawArray) || RawArray.Num() < DATA_OFFSET)
+	if (!SearchSettings.Get(Key, RawArray))
 	{
 		return ESessionSettingsAccelByteArrayFieldType::INVALID;
 	}
 
-	return StaticCast<ESessionSettingsAccelByteArrayFieldType>(RawArray[0]);
+	return GetArrayFieldTypeFromBytes(RawArray);
 }
 
 ESessionSettingsAccelByteArrayFieldType FOnlineSearchSettingsAccelByte::GetArrayFieldType(const FVariantData& Data)
 {
 	TArray<uint8> RawArray;
 	Data.GetValue(RawArray);
-	if (RawArray.Num() < DATA_OFFSET)
-	{
-		return ESessionSettingsAccelByteArrayFieldType::INVALID;
-	}
-
-	return StaticCast<ESessionSettingsAccelByteArrayFieldType>(RawArray[0]);
+	return GetArrayFieldTypeFromBytes(RawArray);
 }
 
 void FOnlineSessionSettingsAccelByte::Set(FName Key, const TArray<FString>& Value, EOnlineDataAdvertisementType::Type InType, int32 InID)
@@ -410,10 +506,10 @@ template ONLINESUBSYSTEMACCELBYTE_API bool FOnlineSessionSettingsAccelByte::GetI
 ESessionSettingsAccelByteArrayFieldType FOnlineSessionSettingsAccelByte::GetArrayFieldType(const FOnlineSessionSettings& SessionSettings, FName Key)
 {
 	TArray<uint8> RawArray;
-	if (!SessionSettings.Get(Key, RawArray) || RawArray.Num() < DATA_OFFSET)
+	if (!SessionSettings.Get(Key, RawArray))
 	{
 		return ESessionSettingsAccelByteArrayFieldType::INVALID;
 	}
 
-	return StaticCast<ESessionSettingsAccelByteArrayFieldType>(RawArray[0]);
+	return GetArrayFieldTypeFromBytes(RawArray);
 }
@@ -29,6 +29,7 @@
 #include "OnlineGameStandardEventInterfaceAccelByte.h"
 #include "AsyncTasks/OnlineAsyncTaskAccelByte.h"
 #include "AsyncTasks/OnlineAsyncEpicTaskAccelByte.h"
+#include "Utilities/AccelByteAsyncTaskMetrics.h"
 #include "Core/AccelByteWebSocketErrorTypes.h"
 #include "VoiceChat/AccelByteVoiceChat.h"
 #include "VoiceChat.h"
@@ -46,6 +47,25 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "ExecTests/ExecTestBase.h"
+#include "ExecTests/ExecTestAsyncTaskBenchmark.h"
+#include "ExecTests/ExecTestAsyncTaskScheduler.h"
+#include "ExecTests/ExecTestAsyncTaskCoalescing.h"
+#include "ExecTests/ExecTestUniqueIdBenchmark.h"
+#include "ExecTests/ExecTestUserCacheBenchmark.h"
+#include "ExecTests/ExecTestChunkedRequestPipeline.h"
+#include "ExecTests/ExecTestUserCacheSnapshot.h"
+#include "ExecTests/ExecTestNegativeUserCache.h"
+#include "ExecTests/ExecTestSessionUpdateBenchmark.h"
+#include "ExecTests/ExecTestSessionAttributeDiff.h"
+#include "ExecTests/ExecTestSessionIdIndex.h"
+#include "ExecTests/ExecTestSessionArrayCodec.h"
+#include "ExecTests/ExecTestPollScheduler.h"
+#include "ExecTests/ExecTestChatRingBuffer.h"
+#include "ExecTests/ExecTestChatRoomMembers.h"
+#include "ExecTests/ExecTestChatTopicPaging.h"
+#include "ExecTests/ExecTestChatSenderStorm.h"
+#include "ExecTests/ExecTestTelemetrySpill.h"
+#include "ExecTests/ExecTestTelemetryReplayBatch.h"
 #endif
 
 using namespace AccelByte;
@@ -92,7 +112,14 @@ bool FOnlineSubsystemAccelByte::Init()
 	VoiceChatInterface = MakeShared<FAccelByteVoiceChat, ESPMode::ThreadSafe>(this);
 	PredefinedEventInterface = MakeShared<FOnlinePredefinedEventAccelByte, ESPMode::ThreadSafe>(this);
 	GameStandardEventInterface = MakeShared<FOnlineGameStandardEventAccelByte, ESPMode::ThreadSafe>(this);
+	PredefinedEventInterface->Init();
+	GameStandardEventInterface->Init();
 	
+	AsyncTaskMetrics = MakeShared<FAccelByteAsyncTaskMetrics, ESPMode::ThreadSafe>();
+	bool bEnableAsyncTaskMetrics = true;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableAsyncTaskMetrics"), bEnableAsyncTaskMetrics);
+	AsyncTaskMetrics->SetEnabled(bEnableAsyncTaskMetrics);
+
 	// Create an async task manager and a thread for the manager to process tasks on
 	AsyncTaskManager = MakeShared<FOnlineAsyncTaskManagerAccelByte, ESPMode::ThreadSafe>(this);
 	AsyncTaskManagerThread.Reset(FRunnableThread::Create(AsyncTaskManager.Get(), *FString::Printf(TEXT("OnlineAsyncTaskThread %s"), *InstanceName.ToString())));
@@ -189,7 +216,14 @@ bool FOnlineSubsystemAccelByte::Shutdown()
 	ExternalUIInterface.Reset();
 	IdentityInterface.Reset();
 	SessionInterface.Reset();
+	if (UserCache.IsValid())
+	{
+		// Nothing is left to dispatch queued queries through, so let their callers know now rather than never
+		UserCache->FailPendingUserQueries();
+		UserCache->SaveSnapshot();
+	}
 	UserCache.Reset();
+	AsyncTaskMetrics.Reset();
 	AgreementInterface.Reset();
 	WalletInterface.Reset();
 	EntitlementsInterface.Reset();
@@ -276,6 +310,16 @@ FOnlineUserCacheAccelBytePtr FOnlineSubsystemAccelByte::GetUserCache() const
 	return UserCache;
 }
 
+FAccelByteAsyncTaskMetricsPtr FOnlineSubsystemAccelByte::GetAsyncTaskMetrics() const
+{
+	return AsyncTaskMetrics;
+}
+
+FOnlineAsyncTaskManagerAccelBytePtr FOnlineSubsystemAccelByte::GetAsyncTaskManager() const
+{
+	return AsyncTaskManager;
+}
+
 IOnlineEntitlementsPtr FOnlineSubsystemAccelByte::GetEntitlementsInterface() const
 {
 	return EntitlementsInterface;
@@ -410,8 +454,305 @@ bool FOnlineSubsystemAccelByte::Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputD
 		{
 			bWasHandled = UserInterface->TestExec(InWorld, Cmd, Ar);
 		}
+		else if (FParse::Command(&Cmd, TEXT("ASYNCTASK")))
+		{
+			// Full command to benchmark the async task pipeline is ONLINE TEST ASYNCTASK <PARALLEL|SERIAL|EPIC|EPICSERIAL> [TaskCount]
+			const FString ModeString = FParse::Token(Cmd, false);
+			const FString TaskCountString = FParse::Token(Cmd, false);
+
+			EExecTestAsyncTaskBenchmarkMode Mode;
+			if (FExecTestAsyncTaskBenchmark::ParseMode(ModeString, Mode))
+			{
+				const int32 TaskCount = TaskCountString.IsEmpty() ? 1000 : FCString::Atoi(*TaskCountString);
+				TSharedPtr<FExecTestAsyncTaskBenchmark> BenchmarkTest = MakeShared<FExecTestAsyncTaskBenchmark>(InWorld, ACCELBYTE_SUBSYSTEM, Mode, TaskCount);
+				BenchmarkTest->Run();
+
+				AddExecTest(BenchmarkTest);
+			}
+			else
+			{
+				Ar.Logf(TEXT("Unknown async task benchmark mode '%s', expected PARALLEL, SERIAL, EPIC or EPICSERIAL."), *ModeString);
+			}
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("ASYNCTASKSCHEDULER")))
+		{
+			// Full command to test the async task priority scheduler is ONLINE TEST ASYNCTASKSCHEDULER [TaskCount] [BackgroundLimit]
+			const FString TaskCountString = FParse::Token(Cmd, false);
+			const FString BackgroundLimitString = FParse::Token(Cmd, false);
+
+			const int32 TaskCount = TaskCountString.IsEmpty() ? 8 : FCString::Atoi(*TaskCountString);
+			const int32 BackgroundLimit = BackgroundLimitString.IsEmpty() ? 2 : FCString::Atoi(*BackgroundLimitString);
+			TSharedPtr<FExecTestAsyncTaskScheduler> SchedulerTest = MakeShared<FExecTestAsyncTaskScheduler>(InWorld, ACCELBYTE_SUBSYSTEM, TaskCount, BackgroundLimit);
+			SchedulerTest->Run();
+
+			AddExecTest(SchedulerTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("ASYNCTASKCOALESCING")))
+		{
+			// Full command to test the coalescing of identical async tasks is ONLINE TEST ASYNCTASKCOALESCING [TaskCount]
+			const FString TaskCountString = FParse::Token(Cmd, false);
+
+			const int32 TaskCount = TaskCountString.IsEmpty() ? 5 : FCString::Atoi(*TaskCountString);
+			TSharedPtr<FExecTestAsyncTaskCoalescing> CoalescingTest = MakeShared<FExecTestAsyncTaskCoalescing>(InWorld, ACCELBYTE_SUBSYSTEM, TaskCount);
+			CoalescingTest->Run();
+
+			AddExecTest(CoalescingTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("UNIQUEID")))
+		{
+			// Full command to benchmark user unique IDs is ONLINE TEST UNIQUEID [Count] [DistinctCount]
+			const FString CountString = FParse::Token(Cmd, false);
+			const FString DistinctCountString = FParse::Token(Cmd, false);
+
+			const int32 Count = CountString.IsEmpty() ? 1000000 : FCString::Atoi(*CountString);
+			const int32 DistinctCount = DistinctCountString.IsEmpty() ? 1000 : FCString::Atoi(*DistinctCountString);
+			TSharedPtr<FExecTestUniqueIdBenchmark> BenchmarkTest = MakeShared<FExecTestUniqueIdBenchmark>(InWorld, ACCELBYTE_SUBSYSTEM, Count, DistinctCount);
+			BenchmarkTest->Run();
+
+			AddExecTest(BenchmarkTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("USERCACHE")))
+		{
+			// Full command to stress the user cache is ONLINE TEST USERCACHE [ReaderCount] [WriterCount] [DurationSeconds]
+			const FString ReaderCountString = FParse::Token(Cmd, false);
+			const FString WriterCountString = FParse::Token(Cmd, false);
+			const FString DurationString = FParse::Token(Cmd, false);
+
+			const int32 ReaderCount = ReaderCountString.IsEmpty() ? 2 : FCString::Atoi(*ReaderCountString);
+			const int32 WriterCount = WriterCountString.IsEmpty() ? 2 : FCString::Atoi(*WriterCountString);
+			const double DurationSeconds = DurationString.IsEmpty() ? 2.0 : FCString::Atod(*DurationString);
+			TSharedPtr<FExecTestUserCacheBenchmark> BenchmarkTest = MakeShared<FExecTestUserCacheBenchmark>(InWorld, ACCELBYTE_SUBSYSTEM, ReaderCount, WriterCount, DurationSeconds);
+			BenchmarkTest->Run();
+
+			AddExecTest(BenchmarkTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("CHUNKPIPELINE")))
+		{
+			// Full command to test chunked bulk queries is ONLINE TEST CHUNKPIPELINE [IdCount] [LatencyMilliseconds] [MaxChunksInFlight]
+			const FString IdCountString = FParse::Token(Cmd, false);
+			const FString LatencyString = FParse::Token(Cmd, false);
+			const FString MaxChunksInFlightString = FParse::Token(Cmd, false);
+
+			const int32 IdCount = IdCountString.IsEmpty() ? 1000 : FCString::Atoi(*IdCountString);
+			const int32 LatencyMilliseconds = LatencyString.IsEmpty() ? 200 : FCString::Atoi(*LatencyString);
+			const int32 MaxChunksInFlight = MaxChunksInFlightString.IsEmpty() ? 4 : FCString::Atoi(*MaxChunksInFlightString);
+			TSharedPtr<FExecTestChunkedRequestPipeline> PipelineTest = MakeShared<FExecTestChunkedRequestPipeline>(InWorld, ACCELBYTE_SUBSYSTEM, IdCount, LatencyMilliseconds, MaxChunksInFlight);
+			PipelineTest->Run();
+
+			AddExecTest(PipelineTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("USERCACHESNAPSHOT")))
+		{
+			// Full command to test the user cache snapshot is ONLINE TEST USERCACHESNAPSHOT [UserCount]
+			const FString UserCountString = FParse::Token(Cmd, false);
+
+			const int32 UserCount = UserCountString.IsEmpty() ? 1000 : FCString::Atoi(*UserCountString);
+			TSharedPtr<FExecTestUserCacheSnapshot> SnapshotTest = MakeShared<FExecTestUserCacheSnapshot>(InWorld, ACCELBYTE_SUBSYSTEM, UserCount);
+			SnapshotTest->Run();
+
+			AddExecTest(SnapshotTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("NEGATIVEUSERCACHE")))
+		{
+			// Full command to test the negative user cache is ONLINE TEST NEGATIVEUSERCACHE
+			TSharedPtr<FExecTestNegativeUserCache> NegativeCacheTest = MakeShared<FExecTestNegativeUserCache>(InWorld, ACCELBYTE_SUBSYSTEM);
+			NegativeCacheTest->Run();
+
+			AddExecTest(NegativeCacheTest);
+			bWasHandled = true;
+		}
+#if AB_USE_V2_SESSIONS
+		else if (FParse::Command(&Cmd, TEXT("SESSIONUPDATEBENCH")))
+		{
+			// Full command to benchmark session update checks is ONLINE TEST SESSIONUPDATEBENCH [SessionCount] [TickCount]
+			const FString SessionCountString = FParse::Token(Cmd, false);
+			const FString TickCountString = FParse::Token(Cmd, false);
+
+			const int32 SessionCount = SessionCountString.IsEmpty() ? 1000 : FCString::Atoi(*SessionCountString);
+			const int32 TickCount = TickCountString.IsEmpty() ? 1000 : FCString::Atoi(*TickCountString);
+			TSharedPtr<FExecTestSessionUpdateBenchmark> BenchmarkTest = MakeShared<FExecTestSessionUpdateBenchmark>(InWorld, ACCELBYTE_SUBSYSTEM, SessionCount, TickCount);
+			BenchmarkTest->Run();
+
+			AddExecTest(BenchmarkTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("SESSIONIDINDEX")))
+		{
+			// Full command to benchmark session lookups by ID is ONLINE TEST SESSIONIDINDEX [SessionCount] [LookupCount]
+			const FString SessionCountString = FParse::Token(Cmd, false);
+			const FString LookupCountString = FParse::Token(Cmd, false);
+
+			const int32 SessionCount = SessionCountString.IsEmpty() ? 1000 : FCString::Atoi(*SessionCountString);
+			const int32 LookupCount = LookupCountString.IsEmpty() ? 100000 : FCString::Atoi(*LookupCountString);
+			TSharedPtr<FExecTestSessionIdIndex> BenchmarkTest = MakeShared<FExecTestSessionIdIndex>(InWorld, ACCELBYTE_SUBSYSTEM, SessionCount, LookupCount);
+			BenchmarkTest->Run();
+
+			AddExecTest(BenchmarkTest);
+			bWasHandled = true;
+		}
+#endif
+		else if (FParse::Command(&Cmd, TEXT("SESSIONATTRDIFF")))
+		{
+			// Full command to test session attribute diffs is ONLINE TEST SESSIONATTRDIFF [AttributeCount]
+			const FString AttributeCountString = FParse::Token(Cmd, false);
+
+			const int32 AttributeCount = AttributeCountString.IsEmpty() ? 500 : FCString::Atoi(*AttributeCountString);
+			TSharedPtr<FExecTestSessionAttributeDiff> DiffTest = MakeShared<FExecTestSessionAttributeDiff>(InWorld, ACCELBYTE_SUBSYSTEM, AttributeCount);
+			DiffTest->Run();
+
+			AddExecTest(DiffTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("SESSIONARRAYCODEC")))
+		{
+			// Full command to test the array session setting codec is ONLINE TEST SESSIONARRAYCODEC [StringCount] [StringLength] [Iterations]
+			const FString StringCountString = FParse::Token(Cmd, false);
+			const FString StringLengthString = FParse::Token(Cmd, false);
+			const FString IterationsString = FParse::Token(Cmd, false);
+
+			const int32 StringCount = StringCountString.IsEmpty() ? 1000 : FCString::Atoi(*StringCountString);
+			const int32 StringLength = StringLengthString.IsEmpty() ? 32 : FCString::Atoi(*StringLengthString);
+			const int32 Iterations = IterationsString.IsEmpty() ? 100 : FCString::Atoi(*IterationsString);
+			TSharedPtr<FExecTestSessionArrayCodec> CodecTest = MakeShared<FExecTestSessionArrayCodec>(InWorld, ACCELBYTE_SUBSYSTEM, StringCount, StringLength, Iterations);
+			CodecTest->Run();
+
+			AddExecTest(CodecTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("POLLSCHEDULER")))
+		{
+			// Full command to test the poll scheduler is ONLINE TEST POLLSCHEDULER [PollCount] [TickCount]
+			const FString PollCountString = FParse::Token(Cmd, false);
+			const FString TickCountString = FParse::Token(Cmd, false);
+
+			const int32 PollCount = PollCountString.IsEmpty() ? 10000 : FCString::Atoi(*PollCountString);
+			const int32 TickCount = TickCountString.IsEmpty() ? 1000 : FCString::Atoi(*TickCountString);
+			TSharedPtr<FExecTestPollScheduler> SchedulerTest = MakeShared<FExecTestPollScheduler>(InWorld, ACCELBYTE_SUBSYSTEM, PollCount, TickCount);
+			SchedulerTest->Run();
+
+			AddExecTest(SchedulerTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("CHATRINGBUFFER")))
+		{
+			// Full command to test the chat message ring buffer is ONLINE TEST CHATRINGBUFFER [MessageCount] [Capacity]
+			const FString MessageCountString = FParse::Token(Cmd, false);
+			const FString CapacityString = FParse::Token(Cmd, false);
+
+			const int32 MessageCount = MessageCountString.IsEmpty() ? 100000 : FCString::Atoi(*MessageCountString);
+			const int32 Capacity = CapacityString.IsEmpty() ? 1000 : FCString::Atoi(*CapacityString);
+			TSharedPtr<FExecTestChatRingBuffer> RingBufferTest = MakeShared<FExecTestChatRingBuffer>(InWorld, ACCELBYTE_SUBSYSTEM, MessageCount, Capacity);
+			RingBufferTest->Run();
+
+			AddExecTest(RingBufferTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("CHATROOMMEMBERS")))
+		{
+			// Full command to test the chat room membership index is ONLINE TEST CHATROOMMEMBERS [MemberCount] [OperationCount]
+			const FString MemberCountString = FParse::Token(Cmd, false);
+			const FString OperationCountString = FParse::Token(Cmd, false);
+
+			const int32 MemberCount = MemberCountString.IsEmpty() ? 10000 : FCString::Atoi(*MemberCountString);
+			const int32 OperationCount = OperationCountString.IsEmpty() ? 100000 : FCString::Atoi(*OperationCountString);
+			TSharedPtr<FExecTestChatRoomMembers> MembersTest = MakeShared<FExecTestChatRoomMembers>(InWorld, ACCELBYTE_SUBSYSTEM, MemberCount, OperationCount);
+			MembersTest->Run();
+
+			AddExecTest(MembersTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("CHATTOPICPAGING")))
+		{
+			// Full command to test the paged chat topic query is ONLINE TEST CHATTOPICPAGING [TopicCount] [PageSize] [MaxPagesInFlight] [LatencyMilliseconds]
+			const FString TopicCountString = FParse::Token(Cmd, false);
+			const FString PageSizeString = FParse::Token(Cmd, false);
+			const FString MaxPagesInFlightString = FParse::Token(Cmd, false);
+			const FString LatencyMillisecondsString = FParse::Token(Cmd, false);
+
+			const int32 TopicCount = TopicCountString.IsEmpty() ? 5000 : FCString::Atoi(*TopicCountString);
+			const int32 PageSize = PageSizeString.IsEmpty() ? 200 : FCString::Atoi(*PageSizeString);
+			const int32 MaxPagesInFlight = MaxPagesInFlightString.IsEmpty() ? 4 : FCString::Atoi(*MaxPagesInFlightString);
+			const int32 LatencyMilliseconds = LatencyMillisecondsString.IsEmpty() ? 50 : FCString::Atoi(*LatencyMillisecondsString);
+			TSharedPtr<FExecTestChatTopicPaging> PagingTest = MakeShared<FExecTestChatTopicPaging>(InWorld, ACCELBYTE_SUBSYSTEM, TopicCount, PageSize, MaxPagesInFlight, LatencyMilliseconds);
+			PagingTest->Run();
+
+			AddExecTest(PagingTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("CHATSENDERSTORM")))
+		{
+			// Full command to benchmark chat sender ID reuse is ONLINE TEST CHATSENDERSTORM [MessageCount] [SenderCount]
+			const FString MessageCountString = FParse::Token(Cmd, false);
+			const FString SenderCountString = FParse::Token(Cmd, false);
+
+			const int32 MessageCount = MessageCountString.IsEmpty() ? 100000 : FCString::Atoi(*MessageCountString);
+			const int32 SenderCount = SenderCountString.IsEmpty() ? 20 : FCString::Atoi(*SenderCountString);
+			TSharedPtr<FExecTestChatSenderStorm> StormTest = MakeShared<FExecTestChatSenderStorm>(InWorld, ACCELBYTE_SUBSYSTEM, MessageCount, SenderCount);
+			StormTest->Run();
+
+			AddExecTest(StormTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("TELEMETRYSPILL")))
+		{
+			// Full command to test the telemetry spill queue is ONLINE TEST TELEMETRYSPILL [EventCount] [MaxInMemoryEvents]
+			const FString EventCountString = FParse::Token(Cmd, false);
+			const FString MaxInMemoryEventsString = FParse::Token(Cmd, false);
+
+			const int32 EventCount = EventCountString.IsEmpty() ? 10000 : FCString::Atoi(*EventCountString);
+			const int32 MaxInMemoryEvents = MaxInMemoryEventsString.IsEmpty() ? 256 : FCString::Atoi(*MaxInMemoryEventsString);
+			TSharedPtr<FExecTestTelemetrySpill> SpillTest = MakeShared<FExecTestTelemetrySpill>(InWorld, ACCELBYTE_SUBSYSTEM, EventCount, MaxInMemoryEvents);
+			SpillTest->Run();
+
+			AddExecTest(SpillTest);
+			bWasHandled = true;
+		}
+		else if (FParse::Command(&Cmd, TEXT("TELEMETRYREPLAYBATCH")))
+		{
+			// Full command to test batched telemetry replay is ONLINE TEST TELEMETRYREPLAYBATCH [EventCount] [MaxBatchEvents] [MaxBatchSizeKB]
+			const FString EventCountString = FParse::Token(Cmd, false);
+			const FString MaxBatchEventsString = FParse::Token(Cmd, false);
+			const FString MaxBatchSizeKBString = FParse::Token(Cmd, false);
+
+			const int32 EventCount = EventCountString.IsEmpty() ? 500 : FCString::Atoi(*EventCountString);
+			const int32 MaxBatchEvents = MaxBatchEventsString.IsEmpty() ? 50 : FCString::Atoi(*MaxBatchEventsString);
+			const int32 MaxBatchSizeKB = MaxBatchSizeKBString.IsEmpty() ? 64 : FCString::Atoi(*MaxBatchSizeKBString);
+			TSharedPtr<FExecTestTelemetryReplayBatch> BatchTest = MakeShared<FExecTestTelemetryReplayBatch>(InWorld, ACCELBYTE_SUBSYSTEM, EventCount, MaxBatchEvents, MaxBatchSizeKB);
+			BatchTest->Run();
+
+			AddExecTest(BatchTest);
+			bWasHandled = true;
+		}
 #endif
 	}
+	else if (FParse::Command(&Cmd, TEXT("ASYNCTASKMETRICS")) && AsyncTaskMetrics.IsValid())
+	{
+		// ONLINE ASYNCTASKMETRICS [RESET]
+		if (FParse::Command(&Cmd, TEXT("RESET")))
+		{
+			AsyncTaskMetrics->Reset();
+		}
+		else
+		{
+			AsyncTaskMetrics->Dump(Ar);
+		}
+		bWasHandled = true;
+	}
+#if AB_USE_V2_SESSIONS
+	else if (FParse::Command(&Cmd, TEXT("SESSIONPOLLS")) && SessionInterface.IsValid())
+	{
+		// ONLINE SESSIONPOLLS
+		StaticCastSharedPtr<FOnlineSessionV2AccelByte>(SessionInterface)->DumpScheduledPolls(Ar);
+		bWasHandled = true;
+	}
+#endif
 	
 	// If we didn't handle any exec tests, then just pass handling to the super method
 	if (!bWasHandled)
@@ -436,7 +777,19 @@ bool FOnlineSubsystemAccelByte::Tick(float DeltaTime)
 	
 	if (AsyncTaskManager)
 	{
+		const double GameTickStartInSeconds = FPlatformTime::Seconds();
 		AsyncTaskManager->GameTick();
+		if (AsyncTaskMetrics.IsValid())
+		{
+			AsyncTaskMetrics->RecordGameTick(FPlatformTime::Seconds() - GameTickStartInSeconds);
+		}
+	}
+
+	if (UserCache.IsValid())
+	{
+		UserCache->FlushPendingUserQueries();
+		UserCache->TickPurge();
+		UserCache->TickSnapshot();
 	}
 
 	if (SessionInterface.IsValid())
@@ -449,6 +802,16 @@ bool FOnlineSubsystemAccelByte::Tick(float DeltaTime)
 		AuthInterface->Tick(DeltaTime);
 	}
 
+	if (PredefinedEventInterface.IsValid())
+	{
+		PredefinedEventInterface->Tick(DeltaTime);
+	}
+
+	if (GameStandardEventInterface.IsValid())
+	{
+		GameStandardEventInterface->Tick(DeltaTime);
+	}
+
 	if (bVoiceInterfaceInitialized && VoiceInterface.IsValid())
 	{
 		VoiceInterface->Tick(DeltaTime);
@@ -503,15 +866,21 @@ FString FOnlineSubsystemAccelByte::GetNativeAppId()
 	return NativeSubsystem->GetAppId();
 }
 
-FOnlineAsyncEpicTaskAccelByte* FOnlineSubsystemAccelByte::CreateAndDispatchEpic(int32 LocalUserNum, const FVoidHandler& InDelegate)
+FOnlineAsyncEpicTaskAccelByte* FOnlineSubsystemAccelByte::CreateAndDispatchEpic(int32 LocalUserNum, const FVoidHandler& InDelegate, TOptional<EAccelByteAsyncTaskPriority> Priority)
 {
 	FOnlineAsyncEpicTaskAccelByte* NewTask = new FOnlineAsyncEpicTaskAccelByte(this, LocalUserNum, InDelegate);
 
 	uint32 EpicID = EpicCounter.Increment();
 	NewTask->SetEpicID(EpicID);
 	FOnlineAsyncTask* Upcast = static_cast<FOnlineAsyncTask*>(NewTask);
-	AsyncTaskManager->CheckMaxParallelTasks();
-	AsyncTaskManager->AddToParallelTasks(Upcast);
+	if (Priority.IsSet())
+	{
+		AsyncTaskManager->AddToParallelTasksWithPriority(Upcast, Priority.GetValue());
+	}
+	else
+	{
+		AsyncTaskManager->AddToParallelTasks(Upcast);
+	}
 
 	return NewTask;
 }
@@ -544,18 +913,32 @@ void FOnlineSubsystemAccelByte::CreateAndDispatchAsyncTaskImplementation(FOnline
 	if (TaskInfo.bCreateEpicForThis)
 	{
 		FScopeLock Lock(this->GetEpicTaskLock());
-		SetUpcomingEpic(CreateAndDispatchEpic(AccelByteNewTask->GetLocalUserNum(), FVoidHandler::CreateLambda([]() {})));
+		SetUpcomingEpic(CreateAndDispatchEpic(AccelByteNewTask->GetLocalUserNum(), FVoidHandler::CreateLambda([]() {}), AccelByteNewTask->GetTaskPriority()));
 		AccelByteNewTask->SetEpicForThisTask(EpicForUpcomingTask);
 		EnqueueTaskToEpic(EpicForUpcomingTask, AccelByteNewTask, TaskInfo.Type);
 		ResetEpicHasBeenSet();
 		return;
 	}
 
+	// If an identical request is already in flight, this task will be completed with its result instead
+	if (!AccelByteNewTask->HasParent() && AsyncTaskManager->TryCoalesceTask(AccelByteNewTask))
+	{
+		return;
+	}
+
 	switch (TaskInfo.Type)
 	{
 	case ETypeOfOnlineAsyncTask::Parallel:
-		AsyncTaskManager->CheckMaxParallelTasks();
-		AsyncTaskManager->AddToParallelTasks(NewTask);
+		// Child tasks are part of work that has already been admitted, making them wait for a slot could leave the parent
+		// holding a slot while waiting on a child that can never be admitted
+		if (AccelByteNewTask->HasParent())
+		{
+			AsyncTaskManager->AddToParallelTasks(NewTask);
+		}
+		else
+		{
+			AsyncTaskManager->AddToParallelTasksWithPriority(NewTask, AccelByteNewTask->GetTaskPriority());
+		}
 		break;
 	case ETypeOfOnlineAsyncTask::Serial:
 		AsyncTaskManager->AddToInQueue(NewTask);
@@ -570,6 +953,11 @@ bool FOnlineSubsystemAccelByte::IsUpcomingEpicAlreadySet()
 	return EpicForUpcomingTask != nullptr;
 }
 
+bool FOnlineSubsystemAccelByte::IsUpcomingParentTaskAlreadySet()
+{
+	return ParentTaskForUpcomingTask != nullptr;
+}
+
 void FOnlineSubsystemAccelByte::SetUpcomingEpic(FOnlineAsyncEpicTaskAccelByte* Epic)
 {
 	EpicForUpcomingTask = Epic;
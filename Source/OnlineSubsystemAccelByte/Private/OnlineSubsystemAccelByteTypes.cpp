@@ -11,6 +11,7 @@
 #include "OnlineSubsystemAccelByteDefines.h"
 #include "Misc/Base64.h"
 #include "JsonObjectConverter.h"
+#include "Utilities/AccelByteUniqueIdCompactCodec.h"
 
 void FNotificationMessageManager::PublishToTopic(FString const& InTopic, const FAccelByteModelsNotificationMessage& InMessage, int32 InLocalUserNum)
 {
@@ -204,8 +205,117 @@ FUniqueNetIdAccelByteResourceRef FUniqueNetIdAccelByteResource::CastChecked(FUni
 
 #pragma region FUniquneNetIdAccelByteUser
 
+using FUniqueNetIdAccelByteUserWeakPtr = TWeakPtr<FUniqueNetIdAccelByteUser const>;
+
+/** Key functions matching composites by exact value, unlike FAccelByteUniqueIdComposite::operator== */
+struct FAccelByteUniqueIdCompositeInternKeyFuncs
+	: public TDefaultMapKeyFuncs<FAccelByteUniqueIdComposite, FUniqueNetIdAccelByteUserWeakPtr, false>
+{
+	static uint32 GetKeyHash(FAccelByteUniqueIdComposite const& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Id), HashCombine(GetTypeHash(Key.PlatformType), GetTypeHash(Key.PlatformId)));
+	}
+
+	static bool Matches(FAccelByteUniqueIdComposite const& A, FAccelByteUniqueIdComposite const& B)
+	{
+		return A.Id.Equals(B.Id, ESearchCase::CaseSensitive)
+			&& A.PlatformType.Equals(B.PlatformType, ESearchCase::CaseSensitive)
+			&& A.PlatformId.Equals(B.PlatformId, ESearchCase::CaseSensitive);
+	}
+};
+
+/** Key functions matching encoded ID strings case sensitively, as Base64 is case sensitive */
+struct FAccelByteUniqueIdStringInternKeyFuncs
+	: public TDefaultMapKeyFuncs<FString, FUniqueNetIdAccelByteUserWeakPtr, false>
+{
+	static uint32 GetKeyHash(FString const& Key)
+	{
+		return FCrc::StrCrc32(*Key);
+	}
+
+	static bool Matches(FString const& A, FString const& B)
+	{
+		return A.Equals(B, ESearchCase::CaseSensitive);
+	}
+};
+
+/**
+ * Weak references to every user ID made through FUniqueNetIdAccelByteUser::Create, so that creating the same ID again
+ * skips the JSON and Base64 round trip. Entries of destroyed IDs are swept once the tables double in size.
+ */
+struct FAccelByteUniqueIdInternTable
+{
+	TMap<FAccelByteUniqueIdComposite, FUniqueNetIdAccelByteUserWeakPtr, FDefaultSetAllocator, FAccelByteUniqueIdCompositeInternKeyFuncs> IdsByComposite;
+	TMap<FString, FUniqueNetIdAccelByteUserWeakPtr, FDefaultSetAllocator, FAccelByteUniqueIdStringInternKeyFuncs> IdsByEncodedString;
+	FCriticalSection Lock;
+	FThreadSafeBool bEnabled = true;
+
+	/** Amount of entries at which destroyed IDs are swept next, never lower than MinSweepThreshold */
+	int32 SweepThreshold = MinSweepThreshold;
+
+	enum { MinSweepThreshold = 1024 };
+
+	FUniqueNetIdAccelByteUserPtr FindByComposite(FAccelByteUniqueIdComposite const& CompositeId)
+	{
+		FScopeLock ScopeLock(&Lock);
+		const FUniqueNetIdAccelByteUserWeakPtr* Found = IdsByComposite.Find(CompositeId);
+		if (Found == nullptr)
+		{
+			return nullptr;
+		}
+		return Found->Pin();
+	}
+
+	FUniqueNetIdAccelByteUserPtr FindByEncodedString(FString const& EncodedString)
+	{
+		FScopeLock ScopeLock(&Lock);
+		const FUniqueNetIdAccelByteUserWeakPtr* Found = IdsByEncodedString.Find(EncodedString);
+		if (Found == nullptr)
+		{
+			return nullptr;
+		}
+		return Found->Pin();
+	}
+
+	void Add(FUniqueNetIdAccelByteUserRef const& UserId, bool bAddComposite)
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (bAddComposite)
+		{
+			IdsByComposite.Add(UserId->GetCompositeStructure(), UserId);
+		}
+		IdsByEncodedString.Add(UserId->ToString(), UserId);
+
+		if (IdsByComposite.Num() + IdsByEncodedString.Num() >= SweepThreshold)
+		{
+			for (auto It = IdsByComposite.CreateIterator(); It; ++It)
+			{
+				if (!It.Value().IsValid())
+				{
+					It.RemoveCurrent();
+				}
+			}
+			for (auto It = IdsByEncodedString.CreateIterator(); It; ++It)
+			{
+				if (!It.Value().IsValid())
+				{
+					It.RemoveCurrent();
+				}
+			}
+			SweepThreshold = FMath::Max<int32>(MinSweepThreshold, 2 * (IdsByComposite.Num() + IdsByEncodedString.Num()));
+		}
+	}
+
+	static FAccelByteUniqueIdInternTable& Get()
+	{
+		static FAccelByteUniqueIdInternTable Table;
+		return Table;
+	}
+};
+
 FUniqueNetIdAccelByteUser::FUniqueNetIdAccelByteUser()
 	: FUniqueNetIdAccelByteResource(TEXT(""), ACCELBYTE_USER_ID_TYPE)
+	, AccelByteIdHash(ComputeAccelByteIdHash(TEXT("")))
 {
 }
 
@@ -245,6 +355,7 @@ FUniqueNetIdAccelByteUser::FUniqueNetIdAccelByteUser(FAccelByteUniqueIdComposite
 	, FString const& EncodedComposite)
 	: FUniqueNetIdAccelByteResource(EncodedComposite, ACCELBYTE_USER_ID_TYPE)
 	, CompositeStructure(CompositeId)
+	, AccelByteIdHash(ComputeAccelByteIdHash(CompositeId.Id))
 {
 	// Check if this ID is valid and cache it so that we can cut down on processing of the ID later
 	if (!bHasCachedValidState)
@@ -262,6 +373,16 @@ FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueI
 		return Invalid();
 	}
 
+	FAccelByteUniqueIdInternTable& InternTable = FAccelByteUniqueIdInternTable::Get();
+	if (InternTable.bEnabled)
+	{
+		FUniqueNetIdAccelByteUserPtr InternedId = InternTable.FindByComposite(CompositeId);
+		if (InternedId.IsValid())
+		{
+			return InternedId.ToSharedRef();
+		}
+	}
+
 	FString CompositeString;
 	if (!FJsonObjectConverter::UStructToJsonObjectString(CompositeId, CompositeString))
 	{
@@ -278,8 +399,15 @@ FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueI
 
 	FUniqueNetIdAccelByteUser* User = new FUniqueNetIdAccelByteUser(MoveTemp(EncodedString), ACCELBYTE_USER_ID_TYPE);
 	User->CompositeStructure = CompositeId;
+	User->AccelByteIdHash = ComputeAccelByteIdHash(CompositeId.Id);
 	
-	return MakeShareable(User);
+	const FUniqueNetIdAccelByteUserRef UserRef = MakeShareable(User);
+	if (InternTable.bEnabled)
+	{
+		InternTable.Add(UserRef, true);
+	}
+
+	return UserRef;
 }
 
 FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(FString const& InNetIdStr)
@@ -291,6 +419,22 @@ FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(FString const& In
 		return Create(FAccelByteUniqueIdComposite(InNetIdStr));
 	}
 
+	FAccelByteUniqueIdComposite CompactCompositeId{};
+	if (FAccelByteUniqueIdCompactCodec::DecodeFromString(InNetIdStr, CompactCompositeId))
+	{
+		return Create(CompactCompositeId);
+	}
+
+	FAccelByteUniqueIdInternTable& InternTable = FAccelByteUniqueIdInternTable::Get();
+	if (InternTable.bEnabled)
+	{
+		FUniqueNetIdAccelByteUserPtr InternedId = InternTable.FindByEncodedString(InNetIdStr);
+		if (InternedId.IsValid())
+		{
+			return InternedId.ToSharedRef();
+		}
+	}
+
 	// Check if this is a Base64 encoded string first before anything. If it is, then we want to check if we can parse
 	// JSON from it. If so, then we just want to pass it directly into a new instance of a FUniqueNetIdAccelByteUser.
 	// Otherwise, we want to pass the string directly as the AccelByte ID component of a new FUniqueNetIdAccelByteUser's
@@ -305,7 +449,14 @@ FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(FString const& In
 		return Create(FAccelByteUniqueIdComposite(InNetIdStr));
 	}
 
-	return MakeShareable<FUniqueNetIdAccelByteUser const>(new FUniqueNetIdAccelByteUser(CompositeId, InNetIdStr));
+	const FUniqueNetIdAccelByteUserRef UserRef = MakeShareable<FUniqueNetIdAccelByteUser const>(new FUniqueNetIdAccelByteUser(CompositeId, InNetIdStr));
+	if (InternTable.bEnabled)
+	{
+		// Only interned by string, as the string may not be the canonical encoding of its composite
+		InternTable.Add(UserRef, false);
+	}
+
+	return UserRef;
 }
 
 FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(FUniqueNetId const& InNetId)
@@ -359,6 +510,18 @@ FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::CastChecked(FUniqueNetId
 	return StaticCastSharedRef<FUniqueNetIdAccelByteUser const>(InNetIdRef);
 }
 
+void FUniqueNetIdAccelByteUser::SetInterningEnabled(bool bInEnabled)
+{
+	FAccelByteUniqueIdInternTable::Get().bEnabled = bInEnabled;
+}
+
+int32 FUniqueNetIdAccelByteUser::GetInternedIdCount()
+{
+	FAccelByteUniqueIdInternTable& InternTable = FAccelByteUniqueIdInternTable::Get();
+	FScopeLock ScopeLock(&InternTable.Lock);
+	return InternTable.IdsByComposite.Num() + InternTable.IdsByEncodedString.Num();
+}
+
 FName FUniqueNetIdAccelByteUser::GetType() const
 {
 	return ACCELBYTE_USER_ID_TYPE;
@@ -467,22 +630,38 @@ FAccelByteUniqueIdComposite FUniqueNetIdAccelByteUser::GetCompositeStructure() c
 	return CompositeStructure;
 }
 
+FString FUniqueNetIdAccelByteUser::ToCompactString() const
+{
+	return FAccelByteUniqueIdCompactCodec::EncodeToString(CompositeStructure);
+}
+
 bool FUniqueNetIdAccelByteUser::Compare(FUniqueNetId const& Other) const
 {
-	if (Other.GetType() == ACCELBYTE_USER_ID_TYPE)
+	if (&Other == this)
 	{
-		const FUniqueNetIdAccelByteUserRef OtherCompositeId = FUniqueNetIdAccelByteUser::CastChecked(Other);
+		return true;
+	}
 
-		// First check whether AccelByte IDs match, if they do then these IDs are definitely equal
-		if (GetAccelByteId() == OtherCompositeId->GetAccelByteId())
+	if (Other.GetType() == ACCELBYTE_USER_ID_TYPE)
+	{
+		// Type is already checked, so skip the shared reference round trip of CastChecked
+		const FUniqueNetIdAccelByteUser& OtherCompositeId = static_cast<FUniqueNetIdAccelByteUser const&>(Other);
+
+		// IDs that both have an AccelByte ID are only equal if those match. Different hashes mean different AccelByte IDs,
+		// so the string comparison is only needed when the hashes match.
+		const bool bHasAccelByteId = !CompositeStructure.Id.IsEmpty();
+		const bool bOtherHasAccelByteId = !OtherCompositeId.CompositeStructure.Id.IsEmpty();
+		if (bHasAccelByteId && bOtherHasAccelByteId)
 		{
-			return true;
+			return AccelByteIdHash == OtherCompositeId.AccelByteIdHash
+				&& CompositeStructure.Id == OtherCompositeId.CompositeStructure.Id;
 		}
-		// Otherwise, check if both IDs have platform information attached...
-		else if (HasPlatformInformation() && OtherCompositeId->HasPlatformInformation())
+		// Otherwise, IDs that both lack an AccelByte ID are matched by platform type and platform ID. Matching the platform
+		// fields of IDs that have an AccelByte ID as well would make equal IDs hash differently in GetTypeHash.
+		else if (!bHasAccelByteId && !bOtherHasAccelByteId)
 		{
-			// If they do, then check whether the platform type and platform ID for both match
-			return GetPlatformType() == OtherCompositeId->GetPlatformType() && GetPlatformId() == OtherCompositeId->GetPlatformId();
+			return CompositeStructure.PlatformType == OtherCompositeId.CompositeStructure.PlatformType
+				&& CompositeStructure.PlatformId == OtherCompositeId.CompositeStructure.PlatformId;
 		}
 
 		return false;
@@ -491,12 +670,35 @@ bool FUniqueNetIdAccelByteUser::Compare(FUniqueNetId const& Other) const
 	return FUniqueNetIdString::Compare(Other);
 }
 
+uint32 FUniqueNetIdAccelByteUser::GetTypeHash() const
+{
+	if (CompositeStructure.Id.IsEmpty())
+	{
+		// Both hashes are case insensitive, matching how Compare matches the platform fields
+		return HashCombine(::GetTypeHash(CompositeStructure.PlatformType), ::GetTypeHash(CompositeStructure.PlatformId));
+	}
+
+	return static_cast<uint32>(AccelByteIdHash) ^ static_cast<uint32>(AccelByteIdHash >> 32);
+}
+
+uint64 FUniqueNetIdAccelByteUser::ComputeAccelByteIdHash(FString const& AccelByteId)
+{
+	uint64 Hash = 0xcbf29ce484222325ull;
+	for (const TCHAR Char : AccelByteId)
+	{
+		Hash ^= static_cast<uint64>(FChar::ToLower(Char));
+		Hash *= 0x100000001b3ull;
+	}
+	return Hash;
+}
+
 void FUniqueNetIdAccelByteUser::DecodeIDElements()
 {
 	// If this is supposed to be an invalid ID, then just return that accordingly
 	if (UniqueNetIdStr == ACCELBYTE_INVALID_ID_VALUE)
 	{
 		CompositeStructure.Id = ACCELBYTE_INVALID_ID_VALUE;
+		AccelByteIdHash = ComputeAccelByteIdHash(CompositeStructure.Id);
 		return;
 	}
 
@@ -513,6 +715,8 @@ void FUniqueNetIdAccelByteUser::DecodeIDElements()
 		return;
 	}
 
+	AccelByteIdHash = ComputeAccelByteIdHash(CompositeStructure.Id);
+
 	// Finally, cache a valid state from this ID if we haven't yet
 	if (!bHasCachedValidState)
 	{
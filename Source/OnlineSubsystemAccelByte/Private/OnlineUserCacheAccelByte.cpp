@@ -9,6 +9,10 @@
 #include "AsyncTasks/User/OnlineAsyncTaskAccelByteQueryUserProfile.h"
 #include "OnlineUserInterfaceAccelByte.h"
 #include "OnlineSubsystemUtils.h"
+#include "Utilities/AccelByteUserCacheSnapshot.h"
+#include "Core/AccelByteRegistry.h"
+#include "Async/Async.h"
+#include "Misc/Paths.h"
 
 FAccelByteUserPlatformLinkInformation::FAccelByteUserPlatformLinkInformation
 	(const FString& InUserId /*= TEXT("")*/)
@@ -179,6 +183,20 @@ FOnlineUserCacheAccelByte::FOnlineUserCacheAccelByte(FOnlineSubsystemAccelByte*
 {
 }
 
+FOnlineUserCacheAccelByte::~FOnlineUserCacheAccelByte()
+{
+	// Background snapshot work refers back to this cache, so it has to finish before we go away
+	if (SnapshotLoadFuture.IsValid())
+	{
+		SnapshotLoadFuture.Wait();
+	}
+
+	if (SnapshotSaveFuture.IsValid())
+	{
+		SnapshotSaveFuture.Wait();
+	}
+}
+
 void FOnlineUserCacheAccelByte::Init()
 {
 	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte")
@@ -197,6 +215,92 @@ void FOnlineUserCacheAccelByte::Init()
 		UE_LOG_AB(Verbose, TEXT("'TimeUntilStaleSeconds' is not specified in DefaultEngine.ini, or on command line. Defaulting to %d seconds."), TimeUntilStaleSecondsInt);
 	}
 	TimeUntilStaleSeconds = static_cast<double>(TimeUntilStaleSecondsInt);
+
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte")
+		, TEXT("bEnableUserCachePurge")
+		, bEnableUserCachePurge))
+	{
+		UE_LOG_AB(Verbose, TEXT("'bEnableUserCachePurge' is not specified in DefaultEngine.ini, or on command line. Defaulting to '%s'."), LOG_BOOL_FORMAT(bEnableUserCachePurge));
+	}
+
+	int32 UserCachePurgeTimeoutSecondsInt { static_cast<int32>(UserCachePurgeTimeoutSeconds) };
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte")
+		, TEXT("UserCachePurgeTimeoutSeconds")
+		, UserCachePurgeTimeoutSecondsInt))
+	{
+		UE_LOG_AB(Verbose, TEXT("'UserCachePurgeTimeoutSeconds' is not specified in DefaultEngine.ini, or on command line. Defaulting to %d seconds."), UserCachePurgeTimeoutSecondsInt);
+	}
+	UserCachePurgeTimeoutSeconds = static_cast<double>(UserCachePurgeTimeoutSecondsInt);
+
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte")
+		, TEXT("MaxUserCachePurgesPerTick")
+		, MaxUserCachePurgesPerTick))
+	{
+		UE_LOG_AB(Verbose, TEXT("'MaxUserCachePurgesPerTick' is not specified in DefaultEngine.ini, or on command line. Defaulting to %d."), MaxUserCachePurgesPerTick);
+	}
+
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte")
+		, TEXT("MaxCachedUserCount")
+		, MaxCachedUserCount))
+	{
+		UE_LOG_AB(Verbose, TEXT("'MaxCachedUserCount' is not specified in DefaultEngine.ini, or on command line. Defaulting to %d."), MaxCachedUserCount);
+	}
+
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte")
+		, TEXT("bEnableUserQueryBatching")
+		, bEnableUserQueryBatching))
+	{
+		UE_LOG_AB(Verbose, TEXT("'bEnableUserQueryBatching' is not specified in DefaultEngine.ini, or on command line. Defaulting to '%s'."), LOG_BOOL_FORMAT(bEnableUserQueryBatching));
+	}
+
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte")
+		, TEXT("UserQueryBatchWindowMilliseconds")
+		, UserQueryBatchWindowMilliseconds))
+	{
+		UE_LOG_AB(Verbose, TEXT("'UserQueryBatchWindowMilliseconds' is not specified in DefaultEngine.ini, or on command line. Defaulting to %d milliseconds."), UserQueryBatchWindowMilliseconds);
+	}
+
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte")
+		, TEXT("MaxParallelUserQueryChunks")
+		, MaxParallelUserQueryChunks))
+	{
+		UE_LOG_AB(Verbose, TEXT("'MaxParallelUserQueryChunks' is not specified in DefaultEngine.ini, or on command line. Defaulting to %d."), MaxParallelUserQueryChunks);
+	}
+	MaxParallelUserQueryChunks = FMath::Max(MaxParallelUserQueryChunks, 1);
+
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte")
+		, TEXT("bEnableUserCacheSnapshot")
+		, bEnableUserCacheSnapshot))
+	{
+		UE_LOG_AB(Verbose, TEXT("'bEnableUserCacheSnapshot' is not specified in DefaultEngine.ini, or on command line. Defaulting to '%s'."), LOG_BOOL_FORMAT(bEnableUserCacheSnapshot));
+	}
+
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte")
+		, TEXT("UserCacheSnapshotIntervalSeconds")
+		, UserCacheSnapshotIntervalSeconds))
+	{
+		UE_LOG_AB(Verbose, TEXT("'UserCacheSnapshotIntervalSeconds' is not specified in DefaultEngine.ini, or on command line. Defaulting to %d seconds."), UserCacheSnapshotIntervalSeconds);
+	}
+
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte")
+		, TEXT("NegativeUserCacheTimeSeconds")
+		, NegativeUserCacheTimeSeconds))
+	{
+		UE_LOG_AB(Verbose, TEXT("'NegativeUserCacheTimeSeconds' is not specified in DefaultEngine.ini, or on command line. Defaulting to %d seconds."), NegativeUserCacheTimeSeconds);
+	}
+
+	if (!FAccelByteUtilities::LoadABConfigFallback(TEXT("OnlineSubsystemAccelByte")
+		, TEXT("MaxNegativeCachedUserCount")
+		, MaxNegativeCachedUserCount))
+	{
+		UE_LOG_AB(Verbose, TEXT("'MaxNegativeCachedUserCount' is not specified in DefaultEngine.ini, or on command line. Defaulting to %d."), MaxNegativeCachedUserCount);
+	}
+	MaxNegativeCachedUserCount = FMath::Max(MaxNegativeCachedUserCount, 1);
+
+	if (bEnableUserCacheSnapshot && Subsystem != nullptr)
+	{
+		SnapshotFilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByte"), FString::Printf(TEXT("UserCache_%s.bin"), *Subsystem->GetInstanceName().ToString()));
+	}
 }
 
 bool FOnlineUserCacheAccelByte::GetFromSubsystem(const IOnlineSubsystem* Subsystem, FOnlineUserCacheAccelBytePtr& OutInterfaceInstance)
@@ -226,62 +330,244 @@ bool FOnlineUserCacheAccelByte::GetFromWorld(const UWorld* World, FOnlineUserCac
 
 int32 FOnlineUserCacheAccelByte::Purge()
 {
-	// Lock while we attempt to purge from the caches
-	FScopeLock ScopeLock(&CacheLock);
+	// Remove users that have gone past their elapsed time from the least recently accessed end of each AccelByte ID shard.
+	// Important users are never in the recency lists, so every user found there can be purged once it has expired.
+	const double CurrentTimeInSeconds = FPlatformTime::Seconds();
+	const bool bIsBounded = MaxUserCachePurgesPerTick > 0;
+
+	TArray<FAccelByteUserInfoRef> PurgedUsers;
+	for (int32 VisitedShardCount = 0; VisitedShardCount < ACCELBYTE_USER_CACHE_SHARD_COUNT; VisitedShardCount++)
+	{
+		if (bIsBounded && PurgedUsers.Num() >= MaxUserCachePurgesPerTick)
+		{
+			break;
+		}
+
+		FUserCacheShard& Shard = AccelByteIdShards[PurgeShardCursor];
+		PurgeShardCursor = (PurgeShardCursor + 1) % ACCELBYTE_USER_CACHE_SHARD_COUNT;
+
+		FScopeLock ScopeLock(&Shard.Lock);
+		while (Shard.LeastRecentUser != nullptr && (!bIsBounded || PurgedUsers.Num() < MaxUserCachePurgesPerTick))
+		{
+			// The list is ordered by last access, so once a user has not expired, none of the users after them have either
+			const double ElapsedTimeInSeconds = CurrentTimeInSeconds - Shard.LeastRecentUser->LastAccessedTimeInSeconds;
+			if (ElapsedTimeInSeconds < UserCachePurgeTimeoutSeconds)
+			{
+				break;
+			}
+
+			EvictLeastRecentUser(Shard, PurgedUsers);
+		}
+	}
+
+	RemovePlatformEntries(PurgedUsers);
+
+	return PurgedUsers.Num();
+}
+
+int32 FOnlineUserCacheAccelByte::GetCachedUserCount()
+{
+	int32 CachedUserCount = 0;
+	for (FUserCacheShard& Shard : AccelByteIdShards)
+	{
+		FScopeLock ScopeLock(&Shard.Lock);
+		CachedUserCount += Shard.UserInfoMap.Num();
+	}
+
+	return CachedUserCount;
+}
+
+int32 FOnlineUserCacheAccelByte::TickPurge()
+{
+	if (!bEnableUserCachePurge)
+	{
+		return 0;
+	}
+
+	return Purge();
+}
+
+void FOnlineUserCacheAccelByte::SetUserCachePurgeTimeoutSeconds(double InUserCachePurgeTimeoutSeconds)
+{
+	UserCachePurgeTimeoutSeconds = InUserCachePurgeTimeoutSeconds;
+}
+
+void FOnlineUserCacheAccelByte::SetMaxUserCachePurgesPerTick(int32 InMaxUserCachePurgesPerTick)
+{
+	MaxUserCachePurgesPerTick = InMaxUserCachePurgesPerTick;
+}
+
+void FOnlineUserCacheAccelByte::SetMaxCachedUserCount(int32 InMaxCachedUserCount)
+{
+	MaxCachedUserCount = InMaxCachedUserCount;
+}
+
+void FOnlineUserCacheAccelByte::TickSnapshot()
+{
+	if (SnapshotFilePath.IsEmpty())
+	{
+		return;
+	}
 
-	// Filter all of the users in the map that have gone past their elapsed time and aren't marked as important so we can
-	// purge them from the user cache maps
 	const double CurrentTimeInSeconds = FPlatformTime::Seconds();
+	if (!bHasStartedSnapshotLoad)
+	{
+		// Loaded from the first tick rather than from Init, so that reading the file never holds up subsystem startup
+		bHasStartedSnapshotLoad = true;
+		NextSnapshotSaveTimeInSeconds = CurrentTimeInSeconds + UserCacheSnapshotIntervalSeconds;
+
+		// A snapshot written for another namespace or environment is discarded, and replaced on the next save
+		const FString FilePath = SnapshotFilePath;
+		const FString Namespace = AccelByte::FRegistry::Settings.Namespace;
+		const FString BaseUrl = AccelByte::FRegistry::Settings.BaseUrl;
+		SnapshotLoadFuture = Async(EAsyncExecution::ThreadPool, [this, FilePath, Namespace, BaseUrl]()
+		{
+			TArray<FAccelByteUserInfoRef> RestoredUsers;
+			int32 CorruptRecordCount = 0;
+			if (!FAccelByteUserCacheSnapshot::LoadFromFile(FilePath, Namespace, BaseUrl, RestoredUsers, CorruptRecordCount))
+			{
+				UE_LOG_AB(Verbose, TEXT("No valid user cache snapshot for namespace '%s' at '%s' found at '%s', starting with an empty cache."), *Namespace, *BaseUrl, *FilePath);
+				return;
+			}
 
-	TMap<FString, FAccelByteUserInfoRef> FilteredUserMap;
-	FilteredUserMap.Reserve(AccelByteIdToUserInfoMap.Num());
-	for (const TPair<FString, FAccelByteUserInfoRef>& UserIdToUserInfo : AccelByteIdToUserInfoMap)
+			const int32 RestoredCount = RestoreUsersToCache(RestoredUsers);
+			UE_LOG_AB(Log, TEXT("Restored %d of %d users from the user cache snapshot, skipped %d corrupt records."), RestoredCount, RestoredUsers.Num(), CorruptRecordCount);
+		});
+		return;
+	}
+
+	if (UserCacheSnapshotIntervalSeconds <= 0 || CurrentTimeInSeconds < NextSnapshotSaveTimeInSeconds)
 	{
-		const double ElapsedTimeInSeconds = CurrentTimeInSeconds - UserIdToUserInfo.Value->LastAccessedTimeInSeconds;
-		if (ElapsedTimeInSeconds >= UserCachePurgeTimeoutSeconds && !UserIdToUserInfo.Value->bIsImportant)
+		return;
+	}
+
+	// Writing before the load is done would replace the snapshot with only the users of this session
+	if (!SnapshotLoadFuture.IsReady() || (SnapshotSaveFuture.IsValid() && !SnapshotSaveFuture.IsReady()))
+	{
+		return;
+	}
+
+	NextSnapshotSaveTimeInSeconds = CurrentTimeInSeconds + UserCacheSnapshotIntervalSeconds;
+
+	// Only encoding the users happens on this thread, one shard lock at a time, the file is written in the background
+	TSharedRef<FAccelByteUserCacheSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FAccelByteUserCacheSnapshot, ESPMode::ThreadSafe>(AccelByte::FRegistry::Settings.Namespace, AccelByte::FRegistry::Settings.BaseUrl);
+	BuildSnapshot(Snapshot.Get());
+
+	const FString FilePath = SnapshotFilePath;
+	SnapshotSaveFuture = Async(EAsyncExecution::ThreadPool, [Snapshot, FilePath]()
+	{
+		TArray<uint8> Bytes;
+		Snapshot->Serialize(Bytes);
+		if (!FAccelByteUserCacheSnapshot::SaveToFile(FilePath, Bytes))
 		{
-			FilteredUserMap.Add(UserIdToUserInfo);
+			UE_LOG_AB(Warning, TEXT("Failed to write the user cache snapshot to '%s'."), *FilePath);
 		}
+	});
+}
+
+bool FOnlineUserCacheAccelByte::SaveSnapshot()
+{
+	// If the snapshot was never loaded this session, the one on disk is still the most complete one that we have
+	if (SnapshotFilePath.IsEmpty() || !bHasStartedSnapshotLoad)
+	{
+		return false;
 	}
-	
-	int32 ItemsPurged = 0;
 
-	// Now iterate through the users that we got back from the filter and remove them from the real maps
-	for (const TPair<FString, FAccelByteUserInfoRef>& UserIdToUserInfo : FilteredUserMap)
+	if (SnapshotLoadFuture.IsValid())
+	{
+		SnapshotLoadFuture.Wait();
+	}
+
+	if (SnapshotSaveFuture.IsValid())
+	{
+		SnapshotSaveFuture.Wait();
+	}
+
+	FAccelByteUserCacheSnapshot Snapshot(AccelByte::FRegistry::Settings.Namespace, AccelByte::FRegistry::Settings.BaseUrl);
+	BuildSnapshot(Snapshot);
+
+	TArray<uint8> Bytes;
+	Snapshot.Serialize(Bytes);
+	if (!FAccelByteUserCacheSnapshot::SaveToFile(SnapshotFilePath, Bytes))
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to write the user cache snapshot to '%s'."), *SnapshotFilePath);
+		return false;
+	}
+
+	UE_LOG_AB(Verbose, TEXT("Wrote %d users to the user cache snapshot at '%s'."), Snapshot.GetUserCount(), *SnapshotFilePath);
+	return true;
+}
+
+int32 FOnlineUserCacheAccelByte::RestoreUsersToCache(const TArray<FAccelByteUserInfoRef>& RestoredUsers)
+{
+	const FDateTime Now = FDateTime::UtcNow();
+	const int32 ShardCapacity = (MaxCachedUserCount > 0) ? FMath::DivideAndRoundUp(MaxCachedUserCount, ACCELBYTE_USER_CACHE_SHARD_COUNT) : 0;
+
+	int32 RestoredCount = 0;
+	for (const FAccelByteUserInfoRef& User : RestoredUsers)
 	{
-		// Remove the user from the AccelByte ID cache map
-		TSharedPtr<const FAccelByteUserInfo, ESPMode::ThreadSafe> UserInfo = UserIdToUserInfo.Value;
-		AccelByteIdToUserInfoMap.Remove(UserIdToUserInfo.Key);
+		if (!User->Id.IsValid() || !IsSnapshotUserFresh(User.Get(), Now))
+		{
+			continue;
+		}
 
-		// Check if the user has a platform ID, if so format it and remove them from the platform cache
-		if (UserInfo->Id.IsValid() && UserInfo->Id->HasPlatformInformation())
+		const FString& AccelByteId = User->Id->GetAccelByteId();
 		{
-			const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserInfo->Id->GetPlatformType(), UserInfo->Id->GetPlatformId());
-			PlatformIdToUserInfoMap.Remove(PlatformId);
+			FUserCacheShard& Shard = AccelByteIdShards[GetShardIndex(AccelByteId)];
+			FScopeLock ScopeLock(&Shard.Lock);
+
+			// A user already in the cache was queried during this session, which is always more recent than the snapshot,
+			// and users from this session are never evicted to make room for restored ones
+			if (Shard.UserInfoMap.Contains(AccelByteId) || (ShardCapacity > 0 && Shard.UserInfoMap.Num() >= ShardCapacity))
+			{
+				continue;
+			}
+
+			User->bIsImportant = false;
+			Shard.UserInfoMap.Emplace(AccelByteId, User);
+			TouchUserInShard(Shard, User.Get());
 		}
 
-		ItemsPurged++;
+		if (User->Id->HasPlatformInformation())
+		{
+			const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(User->Id->GetPlatformType(), User->Id->GetPlatformId());
+			FUserCacheShard& Shard = PlatformIdShards[GetShardIndex(PlatformId)];
+			FScopeLock ScopeLock(&Shard.Lock);
+			if (!Shard.UserInfoMap.Contains(PlatformId))
+			{
+				Shard.UserInfoMap.Emplace(PlatformId, User);
+			}
+		}
+
+		RestoredCount++;
 	}
 
-	return ItemsPurged;
+	return RestoredCount;
 }
 
-bool FOnlineUserCacheAccelByte::IsUserCached(const FAccelByteUniqueIdComposite& Id)
+int32 FOnlineUserCacheAccelByte::GetMaxParallelUserQueryChunks() const
+{
+	return MaxParallelUserQueryChunks;
+}
+
+void FOnlineUserCacheAccelByte::SetMaxParallelUserQueryChunks(int32 InMaxParallelUserQueryChunks)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
+	MaxParallelUserQueryChunks = FMath::Max(InMaxParallelUserQueryChunks, 1);
+}
 
+bool FOnlineUserCacheAccelByte::IsUserCached(const FAccelByteUniqueIdComposite& Id)
+{
 	// Start by checking the cache for the user associated with the AccelByte ID, if we have one to query
 	if (!Id.Id.IsEmpty())
 	{
-		return AccelByteIdToUserInfoMap.Contains(Id.Id);
+		return FindInShards(AccelByteIdShards, Id.Id).IsValid();
 	}
 
 	// Next, if we didn't already find the user using the AccelByte ID, and we have platform type and ID try and query by that
 	if (!Id.PlatformType.IsEmpty() && !Id.PlatformId.IsEmpty())
 	{
 		const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(Id.PlatformType, Id.PlatformId);
-		return PlatformIdToUserInfoMap.Contains(PlatformId);
+		return FindInShards(PlatformIdShards, PlatformId).IsValid();
 	}
 
 	return false;
@@ -289,17 +575,28 @@ bool FOnlineUserCacheAccelByte::IsUserCached(const FAccelByteUniqueIdComposite&
 
 void FOnlineUserCacheAccelByte::GetQueryAndCacheArrays(const TArray<FString>& AccelByteIds, TArray<FString>& UsersToQuery, TArray<FAccelByteUserInfoRef>& UsersInCache)
 {
+	const double CurrentTimeInSeconds = FPlatformTime::Seconds();
 	for (const FString& AccelByteId : AccelByteIds)
 	{
-		const FAccelByteUserInfoRef* FoundCachedUser = AccelByteIdToUserInfoMap.Find(AccelByteId);
-		if (FoundCachedUser != nullptr)
+		// IDs that recently had no user are left out entirely, so the query completes without them
+		if (NegativeUserCacheTimeSeconds > 0)
+		{
+			FScopeLock ScopeLock(&NegativeCacheLock);
+			if (IsNegativeCachedLocked(AccelByteId, CurrentTimeInSeconds))
+			{
+				continue;
+			}
+		}
+
+		const FAccelByteUserInfoPtr FoundCachedUser = FindInShards(AccelByteIdShards, AccelByteId);
+		if (FoundCachedUser.IsValid())
 		{
 			// We have found a user in our cache, check if their data is stale
-			const bool bIsStale = bEnableStalenessChecking && IsUserDataStale(*(*FoundCachedUser)->Id.Get());
+			const bool bIsStale = bEnableStalenessChecking && IsUserDataStale(*FoundCachedUser->Id.Get());
 			if (!bIsStale)
 			{
 				// Data is not stale, return this user as a cached user and continue to next ID to check
-				UsersInCache.Add(*FoundCachedUser);
+				UsersInCache.Add(FoundCachedUser.ToSharedRef());
 				continue;
 			}
 
@@ -311,6 +608,54 @@ void FOnlineUserCacheAccelByte::GetQueryAndCacheArrays(const TArray<FString>& Ac
 	}
 }
 
+void FOnlineUserCacheAccelByte::AddAccelByteIdsToNegativeCache(const TArray<FString>& AccelByteIds)
+{
+	AddKeysToNegativeCache(AccelByteIds);
+}
+
+void FOnlineUserCacheAccelByte::AddPlatformIdsToNegativeCache(const FString& PlatformType, const TArray<FString>& PlatformIds)
+{
+	TArray<FString> Keys;
+	Keys.Reserve(PlatformIds.Num());
+	for (const FString& PlatformId : PlatformIds)
+	{
+		Keys.Add(ConvertPlatformTypeAndIdToCacheKey(PlatformType, PlatformId));
+	}
+
+	AddKeysToNegativeCache(Keys);
+}
+
+int32 FOnlineUserCacheAccelByte::RemoveNegativeCachedPlatformIds(const FString& PlatformType, TArray<FString>& PlatformIds)
+{
+	if (NegativeUserCacheTimeSeconds <= 0)
+	{
+		return 0;
+	}
+
+	const double CurrentTimeInSeconds = FPlatformTime::Seconds();
+	FScopeLock ScopeLock(&NegativeCacheLock);
+	if (NegativeCacheExpiryTimes.Num() <= 0)
+	{
+		return 0;
+	}
+
+	return PlatformIds.RemoveAll([this, &PlatformType, CurrentTimeInSeconds](const FString& PlatformId)
+	{
+		return IsNegativeCachedLocked(ConvertPlatformTypeAndIdToCacheKey(PlatformType, PlatformId), CurrentTimeInSeconds);
+	});
+}
+
+int32 FOnlineUserCacheAccelByte::GetNegativeCachedUserCount()
+{
+	FScopeLock ScopeLock(&NegativeCacheLock);
+	return NegativeCacheExpiryTimes.Num();
+}
+
+void FOnlineUserCacheAccelByte::SetNegativeUserCacheTimeSeconds(int32 InNegativeUserCacheTimeSeconds)
+{
+	NegativeUserCacheTimeSeconds = InNegativeUserCacheTimeSeconds;
+}
+
 bool FOnlineUserCacheAccelByte::QueryUsersByAccelByteIds(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant/*=false*/)
 {
 	if (!FOnlineSubsystemAccelByteUtils::IsValidLocalUserNum(LocalUserNum))
@@ -331,18 +676,7 @@ bool FOnlineUserCacheAccelByte::QueryUsersByAccelByteIds(int32 LocalUserNum, con
 		return false;
 	}
 
-	FOnlineUserAccelBytePtr UserInterface = StaticCastSharedPtr<FOnlineUserAccelByte>(Subsystem->GetUserInterface());
-	if (!UserInterface.IsValid())
-	{
-		UE_LOG_AB(Warning, TEXT("FOnlineUserStoreAccelByte::QueryUsersByAccelByteIds UserInterface is invalid, skipping this call!"));
-		Delegate.ExecuteIfBound(true, TArray<FAccelByteUserInfoRef>());
-		return false;
-	}
-
-	//Run QueryUserProfile after QueryUsersByIds to get Info like FriendId
-	Subsystem->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, LocalUserNum, FilteredIds, bIsImportant, Delegate);
-	Subsystem->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteQueryUserProfile>(Subsystem, LocalUserNum, FilteredIds, UserInterface->OnQueryUserProfileCompleteDelegates[LocalUserNum]);
-	return true;
+	return QueueUsersQuery(LocalUserNum, FilteredIds, Delegate, bIsImportant);
 }
 
 bool FOnlineUserCacheAccelByte::QueryUsersByPlatformIds(int32 LocalUserNum, const FString& PlatformType, const TArray<FString>& PlatformIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant /*= false*/)
@@ -386,27 +720,178 @@ bool FOnlineUserCacheAccelByte::QueryUsersByAccelByteIds(const FUniqueNetId& Use
 		return false;
 	}
 	
-	FOnlineUserAccelBytePtr UserInterface = StaticCastSharedPtr<FOnlineUserAccelByte>(Subsystem->GetUserInterface());
-	if (!UserInterface.IsValid())
+	int32 LocalUserNum = INVALID_CONTROLLERID;
+	const bool bLocalUserNumFound = IdentityInterface->GetLocalUserNum(UserId, LocalUserNum);
+
+	if (!bLocalUserNumFound || !FOnlineSubsystemAccelByteUtils::IsValidLocalUserNum(LocalUserNum))
 	{
-		UE_LOG_AB(Warning, TEXT("FOnlineUserStoreAccelByte::QueryUsersByAccelByteIds UserInterface is invalid, skipping this call!"));
+		UE_LOG_AB(Warning, TEXT("FOnlineUserStoreAccelByte::QueryUsersByAccelByteIds LocalUserNum is invalid, skipping this call!"));
 		Delegate.ExecuteIfBound(true, TArray<FAccelByteUserInfoRef>());
 		return false;
 	}
 
-	int32 LocalUserNum = INVALID_CONTROLLERID;
-	const bool bLocalUserNumFound = IdentityInterface->GetLocalUserNum(UserId, LocalUserNum);
+	// Queries from a user ID are batched together with queries from the matching local user index, the tasks resolve
+	// the user ID again from the index once dispatched
+	return QueueUsersQuery(LocalUserNum, FilteredIds, Delegate, bIsImportant);
+}
 
-	if (!bLocalUserNumFound || !FOnlineSubsystemAccelByteUtils::IsValidLocalUserNum(LocalUserNum))
+bool FOnlineUserCacheAccelByte::QueueUsersQuery(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant)
+{
+	if (!bEnableUserQueryBatching || bIsImportant)
 	{
-		UE_LOG_AB(Warning, TEXT("FOnlineUserStoreAccelByte::QueryUsersByAccelByteIds LocalUserNum is invalid, skipping this call!"));
+		return DispatchUsersQuery(LocalUserNum, AccelByteIds, Delegate, bIsImportant);
+	}
+
+	{
+		// Queries made from within a task's critical section have to be dispatched right away, as the epic and parent
+		// task set for them are gone by the time the ticker flushes the batch
+		FScopeLock ParentLock(Subsystem->GetUpcomingParentTaskLock());
+		FScopeLock EpicLock(Subsystem->GetEpicTaskLock());
+		if (Subsystem->IsUpcomingParentTaskAlreadySet() || Subsystem->IsUpcomingEpicAlreadySet())
+		{
+			return DispatchUsersQuery(LocalUserNum, AccelByteIds, Delegate, bIsImportant);
+		}
+	}
+
+	FScopeLock ScopeLock(&PendingUserQueryLock);
+
+	FPendingUserQueryBatch* Batch = PendingUserQueryBatches.FindByPredicate([LocalUserNum](const FPendingUserQueryBatch& Candidate)
+	{
+		return Candidate.LocalUserNum == LocalUserNum;
+	});
+
+	if (Batch == nullptr)
+	{
+		Batch = &PendingUserQueryBatches.AddDefaulted_GetRef();
+		Batch->LocalUserNum = LocalUserNum;
+		Batch->FirstQueuedTimeInSeconds = FPlatformTime::Seconds();
+	}
+
+	FPendingUserQuery& Query = Batch->Queries.AddDefaulted_GetRef();
+	Query.Delegate = Delegate;
+	Query.AccelByteIds.Reserve(AccelByteIds.Num());
+	for (const FString& AccelByteId : AccelByteIds)
+	{
+		Query.AccelByteIds.Add(AccelByteId);
+
+		bool bIsAlreadyInBatch = false;
+		Batch->AccelByteIdSet.Add(AccelByteId, &bIsAlreadyInBatch);
+		if (!bIsAlreadyInBatch)
+		{
+			Batch->AccelByteIds.Add(AccelByteId);
+		}
+	}
+
+	return true;
+}
+
+int32 FOnlineUserCacheAccelByte::FlushPendingUserQueries(bool bForce /*= false*/)
+{
+	// Take the batches that are ready out of the pending list first, so that dispatching happens without holding the lock
+	TArray<FPendingUserQueryBatch> ReadyBatches;
+	{
+		FScopeLock ScopeLock(&PendingUserQueryLock);
+		if (PendingUserQueryBatches.Num() <= 0)
+		{
+			return 0;
+		}
+
+		const double CurrentTimeInSeconds = FPlatformTime::Seconds();
+		const double WindowSeconds = UserQueryBatchWindowMilliseconds / 1000.0;
+		for (int32 Index = PendingUserQueryBatches.Num() - 1; Index >= 0; Index--)
+		{
+			if (bForce || CurrentTimeInSeconds - PendingUserQueryBatches[Index].FirstQueuedTimeInSeconds >= WindowSeconds)
+			{
+				ReadyBatches.Add(MoveTemp(PendingUserQueryBatches[Index]));
+				PendingUserQueryBatches.RemoveAtSwap(Index);
+			}
+		}
+	}
+
+	int32 QueryCount = 0;
+	for (FPendingUserQueryBatch& Batch : ReadyBatches)
+	{
+		QueryCount += Batch.Queries.Num();
+		UE_LOG_AB(Verbose, TEXT("Merged %d user queries for local user %d into a single query for %d unique IDs."), Batch.Queries.Num(), Batch.LocalUserNum, Batch.AccelByteIds.Num());
+
+		// A batch of a single query can just hand its delegate straight to the task
+		if (Batch.Queries.Num() == 1)
+		{
+			DispatchUsersQuery(Batch.LocalUserNum, Batch.AccelByteIds, Batch.Queries[0].Delegate, false);
+			continue;
+		}
+
+		// Otherwise, fan the users out to every query, only handing each one the users that it asked for
+		const FOnQueryUsersComplete FanOutDelegate = FOnQueryUsersComplete::CreateLambda([Queries = MoveTemp(Batch.Queries)](bool bIsSuccessful, TArray<FAccelByteUserInfoRef> UsersQueried)
+		{
+			for (const FPendingUserQuery& Query : Queries)
+			{
+				TArray<FAccelByteUserInfoRef> QueryUsers;
+				QueryUsers.Reserve(Query.AccelByteIds.Num());
+				for (const FAccelByteUserInfoRef& User : UsersQueried)
+				{
+					if (User->Id.IsValid() && Query.AccelByteIds.Contains(User->Id->GetAccelByteId()))
+					{
+						QueryUsers.Add(User);
+					}
+				}
+
+				Query.Delegate.ExecuteIfBound(bIsSuccessful, QueryUsers);
+			}
+		});
+
+		DispatchUsersQuery(Batch.LocalUserNum, Batch.AccelByteIds, FanOutDelegate, false);
+	}
+
+	return QueryCount;
+}
+
+int32 FOnlineUserCacheAccelByte::FailPendingUserQueries(int32 LocalUserNum /*= INVALID_CONTROLLERID*/)
+{
+	TArray<FPendingUserQueryBatch> FailedBatches;
+	{
+		FScopeLock ScopeLock(&PendingUserQueryLock);
+		for (int32 Index = PendingUserQueryBatches.Num() - 1; Index >= 0; Index--)
+		{
+			if (LocalUserNum == INVALID_CONTROLLERID || PendingUserQueryBatches[Index].LocalUserNum == LocalUserNum)
+			{
+				FailedBatches.Add(MoveTemp(PendingUserQueryBatches[Index]));
+				PendingUserQueryBatches.RemoveAtSwap(Index);
+			}
+		}
+	}
+
+	int32 QueryCount = 0;
+	for (const FPendingUserQueryBatch& Batch : FailedBatches)
+	{
+		QueryCount += Batch.Queries.Num();
+		for (const FPendingUserQuery& Query : Batch.Queries)
+		{
+			Query.Delegate.ExecuteIfBound(false, TArray<FAccelByteUserInfoRef>());
+		}
+	}
+
+	if (QueryCount > 0)
+	{
+		UE_LOG_AB(Verbose, TEXT("Failed %d user queries that were still waiting to be batched."), QueryCount);
+	}
+
+	return QueryCount;
+}
+
+bool FOnlineUserCacheAccelByte::DispatchUsersQuery(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant)
+{
+	FOnlineUserAccelBytePtr UserInterface = StaticCastSharedPtr<FOnlineUserAccelByte>(Subsystem->GetUserInterface());
+	if (!UserInterface.IsValid())
+	{
+		UE_LOG_AB(Warning, TEXT("FOnlineUserStoreAccelByte::QueryUsersByAccelByteIds UserInterface is invalid, skipping this call!"));
 		Delegate.ExecuteIfBound(true, TArray<FAccelByteUserInfoRef>());
 		return false;
 	}
-	
+
 	//Run QueryUserProfile after QueryUsersByIds to get Info like FriendId
-	Subsystem->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, UserId, FilteredIds, bIsImportant, Delegate);
-	Subsystem->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteQueryUserProfile>(Subsystem, UserId, FilteredIds, UserInterface->OnQueryUserProfileCompleteDelegates[LocalUserNum]);
+	Subsystem->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, LocalUserNum, AccelByteIds, bIsImportant, Delegate);
+	Subsystem->CreateAndDispatchAsyncTaskSerial<FOnlineAsyncTaskAccelByteQueryUserProfile>(Subsystem, LocalUserNum, AccelByteIds, UserInterface->OnQueryUserProfileCompleteDelegates[LocalUserNum]);
 	return true;
 }
 
@@ -432,9 +917,6 @@ bool FOnlineUserCacheAccelByte::QueryUsersByPlatformIds(const FUniqueNetId& User
 
 TSharedPtr<const FAccelByteUserInfo, ESPMode::ThreadSafe> FOnlineUserCacheAccelByte::GetUser(const FUniqueNetId& UserId)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
-
 	// If this unique ID is an AccelByte composite ID already, then forward to the GetUser using the composite structure
 	if (UserId.GetType() == ACCELBYTE_USER_ID_TYPE)
 	{
@@ -444,11 +926,11 @@ TSharedPtr<const FAccelByteUserInfo, ESPMode::ThreadSafe> FOnlineUserCacheAccelB
 
 	// Otherwise, query as if it is a platform ID
 	const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.GetType().ToString(), UserId.ToString());
-	const FAccelByteUserInfoRef* FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
-	if (FoundUserInfo != nullptr)
+	const FAccelByteUserInfoPtr FoundUserInfo = FindInShards(PlatformIdShards, PlatformId);
+	if (FoundUserInfo.IsValid())
 	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		return *FoundUserInfo;
+		TouchUser(*FoundUserInfo);
+		return FoundUserInfo;
 	}
 
 	return nullptr;
@@ -456,34 +938,34 @@ TSharedPtr<const FAccelByteUserInfo, ESPMode::ThreadSafe> FOnlineUserCacheAccelB
 
 TSharedPtr<const FAccelByteUserInfo, ESPMode::ThreadSafe> FOnlineUserCacheAccelByte::GetUser(const FAccelByteUniqueIdComposite& UserId)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
-
-	// Start by checking the cache for the user associated with the AccelByte ID, if we have one to query
-	FAccelByteUserInfoRef* FoundUserInfo = nullptr;
+	// Start by checking the cache for the user associated with the AccelByte ID, if we have one to query. Looked up and
+	// touched under a single lock, as this is by far the most common lookup.
 	if (!UserId.Id.IsEmpty())
 	{
-		FoundUserInfo = AccelByteIdToUserInfoMap.Find(UserId.Id);
+		FUserCacheShard& Shard = AccelByteIdShards[GetShardIndex(UserId.Id)];
+
+		FScopeLock ScopeLock(&Shard.Lock);
+		const FAccelByteUserInfoRef* FoundUserInfo = Shard.UserInfoMap.Find(UserId.Id);
+		if (FoundUserInfo != nullptr)
+		{
+			TouchUserInShard(Shard, FoundUserInfo->Get());
+			return *FoundUserInfo;
+		}
 	}
 
 	// Next, if we didn't already find the user using the AccelByte ID, and we have platform type and ID try and query by that
-	if (FoundUserInfo == nullptr && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
+	if (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty())
 	{
 		const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.PlatformType, UserId.PlatformId);
-		FAccelByteUserInfoRef* FoundUserInfoTemp = PlatformIdToUserInfoMap.Find(PlatformId);
+		const FAccelByteUserInfoPtr FoundUserInfo = FindInShards(PlatformIdShards, PlatformId);
 		// Check if platform accelbyte id is match with composite user id. If the same then set the user info from platform cache
-		if (FoundUserInfoTemp && FoundUserInfoTemp->Get().Id->GetAccelByteId() == UserId.Id)
+		if (FoundUserInfo.IsValid() && FoundUserInfo->Id->GetAccelByteId() == UserId.Id)
 		{
-			FoundUserInfo = FoundUserInfoTemp;
+			TouchUser(*FoundUserInfo);
+			return FoundUserInfo;
 		}
 	}
 
-	if (FoundUserInfo != nullptr)
-	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		return *FoundUserInfo;
-	}
-
 	return nullptr;
 }
 
@@ -521,13 +1003,13 @@ bool FOnlineUserCacheAccelByte::SetUserDataAsStale(const FUniqueNetId& UserUniqu
 
 bool FOnlineUserCacheAccelByte::SetUserDataAsStale(const FString& InAccelByteId)
 {
-	const FAccelByteUserInfoRef* FoundCachedUser = AccelByteIdToUserInfoMap.Find(InAccelByteId);
-	if (FoundCachedUser == nullptr)
+	const FAccelByteUserInfoPtr FoundCachedUser = FindInShards(AccelByteIdShards, InAccelByteId);
+	if (!FoundCachedUser.IsValid())
 	{
 		return false;
 	}
 
-	(*FoundCachedUser)->bIsForcedStale = true;
+	FoundCachedUser->bIsForcedStale = true;
 	return true;
 }
 
@@ -545,22 +1027,26 @@ bool FOnlineUserCacheAccelByte::IsUserDataStale(const FUniqueNetId& UserUniqueId
 
 bool FOnlineUserCacheAccelByte::IsUserDataStale(const FString& InAccelByteId)
 {
-	const FAccelByteUserInfoRef* FoundCachedUser = AccelByteIdToUserInfoMap.Find(InAccelByteId);
-	if (FoundCachedUser == nullptr)
+	const FAccelByteUserInfoPtr FoundCachedUser = FindInShards(AccelByteIdShards, InAccelByteId);
+	if (!FoundCachedUser.IsValid())
 	{
 		return true;
 	}
 
-	if ((*FoundCachedUser)->bIsForcedStale)
+	if (FoundCachedUser->bIsForcedStale)
 	{
 		return true;
 	}
 
-	return ((*FoundCachedUser)->LastUpdatedTime + FTimespan::FromSeconds(GetTimeUntilStaleSeconds())) >= FDateTime::UtcNow();
+	return (FoundCachedUser->LastUpdatedTime + FTimespan::FromSeconds(GetTimeUntilStaleSeconds())) >= FDateTime::UtcNow();
 }
 
 void FOnlineUserCacheAccelByte::AddUsersToCache(const TArray<FAccelByteUserInfoRef>& UsersQueried)
 {
+	// Group the users by the shard that each of their keys land in, so that every shard is only locked once per batch
+	TArray<TPair<FString, FAccelByteUserInfoRef>> AccelByteIdEntriesByShard[ACCELBYTE_USER_CACHE_SHARD_COUNT];
+	TArray<TPair<FString, FAccelByteUserInfoRef>> PlatformIdEntriesByShard[ACCELBYTE_USER_CACHE_SHARD_COUNT];
+
 	for (const FAccelByteUserInfoRef& User : UsersQueried)
 	{
 		if (User->PublicCode.IsEmpty())
@@ -575,37 +1061,79 @@ void FOnlineUserCacheAccelByte::AddUsersToCache(const TArray<FAccelByteUserInfoR
 			}
 		}
 
-		// Add the user to the AccelByte ID mapping cache first
-		if (AccelByteIdToUserInfoMap.Find(User->Id->GetAccelByteId()))
-		{
-			AccelByteIdToUserInfoMap[User->Id->GetAccelByteId()]->CopyValue(User.Get());
-		}
-		else
-		{
-			AccelByteIdToUserInfoMap.Emplace(User->Id->GetAccelByteId(), User);
-		}
+		const FString& AccelByteId = User->Id->GetAccelByteId();
+		AccelByteIdEntriesByShard[GetShardIndex(AccelByteId)].Emplace(AccelByteId, User);
 
 		// Try and add the user to the platform mapping cache if they have platform information
 		if (User->Id->HasPlatformInformation())
 		{
 			const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(User->Id->GetPlatformType(), User->Id->GetPlatformId());
-			if (PlatformIdToUserInfoMap.Find(PlatformId))
+			PlatformIdEntriesByShard[GetShardIndex(PlatformId)].Emplace(PlatformId, User);
+		}
+	}
+
+	// Only the AccelByte ID shards track recency and enforce the cache limit, platform entries follow their users
+	const int32 ShardCapacity = (MaxCachedUserCount > 0) ? FMath::DivideAndRoundUp(MaxCachedUserCount, ACCELBYTE_USER_CACHE_SHARD_COUNT) : 0;
+	TArray<FAccelByteUserInfoRef> EvictedUsers;
+
+	const auto AddEntriesToShards = [ShardCapacity, &EvictedUsers](FUserCacheShard* Shards, TArray<TPair<FString, FAccelByteUserInfoRef>>* EntriesByShard, bool bIsAccelByteIdShard)
+	{
+		for (int32 ShardIndex = 0; ShardIndex < ACCELBYTE_USER_CACHE_SHARD_COUNT; ShardIndex++)
+		{
+			if (EntriesByShard[ShardIndex].Num() <= 0)
+			{
+				continue;
+			}
+
+			FUserCacheShard& Shard = Shards[ShardIndex];
+			FScopeLock ScopeLock(&Shard.Lock);
+			for (const TPair<FString, FAccelByteUserInfoRef>& Entry : EntriesByShard[ShardIndex])
 			{
-				PlatformIdToUserInfoMap[PlatformId]->CopyValue(User.Get());
+				FAccelByteUserInfoRef* FoundUserInfo = Shard.UserInfoMap.Find(Entry.Key);
+				if (FoundUserInfo == nullptr)
+				{
+					FoundUserInfo = &Shard.UserInfoMap.Emplace(Entry.Key, Entry.Value);
+
+					// A user freshly added to an AccelByte ID shard is not in any recency list yet, even if it was copied
+					// from one that was. Platform shards share their users with the AccelByte ID shards, so leave those be.
+					if (bIsAccelByteIdShard)
+					{
+						(*FoundUserInfo)->MoreRecentUser = nullptr;
+						(*FoundUserInfo)->LessRecentUser = nullptr;
+						(*FoundUserInfo)->bIsInRecencyList = false;
+					}
+				}
+				else
+				{
+					(*FoundUserInfo)->CopyValue(Entry.Value.Get());
+				}
+
+				if (bIsAccelByteIdShard)
+				{
+					TouchUserInShard(Shard, FoundUserInfo->Get());
+				}
 			}
-			else
+
+			if (bIsAccelByteIdShard && ShardCapacity > 0)
 			{
-				PlatformIdToUserInfoMap.Emplace(PlatformId, User);
+				while (Shard.UserInfoMap.Num() > ShardCapacity && Shard.LeastRecentUser != nullptr)
+				{
+					EvictLeastRecentUser(Shard, EvictedUsers);
+				}
 			}
 		}
-	}
+	};
+
+	// Add the users to the AccelByte ID mapping cache first
+	AddEntriesToShards(AccelByteIdShards, AccelByteIdEntriesByShard, true);
+	AddEntriesToShards(PlatformIdShards, PlatformIdEntriesByShard, false);
+
+	RemovePlatformEntries(EvictedUsers);
+	RemoveUsersFromNegativeCache(UsersQueried);
 }
 
 void FOnlineUserCacheAccelByte::AddPublicCodeToCache(const FUniqueNetId& UserId, const FString& PublicCode)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
-
 	// If this unique ID is an AccelByte composite ID already, then forward to the GetUser using the composite structure
 	if (UserId.GetType() == ACCELBYTE_USER_ID_TYPE)
 	{
@@ -616,11 +1144,11 @@ void FOnlineUserCacheAccelByte::AddPublicCodeToCache(const FUniqueNetId& UserId,
 
 	// Otherwise, query as if it is a platform ID
 	const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.GetType().ToString(), UserId.ToString());
-	const FAccelByteUserInfoRef* FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
-	if (FoundUserInfo != nullptr)
+	const FAccelByteUserInfoPtr FoundUserInfo = FindInShards(PlatformIdShards, PlatformId);
+	if (FoundUserInfo.IsValid())
 	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		FoundUserInfo->Get().PublicCode = PublicCode;
+		TouchUser(*FoundUserInfo);
+		FoundUserInfo->PublicCode = PublicCode;
 	}
 	else
 	{
@@ -635,27 +1163,24 @@ void FOnlineUserCacheAccelByte::AddPublicCodeToCache(const FUniqueNetId& UserId,
 
 void FOnlineUserCacheAccelByte::AddPublicCodeToCache(const FAccelByteUniqueIdComposite& UserId, const FString& PublicCode)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
-
 	// Start by checking the cache for the user associated with the AccelByte ID, if we have one to query
-	FAccelByteUserInfoRef* FoundUserInfo = nullptr;
+	FAccelByteUserInfoPtr FoundUserInfo = nullptr;
 	if (!UserId.Id.IsEmpty())
 	{
-		FoundUserInfo = AccelByteIdToUserInfoMap.Find(UserId.Id);
+		FoundUserInfo = FindInShards(AccelByteIdShards, UserId.Id);
 	}
 
 	// Next, if we didn't already find the user using the AccelByte ID, and we have platform type and ID try and query by that
-	if (FoundUserInfo == nullptr && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
+	if (!FoundUserInfo.IsValid() && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
 	{
 		const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.PlatformType, UserId.PlatformId);
-		FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
+		FoundUserInfo = FindInShards(PlatformIdShards, PlatformId);
 	}
 
-	if (FoundUserInfo != nullptr)
+	if (FoundUserInfo.IsValid())
 	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		FoundUserInfo->Get().PublicCode = PublicCode;
+		TouchUser(*FoundUserInfo);
+		FoundUserInfo->PublicCode = PublicCode;
 	}
 	else
 	{
@@ -669,9 +1194,6 @@ void FOnlineUserCacheAccelByte::AddPublicCodeToCache(const FAccelByteUniqueIdCom
 
 void FOnlineUserCacheAccelByte::AddLinkedPlatformInfoToCache(const FUniqueNetId& UserId, const TArray<FAccelByteLinkedUserInfo>& LinkedPlatformInfo)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
-
 	// If this unique ID is an AccelByte composite ID already, then forward to the GetUser using the composite structure
 	if (UserId.GetType() == ACCELBYTE_USER_ID_TYPE)
 	{
@@ -682,11 +1204,11 @@ void FOnlineUserCacheAccelByte::AddLinkedPlatformInfoToCache(const FUniqueNetId&
 
 	// Otherwise, query as if it is a platform ID
 	const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.GetType().ToString(), UserId.ToString());
-	const FAccelByteUserInfoRef* FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
-	if (FoundUserInfo != nullptr)
+	const FAccelByteUserInfoPtr FoundUserInfo = FindInShards(PlatformIdShards, PlatformId);
+	if (FoundUserInfo.IsValid())
 	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		FoundUserInfo->Get().LinkedPlatformInfo = LinkedPlatformInfo;
+		TouchUser(*FoundUserInfo);
+		FoundUserInfo->LinkedPlatformInfo = LinkedPlatformInfo;
 	}
 	else
 	{
@@ -701,27 +1223,24 @@ void FOnlineUserCacheAccelByte::AddLinkedPlatformInfoToCache(const FUniqueNetId&
 
 void FOnlineUserCacheAccelByte::AddLinkedPlatformInfoToCache(const FAccelByteUniqueIdComposite& UserId, const TArray<FAccelByteLinkedUserInfo>& LinkedPlatformInfo)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
-
 	// Start by checking the cache for the user associated with the AccelByte ID, if we have one to query
-	FAccelByteUserInfoRef* FoundUserInfo = nullptr;
+	FAccelByteUserInfoPtr FoundUserInfo = nullptr;
 	if (!UserId.Id.IsEmpty())
 	{
-		FoundUserInfo = AccelByteIdToUserInfoMap.Find(UserId.Id);
+		FoundUserInfo = FindInShards(AccelByteIdShards, UserId.Id);
 	}
 
 	// Next, if we didn't already find the user using the AccelByte ID, and we have platform type and ID try and query by that
-	if (FoundUserInfo == nullptr && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
+	if (!FoundUserInfo.IsValid() && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
 	{
 		const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.PlatformType, UserId.PlatformId);
-		FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
+		FoundUserInfo = FindInShards(PlatformIdShards, PlatformId);
 	}
 
-	if (FoundUserInfo != nullptr)
+	if (FoundUserInfo.IsValid())
 	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		FoundUserInfo->Get().LinkedPlatformInfo = LinkedPlatformInfo;
+		TouchUser(*FoundUserInfo);
+		FoundUserInfo->LinkedPlatformInfo = LinkedPlatformInfo;
 	}
 	else
 	{
@@ -739,6 +1258,259 @@ FString FOnlineUserCacheAccelByte::ConvertPlatformTypeAndIdToCacheKey(const FStr
 	return PlatformId;
 }
 
+int32 FOnlineUserCacheAccelByte::GetShardIndex(const FString& Key)
+{
+	static_assert((ACCELBYTE_USER_CACHE_SHARD_COUNT & (ACCELBYTE_USER_CACHE_SHARD_COUNT - 1)) == 0, "ACCELBYTE_USER_CACHE_SHARD_COUNT must be a power of two");
+
+	// Fold the upper bits in before masking, so that the whole hash contributes to the choice of shard
+	const uint32 Hash = GetTypeHash(Key);
+	return static_cast<int32>((Hash ^ (Hash >> 16)) & (ACCELBYTE_USER_CACHE_SHARD_COUNT - 1));
+}
+
+FAccelByteUserInfoPtr FOnlineUserCacheAccelByte::FindInShards(FUserCacheShard* Shards, const FString& Key)
+{
+	FUserCacheShard& Shard = Shards[GetShardIndex(Key)];
+
+	FScopeLock ScopeLock(&Shard.Lock);
+	const FAccelByteUserInfoRef* FoundUserInfo = Shard.UserInfoMap.Find(Key);
+	if (FoundUserInfo == nullptr)
+	{
+		return nullptr;
+	}
+
+	return *FoundUserInfo;
+}
+
+void FOnlineUserCacheAccelByte::TouchUser(FAccelByteUserInfo& UserInfo)
+{
+	if (!UserInfo.Id.IsValid())
+	{
+		UserInfo.LastAccessedTimeInSeconds = FPlatformTime::Seconds();
+		return;
+	}
+
+	const FString& AccelByteId = UserInfo.Id->GetAccelByteId();
+	FUserCacheShard& Shard = AccelByteIdShards[GetShardIndex(AccelByteId)];
+
+	FScopeLock ScopeLock(&Shard.Lock);
+
+	// Users found through the platform shards may be a separate instance from the one held by the AccelByte ID shard
+	const FAccelByteUserInfoRef* HeldUserInfo = Shard.UserInfoMap.Find(AccelByteId);
+	if (HeldUserInfo != nullptr && &HeldUserInfo->Get() == &UserInfo)
+	{
+		TouchUserInShard(Shard, UserInfo);
+	}
+	else
+	{
+		UserInfo.LastAccessedTimeInSeconds = FPlatformTime::Seconds();
+	}
+}
+
+void FOnlineUserCacheAccelByte::TouchUserInShard(FUserCacheShard& Shard, FAccelByteUserInfo& UserInfo)
+{
+	// Read the time while holding the lock, so that the recency list stays ordered by last access
+	UserInfo.LastAccessedTimeInSeconds = FPlatformTime::Seconds();
+
+	UnlinkFromRecencyList(Shard, UserInfo);
+	if (UserInfo.bIsImportant)
+	{
+		return;
+	}
+
+	UserInfo.LessRecentUser = Shard.MostRecentUser;
+	UserInfo.MoreRecentUser = nullptr;
+	if (Shard.MostRecentUser != nullptr)
+	{
+		Shard.MostRecentUser->MoreRecentUser = &UserInfo;
+	}
+	else
+	{
+		Shard.LeastRecentUser = &UserInfo;
+	}
+	Shard.MostRecentUser = &UserInfo;
+	UserInfo.bIsInRecencyList = true;
+}
+
+void FOnlineUserCacheAccelByte::UnlinkFromRecencyList(FUserCacheShard& Shard, FAccelByteUserInfo& UserInfo)
+{
+	if (!UserInfo.bIsInRecencyList)
+	{
+		return;
+	}
+
+	if (UserInfo.MoreRecentUser != nullptr)
+	{
+		UserInfo.MoreRecentUser->LessRecentUser = UserInfo.LessRecentUser;
+	}
+	else
+	{
+		Shard.MostRecentUser = UserInfo.LessRecentUser;
+	}
+
+	if (UserInfo.LessRecentUser != nullptr)
+	{
+		UserInfo.LessRecentUser->MoreRecentUser = UserInfo.MoreRecentUser;
+	}
+	else
+	{
+		Shard.LeastRecentUser = UserInfo.MoreRecentUser;
+	}
+
+	UserInfo.MoreRecentUser = nullptr;
+	UserInfo.LessRecentUser = nullptr;
+	UserInfo.bIsInRecencyList = false;
+}
+
+void FOnlineUserCacheAccelByte::EvictLeastRecentUser(FUserCacheShard& Shard, TArray<FAccelByteUserInfoRef>& OutEvictedUsers)
+{
+	FAccelByteUserInfo* UserInfo = Shard.LeastRecentUser;
+	check(UserInfo != nullptr);
+
+	UnlinkFromRecencyList(Shard, *UserInfo);
+
+	// A user may have been marked as important through a platform shard since they were last touched, in which case
+	// they only leave the recency list
+	if (UserInfo->bIsImportant)
+	{
+		return;
+	}
+
+	// Copy the key, as the ID is owned by the user that is being removed
+	const FString AccelByteId = UserInfo->Id->GetAccelByteId();
+	const FAccelByteUserInfoRef* HeldUserInfo = Shard.UserInfoMap.Find(AccelByteId);
+	if (HeldUserInfo != nullptr)
+	{
+		OutEvictedUsers.Add(*HeldUserInfo);
+		Shard.UserInfoMap.Remove(AccelByteId);
+	}
+}
+
+bool FOnlineUserCacheAccelByte::IsSnapshotUserFresh(const FAccelByteUserInfo& UserInfo, const FDateTime& Now) const
+{
+	if (UserInfo.bIsForcedStale)
+	{
+		return false;
+	}
+
+	return !bEnableStalenessChecking || (UserInfo.LastUpdatedTime + FTimespan::FromSeconds(TimeUntilStaleSeconds)) > Now;
+}
+
+void FOnlineUserCacheAccelByte::BuildSnapshot(FAccelByteUserCacheSnapshot& OutSnapshot)
+{
+	const FDateTime Now = FDateTime::UtcNow();
+	for (FUserCacheShard& Shard : AccelByteIdShards)
+	{
+		FScopeLock ScopeLock(&Shard.Lock);
+		for (const TPair<FString, FAccelByteUserInfoRef>& Entry : Shard.UserInfoMap)
+		{
+			if (IsSnapshotUserFresh(Entry.Value.Get(), Now))
+			{
+				OutSnapshot.AddUser(Entry.Value.Get());
+			}
+		}
+	}
+}
+
+void FOnlineUserCacheAccelByte::AddKeysToNegativeCache(const TArray<FString>& Keys)
+{
+	if (NegativeUserCacheTimeSeconds <= 0 || Keys.Num() <= 0)
+	{
+		return;
+	}
+
+	const double CurrentTimeInSeconds = FPlatformTime::Seconds();
+	const double ExpiryTimeInSeconds = CurrentTimeInSeconds + NegativeUserCacheTimeSeconds;
+
+	FScopeLock ScopeLock(&NegativeCacheLock);
+	if (NegativeCacheExpiryTimes.Num() + Keys.Num() > MaxNegativeCachedUserCount)
+	{
+		for (auto It = NegativeCacheExpiryTimes.CreateIterator(); It; ++It)
+		{
+			if (It.Value() <= CurrentTimeInSeconds)
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		// Still full, drop the IDs that expire soonest down to three quarters of the limit, so that the next few
+		// additions do not have to go through the whole map again
+		const int32 TargetCount = FMath::Max((MaxNegativeCachedUserCount * 3) / 4 - Keys.Num(), 0);
+		if (NegativeCacheExpiryTimes.Num() > TargetCount)
+		{
+			NegativeCacheExpiryTimes.ValueSort(TLess<double>());
+
+			int32 RemoveCount = NegativeCacheExpiryTimes.Num() - TargetCount;
+			for (auto It = NegativeCacheExpiryTimes.CreateIterator(); It && RemoveCount > 0; ++It, --RemoveCount)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	for (const FString& Key : Keys)
+	{
+		NegativeCacheExpiryTimes.Add(Key, ExpiryTimeInSeconds);
+	}
+}
+
+bool FOnlineUserCacheAccelByte::IsNegativeCachedLocked(const FString& Key, double CurrentTimeInSeconds)
+{
+	const double* FoundExpiryTime = NegativeCacheExpiryTimes.Find(Key);
+	if (FoundExpiryTime == nullptr)
+	{
+		return false;
+	}
+
+	if (*FoundExpiryTime <= CurrentTimeInSeconds)
+	{
+		NegativeCacheExpiryTimes.Remove(Key);
+		return false;
+	}
+
+	return true;
+}
+
+void FOnlineUserCacheAccelByte::RemoveUsersFromNegativeCache(const TArray<FAccelByteUserInfoRef>& Users)
+{
+	FScopeLock ScopeLock(&NegativeCacheLock);
+	if (NegativeCacheExpiryTimes.Num() <= 0)
+	{
+		return;
+	}
+
+	for (const FAccelByteUserInfoRef& User : Users)
+	{
+		NegativeCacheExpiryTimes.Remove(User->Id->GetAccelByteId());
+		if (User->Id->HasPlatformInformation())
+		{
+			NegativeCacheExpiryTimes.Remove(ConvertPlatformTypeAndIdToCacheKey(User->Id->GetPlatformType(), User->Id->GetPlatformId()));
+		}
+	}
+}
+
+void FOnlineUserCacheAccelByte::RemovePlatformEntries(const TArray<FAccelByteUserInfoRef>& EvictedUsers)
+{
+	for (const FAccelByteUserInfoRef& UserInfo : EvictedUsers)
+	{
+		if (!UserInfo->Id.IsValid() || !UserInfo->Id->HasPlatformInformation())
+		{
+			continue;
+		}
+
+		const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserInfo->Id->GetPlatformType(), UserInfo->Id->GetPlatformId());
+		FUserCacheShard& Shard = PlatformIdShards[GetShardIndex(PlatformId)];
+
+		FScopeLock ScopeLock(&Shard.Lock);
+
+		// Leave the entry alone if the platform ID has since been linked to another AccelByte user
+		const FAccelByteUserInfoRef* FoundUserInfo = Shard.UserInfoMap.Find(PlatformId);
+		if (FoundUserInfo != nullptr && (*FoundUserInfo)->Id.IsValid() && (*FoundUserInfo)->Id->GetAccelByteId() == UserInfo->Id->GetAccelByteId())
+		{
+			Shard.UserInfoMap.Remove(PlatformId);
+		}
+	}
+}
+
 void FAccelByteUserInfo::CopyValue(const FAccelByteUserInfo& Data)
 {
 	Id = Data.Id;
@@ -0,0 +1,158 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteAsyncTaskMetrics.h"
+
+const double FAccelByteAsyncTaskLatencyHistogram::BucketUpperBoundsMs[BucketCount - 1] = {
+	1.0, 2.0, 5.0, 10.0, 20.0, 50.0, 100.0, 200.0, 500.0, 1000.0, 2000.0, 5000.0, 10000.0, 20000.0, 30000.0, 60000.0
+};
+
+void FAccelByteAsyncTaskLatencyHistogram::AddSample(double Milliseconds)
+{
+	Milliseconds = FMath::Max(Milliseconds, 0.0);
+
+	int32 BucketIndex = 0;
+	while (BucketIndex < BucketCount - 1 && Milliseconds > BucketUpperBoundsMs[BucketIndex])
+	{
+		BucketIndex++;
+	}
+
+	Buckets[BucketIndex]++;
+	SampleCount++;
+	TotalMs += Milliseconds;
+	MaxMs = FMath::Max(MaxMs, Milliseconds);
+}
+
+double FAccelByteAsyncTaskLatencyHistogram::GetPercentile(double Percentile) const
+{
+	if (SampleCount == 0)
+	{
+		return 0.0;
+	}
+
+	const double TargetRank = FMath::Clamp(Percentile, 0.0, 100.0) / 100.0 * SampleCount;
+	uint32 CumulativeCount = 0;
+	for (int32 BucketIndex = 0; BucketIndex < BucketCount; BucketIndex++)
+	{
+		if (Buckets[BucketIndex] == 0)
+		{
+			continue;
+		}
+
+		const uint32 PreviousCount = CumulativeCount;
+		CumulativeCount += Buckets[BucketIndex];
+		if (CumulativeCount < TargetRank)
+		{
+			continue;
+		}
+
+		// Interpolate within the bucket, using the max sample as the upper bound when it is lower than the bucket bound
+		const double LowerBound = (BucketIndex == 0) ? 0.0 : BucketUpperBoundsMs[BucketIndex - 1];
+		const double UpperBound = (BucketIndex == BucketCount - 1) ? MaxMs : FMath::Min(BucketUpperBoundsMs[BucketIndex], MaxMs);
+		const double Alpha = (TargetRank - PreviousCount) / Buckets[BucketIndex];
+		return FMath::Lerp(LowerBound, FMath::Max(LowerBound, UpperBound), FMath::Clamp(Alpha, 0.0, 1.0));
+	}
+
+	return MaxMs;
+}
+
+void FAccelByteAsyncTaskMetrics::RecordTask(const FString& TaskClassName, double QueueWaitSeconds, double ExecutionSeconds, EAccelByteAsyncTaskCompleteState CompleteState)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&MetricsLock);
+
+	FAccelByteAsyncTaskClassMetrics& Metrics = MetricsByTaskClass.FindOrAdd(TaskClassName);
+	Metrics.QueueWait.AddSample(QueueWaitSeconds * 1000.0);
+	Metrics.Execution.AddSample(ExecutionSeconds * 1000.0);
+
+	const int32 StateIndex = static_cast<int32>(CompleteState);
+	if (StateIndex < AB_ASYNC_TASK_COMPLETE_STATE_COUNT)
+	{
+		Metrics.CompleteStateCounts[StateIndex]++;
+	}
+}
+
+bool FAccelByteAsyncTaskMetrics::GetTaskClassMetrics(const FString& TaskClassName, FAccelByteAsyncTaskClassMetrics& OutMetrics) const
+{
+	FScopeLock Lock(&MetricsLock);
+
+	const FAccelByteAsyncTaskClassMetrics* Metrics = MetricsByTaskClass.Find(TaskClassName);
+	if (Metrics == nullptr)
+	{
+		return false;
+	}
+
+	OutMetrics = *Metrics;
+	return true;
+}
+
+TMap<FString, FAccelByteAsyncTaskClassMetrics> FAccelByteAsyncTaskMetrics::GetAllTaskClassMetrics() const
+{
+	FScopeLock Lock(&MetricsLock);
+	return MetricsByTaskClass;
+}
+
+void FAccelByteAsyncTaskMetrics::RecordGameTick(double Seconds)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&MetricsLock);
+
+	GameTickStats.TickCount++;
+	GameTickStats.TotalSeconds += Seconds;
+	GameTickStats.MaxSeconds = FMath::Max(GameTickStats.MaxSeconds, Seconds);
+}
+
+FAccelByteAsyncTaskGameTickStats FAccelByteAsyncTaskMetrics::GetGameTickStats() const
+{
+	FScopeLock Lock(&MetricsLock);
+	return GameTickStats;
+}
+
+void FAccelByteAsyncTaskMetrics::Reset()
+{
+	FScopeLock Lock(&MetricsLock);
+	MetricsByTaskClass.Empty();
+	GameTickStats = FAccelByteAsyncTaskGameTickStats();
+}
+
+void FAccelByteAsyncTaskMetrics::Dump(FOutputDevice& Ar) const
+{
+	TMap<FString, FAccelByteAsyncTaskClassMetrics> Snapshot = GetAllTaskClassMetrics();
+	Snapshot.ValueSort([](const FAccelByteAsyncTaskClassMetrics& A, const FAccelByteAsyncTaskClassMetrics& B)
+	{
+		return A.Execution.GetPercentile(99.0) > B.Execution.GetPercentile(99.0);
+	});
+
+	Ar.Logf(TEXT("AccelByte async task metrics (%d task classes, times in ms, sorted by exec p99)"), Snapshot.Num());
+	Ar.Logf(TEXT("%-64s %8s %8s %8s %8s %8s %8s %8s %8s %8s"), TEXT("Task"), TEXT("Count"), TEXT("Failed"), TEXT("TimedOut")
+		, TEXT("Wait p50"), TEXT("Wait p99"), TEXT("Exec p50"), TEXT("Exec p99"), TEXT("Exec avg"), TEXT("Exec max"));
+
+	for (const TPair<FString, FAccelByteAsyncTaskClassMetrics>& Pair : Snapshot)
+	{
+		const FAccelByteAsyncTaskClassMetrics& Metrics = Pair.Value;
+		const uint32 SucceededCount = Metrics.CompleteStateCounts[static_cast<int32>(EAccelByteAsyncTaskCompleteState::Success)];
+		Ar.Logf(TEXT("%-64s %8u %8u %8u %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f"), *Pair.Key
+			, Metrics.GetCompletedCount()
+			, Metrics.GetCompletedCount() - SucceededCount - Metrics.GetTimeoutCount()
+			, Metrics.GetTimeoutCount()
+			, Metrics.QueueWait.GetPercentile(50.0)
+			, Metrics.QueueWait.GetPercentile(99.0)
+			, Metrics.Execution.GetPercentile(50.0)
+			, Metrics.Execution.GetPercentile(99.0)
+			, Metrics.Execution.GetAverage()
+			, Metrics.Execution.MaxMs);
+	}
+
+	const FAccelByteAsyncTaskGameTickStats TickStats = GetGameTickStats();
+	Ar.Logf(TEXT("Game tick: %llu ticks, %.1f us avg, %.1f us max"), TickStats.TickCount
+		, TickStats.GetAverageSeconds() * 1000000.0, TickStats.MaxSeconds * 1000000.0);
+}
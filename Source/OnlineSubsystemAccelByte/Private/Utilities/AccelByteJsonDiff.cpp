@@ -0,0 +1,39 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteJsonDiff.h"
+#include "Dom/JsonValue.h"
+
+bool FAccelByteJsonDiff::DiffTopLevelFields(const TSharedPtr<FJsonObject>& OldObject
+	, const TSharedRef<FJsonObject>& NewObject
+	, const TSharedRef<FJsonObject>& OutChangedFields
+	, TArray<FString>& OutRemovedFieldNames)
+{
+	bool bHasDifference = false;
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& NewField : NewObject->Values)
+	{
+		const TSharedPtr<FJsonValue> OldValue = OldObject.IsValid() ? OldObject->TryGetField(NewField.Key) : nullptr;
+		if (OldValue.IsValid() && NewField.Value.IsValid() && FJsonValue::CompareEqual(*OldValue, *NewField.Value))
+		{
+			continue;
+		}
+
+		OutChangedFields->SetField(NewField.Key, NewField.Value);
+		bHasDifference = true;
+	}
+
+	if (OldObject.IsValid())
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& OldField : OldObject->Values)
+		{
+			if (!NewObject->HasField(OldField.Key))
+			{
+				OutRemovedFieldNames.Add(OldField.Key);
+				bHasDifference = true;
+			}
+		}
+	}
+
+	return bHasDifference;
+}
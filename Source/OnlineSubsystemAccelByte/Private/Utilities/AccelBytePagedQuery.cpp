@@ -0,0 +1,89 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelBytePagedQuery.h"
+
+FAccelBytePagedQuery::FAccelBytePagedQuery(int32 InPageSize, int32 InMaxPagesInFlight)
+	: PageSize(FMath::Max(InPageSize, 1))
+	, MaxPagesInFlight(FMath::Max(InMaxPagesInFlight, 1))
+{
+}
+
+int32 FAccelBytePagedQuery::SendPendingPages(const FSendPage& SendPage)
+{
+	TArray<int32> PagesToSend;
+	{
+		FScopeLock Lock(&QueryLock);
+
+		// Only the first page is sent until it comes back, most queries fit in it
+		const int32 PageLimit = (CompletedPageCount == 0) ? 1 : MaxPagesInFlight;
+		while (!bHasFailed && EndPageIndex == INDEX_NONE && PagesInFlight.Num() < PageLimit)
+		{
+			PagesInFlight.Add(NextPageIndex);
+			PagesToSend.Add(NextPageIndex);
+			NextPageIndex++;
+		}
+	}
+
+	for (const int32 PageIndex : PagesToSend)
+	{
+		SendPage(PageIndex, PageIndex * PageSize, PageSize);
+	}
+
+	return PagesToSend.Num();
+}
+
+bool FAccelBytePagedQuery::CompletePage(int32 PageIndex, int32 InItemCount)
+{
+	FScopeLock Lock(&QueryLock);
+	if (bHasFailed || PagesInFlight.Remove(PageIndex) == 0)
+	{
+		return false;
+	}
+
+	CompletedPageCount++;
+	ItemCount += InItemCount;
+	if (InItemCount < PageSize && (EndPageIndex == INDEX_NONE || PageIndex < EndPageIndex))
+	{
+		EndPageIndex = PageIndex;
+	}
+
+	return EndPageIndex != INDEX_NONE && PagesInFlight.Num() == 0;
+}
+
+bool FAccelBytePagedQuery::Fail()
+{
+	FScopeLock Lock(&QueryLock);
+	if (bHasFailed)
+	{
+		return false;
+	}
+
+	bHasFailed = true;
+	return true;
+}
+
+bool FAccelBytePagedQuery::HasFailed() const
+{
+	FScopeLock Lock(&QueryLock);
+	return bHasFailed;
+}
+
+bool FAccelBytePagedQuery::IsComplete() const
+{
+	FScopeLock Lock(&QueryLock);
+	return !bHasFailed && EndPageIndex != INDEX_NONE && PagesInFlight.Num() == 0;
+}
+
+int32 FAccelBytePagedQuery::GetPagesInFlight() const
+{
+	FScopeLock Lock(&QueryLock);
+	return PagesInFlight.Num();
+}
+
+int32 FAccelBytePagedQuery::GetItemCount() const
+{
+	FScopeLock Lock(&QueryLock);
+	return ItemCount;
+}
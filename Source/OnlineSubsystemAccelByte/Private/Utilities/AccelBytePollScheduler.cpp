@@ -0,0 +1,115 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelBytePollScheduler.h"
+
+void FAccelBytePollScheduler::Schedule(const FString& Key, double DueTimeSeconds, FOnPollDue&& OnPollDue)
+{
+	FScopeLock Lock(&SchedulerLock);
+
+	FScheduledPoll& Poll = ScheduledPolls.FindOrAdd(Key);
+	Poll.DueTimeSeconds = DueTimeSeconds;
+	Poll.Generation = NextGeneration++;
+	Poll.OnPollDue = MoveTemp(OnPollDue);
+
+	DueTimeHeap.HeapPush(FHeapEntry{ DueTimeSeconds, Poll.Generation, Key });
+	CompactHeapIfNeeded();
+}
+
+bool FAccelBytePollScheduler::Cancel(const FString& Key)
+{
+	FScopeLock Lock(&SchedulerLock);
+	return ScheduledPolls.Remove(Key) > 0;
+}
+
+void FAccelBytePollScheduler::CancelAll()
+{
+	FScopeLock Lock(&SchedulerLock);
+	ScheduledPolls.Empty();
+	DueTimeHeap.Empty();
+}
+
+bool FAccelBytePollScheduler::IsScheduled(const FString& Key) const
+{
+	FScopeLock Lock(&SchedulerLock);
+	return ScheduledPolls.Contains(Key);
+}
+
+int32 FAccelBytePollScheduler::GetScheduledCount() const
+{
+	FScopeLock Lock(&SchedulerLock);
+	return ScheduledPolls.Num();
+}
+
+int32 FAccelBytePollScheduler::Tick(double NowSeconds)
+{
+	TArray<FOnPollDue> DuePolls;
+	{
+		FScopeLock Lock(&SchedulerLock);
+		while (DueTimeHeap.Num() > 0 && DueTimeHeap.HeapTop().DueTimeSeconds <= NowSeconds)
+		{
+			FHeapEntry Entry;
+			DueTimeHeap.HeapPop(Entry, false);
+
+			// Skip entries left behind by polls that were cancelled or rescheduled since
+			const FScheduledPoll* Poll = ScheduledPolls.Find(Entry.Key);
+			if (Poll == nullptr || Poll->Generation != Entry.Generation)
+			{
+				continue;
+			}
+
+			DuePolls.Add(MoveTemp(ScheduledPolls.FindChecked(Entry.Key).OnPollDue));
+			ScheduledPolls.Remove(Entry.Key);
+		}
+	}
+
+	for (const FOnPollDue& OnPollDue : DuePolls)
+	{
+		if (OnPollDue)
+		{
+			OnPollDue();
+		}
+	}
+
+	return DuePolls.Num();
+}
+
+void FAccelBytePollScheduler::Dump(FOutputDevice& Ar, double NowSeconds) const
+{
+	TArray<TPair<FString, double>> Polls;
+	{
+		FScopeLock Lock(&SchedulerLock);
+		Polls.Reserve(ScheduledPolls.Num());
+		for (const TPair<FString, FScheduledPoll>& Pair : ScheduledPolls)
+		{
+			Polls.Emplace(Pair.Key, Pair.Value.DueTimeSeconds);
+		}
+	}
+
+	Polls.Sort([](const TPair<FString, double>& A, const TPair<FString, double>& B)
+	{
+		return A.Value < B.Value;
+	});
+
+	Ar.Logf(TEXT("AccelByte scheduled polls (%d pending)"), Polls.Num());
+	for (const TPair<FString, double>& Poll : Polls)
+	{
+		Ar.Logf(TEXT("%-96s due in %8.1f s"), *Poll.Key, Poll.Value - NowSeconds);
+	}
+}
+
+void FAccelBytePollScheduler::CompactHeapIfNeeded()
+{
+	if (DueTimeHeap.Num() <= ScheduledPolls.Num() * 2 + 64)
+	{
+		return;
+	}
+
+	DueTimeHeap.Reset(ScheduledPolls.Num());
+	for (const TPair<FString, FScheduledPoll>& Pair : ScheduledPolls)
+	{
+		DueTimeHeap.Add(FHeapEntry{ Pair.Value.DueTimeSeconds, Pair.Value.Generation, Pair.Key });
+	}
+	DueTimeHeap.Heapify();
+}
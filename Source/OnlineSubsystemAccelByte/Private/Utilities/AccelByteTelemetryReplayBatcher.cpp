@@ -0,0 +1,117 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteTelemetryReplayBatcher.h"
+#include "Utilities/AccelByteTelemetrySpillQueue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+/** Estimated size of the fields of a sent event that are not part of its payload or names, such as the timestamp */
+#define TELEMETRY_REPLAY_EVENT_OVERHEAD_SIZE 96
+
+FAccelByteTelemetryReplayBatcher::FAccelByteTelemetryReplayBatcher(int32 InMaxBatchEvents, int32 InMaxBatchSize, double InBatchIntervalSeconds)
+	: MaxBatchEvents(FMath::Max(InMaxBatchEvents, 1))
+	, MaxBatchSize(FMath::Max(InMaxBatchSize, 1))
+	, BatchIntervalSeconds(FMath::Max(InBatchIntervalSeconds, 0.0))
+{
+}
+
+void FAccelByteTelemetryReplayBatcher::SetBatchLimits(int32 InMaxBatchEvents, int32 InMaxBatchSize)
+{
+	FScopeLock Lock(&BatcherLock);
+	MaxBatchEvents = FMath::Max(InMaxBatchEvents, 1);
+	MaxBatchSize = FMath::Max(InMaxBatchSize, 1);
+}
+
+void FAccelByteTelemetryReplayBatcher::SetBatchInterval(double InBatchIntervalSeconds)
+{
+	FScopeLock Lock(&BatcherLock);
+	BatchIntervalSeconds = FMath::Max(InBatchIntervalSeconds, 0.0);
+}
+
+void FAccelByteTelemetryReplayBatcher::Add(int32 LocalUserNum)
+{
+	FScopeLock Lock(&BatcherLock);
+	ReplayLocalUserNums.AddUnique(LocalUserNum);
+}
+
+int32 FAccelByteTelemetryReplayBatcher::Tick(double CurrentTimeInSeconds, FAccelByteTelemetrySpillQueue& Queue, FSendBatch SendBatch)
+{
+	int32 LocalUserNum = INDEX_NONE;
+	int32 BatchMaxEvents = 0;
+	int32 BatchMaxSize = 0;
+	{
+		FScopeLock Lock(&BatcherLock);
+		if (ReplayLocalUserNums.Num() == 0 || CurrentTimeInSeconds < NextBatchTimeInSeconds)
+		{
+			return 0;
+		}
+
+		LocalUserNum = ReplayLocalUserNums[0];
+		BatchMaxEvents = MaxBatchEvents;
+		BatchMaxSize = MaxBatchSize;
+	}
+
+	// Peeked outside of the lock, reading the spill file and sizing the events is the costly part of a batch
+	FAccelByteTelemetrySpillQueue::FPeekedEvents Peeked;
+	Queue.PeekEvents(LocalUserNum, BatchMaxEvents, Peeked);
+
+	TArray<TSharedPtr<FAccelByteModelsTelemetryBody>> Batch;
+	int32 BatchSize = 0;
+	for (const TSharedPtr<FAccelByteModelsTelemetryBody>& Event : Peeked.Events)
+	{
+		const int32 Size = GetEventSize(*Event);
+		if (Batch.Num() > 0 && BatchSize + Size > BatchMaxSize)
+		{
+			break;
+		}
+
+		BatchSize += Size;
+		Batch.Add(Event);
+	}
+
+	if (Batch.Num() > 0)
+	{
+		SendBatch(LocalUserNum, Batch, BatchSize);
+	}
+
+	// Events only leave the spill queue once the SDK has them
+	Queue.CommitEvents(Peeked, Batch.Num());
+	const bool bIsReplayDone = Queue.GetEventCount(LocalUserNum) == 0;
+
+	FScopeLock Lock(&BatcherLock);
+	if (bIsReplayDone)
+	{
+		ReplayLocalUserNums.Remove(LocalUserNum);
+	}
+
+	// A peek that came back empty may still have read through the spill file, so it waits the interval as a batch does
+	NextBatchTimeInSeconds = CurrentTimeInSeconds + BatchIntervalSeconds;
+	return Batch.Num();
+}
+
+bool FAccelByteTelemetryReplayBatcher::Remove(int32 LocalUserNum)
+{
+	FScopeLock Lock(&BatcherLock);
+	return ReplayLocalUserNums.Remove(LocalUserNum) > 0;
+}
+
+int32 FAccelByteTelemetryReplayBatcher::GetReplayCount() const
+{
+	FScopeLock Lock(&BatcherLock);
+	return ReplayLocalUserNums.Num();
+}
+
+int32 FAccelByteTelemetryReplayBatcher::GetEventSize(const FAccelByteModelsTelemetryBody& Event)
+{
+	int32 Size = TELEMETRY_REPLAY_EVENT_OVERHEAD_SIZE + FTCHARToUTF8(*Event.EventNamespace).Length() + FTCHARToUTF8(*Event.EventName).Length();
+	if (Event.Payload.IsValid())
+	{
+		FString Payload;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Payload);
+		FJsonSerializer::Serialize(Event.Payload.ToSharedRef(), Writer);
+		Size += FTCHARToUTF8(*Payload).Length();
+	}
+	return Size;
+}
@@ -0,0 +1,1025 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteTelemetrySpillQueue.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+/** "ABTS" read as a little endian uint32 */
+#define TELEMETRY_SPILL_MAGIC 0x53544241
+
+#define TELEMETRY_SPILL_HEADER_SIZE 8
+
+/** Size of the body size and body CRC fields in front of every record body */
+#define TELEMETRY_SPILL_RECORD_PREFIX_SIZE 8
+
+/** Largest record body accepted on read, anything above is treated as a corrupt record */
+#define TELEMETRY_SPILL_MAX_BODY_SIZE (16 * 1024 * 1024)
+
+/** Amount of bytes read or written at once when going through the spill file, also the size of a chunk read by a peek */
+#define TELEMETRY_SPILL_CHUNK_SIZE (1024 * 1024)
+
+/** Written in place of the local user index of records that a rewrite carries over from a previous run */
+#define TELEMETRY_SPILL_PREVIOUS_RUN_LOCAL_USER_NUM MIN_int32
+
+/** Amount of bytes of events read out of the spill file and committed that it may hold before it is rewritten, as long as they also make up half of it */
+#define TELEMETRY_SPILL_COMPACT_MIN_SIZE (256 * 1024)
+
+/** Amount of events that a replay reads and removes at once */
+#define TELEMETRY_SPILL_REPLAY_STEP_EVENTS 256
+
+static void SpillWriteUInt16(uint16 Value, TArray<uint8>& OutBytes)
+{
+	OutBytes.Add(static_cast<uint8>(Value));
+	OutBytes.Add(static_cast<uint8>(Value >> 8));
+}
+
+static void SpillWriteUInt32(uint32 Value, TArray<uint8>& OutBytes)
+{
+	for (int32 Shift = 0; Shift < 32; Shift += 8)
+	{
+		OutBytes.Add(static_cast<uint8>(Value >> Shift));
+	}
+}
+
+static void SpillWriteUInt64(uint64 Value, TArray<uint8>& OutBytes)
+{
+	for (int32 Shift = 0; Shift < 64; Shift += 8)
+	{
+		OutBytes.Add(static_cast<uint8>(Value >> Shift));
+	}
+}
+
+static void SpillPatchUInt32(uint32 Value, TArray<uint8>& Bytes, int32 Offset)
+{
+	for (int32 Index = 0; Index < 4; Index++)
+	{
+		Bytes[Offset + Index] = static_cast<uint8>(Value >> (Index * 8));
+	}
+}
+
+/** Write a string as a uint16 length and UTF-8 bytes, strings too long to fit are written as empty */
+static void SpillWriteString(const FString& Value, TArray<uint8>& OutBytes)
+{
+	const FTCHARToUTF8 Converted(*Value);
+	if (Converted.Length() > MAX_uint16)
+	{
+		SpillWriteUInt16(0, OutBytes);
+		return;
+	}
+
+	SpillWriteUInt16(static_cast<uint16>(Converted.Length()), OutBytes);
+	OutBytes.Append(reinterpret_cast<uint8 const*>(Converted.Get()), Converted.Length());
+}
+
+static uint32 SpillReadUInt32(uint8 const* Data)
+{
+	return static_cast<uint32>(Data[0]) | (static_cast<uint32>(Data[1]) << 8) | (static_cast<uint32>(Data[2]) << 16) | (static_cast<uint32>(Data[3]) << 24);
+}
+
+static uint64 SpillReadUInt64(uint8 const* Data)
+{
+	return static_cast<uint64>(SpillReadUInt32(Data)) | (static_cast<uint64>(SpillReadUInt32(Data + 4)) << 32);
+}
+
+static void WriteSpillHeader(TArray<uint8>& OutBytes)
+{
+	SpillWriteUInt32(TELEMETRY_SPILL_MAGIC, OutBytes);
+	SpillWriteUInt16(ACCELBYTE_TELEMETRY_SPILL_VERSION, OutBytes);
+	SpillWriteUInt16(TELEMETRY_SPILL_HEADER_SIZE, OutBytes);
+}
+
+/** Reserve the prefix of a record, to be patched by FinishSpillRecord once the body is written */
+static int32 StartSpillRecord(TArray<uint8>& OutBytes)
+{
+	const int32 RecordOffset = OutBytes.Num();
+	SpillWriteUInt32(0, OutBytes);
+	SpillWriteUInt32(0, OutBytes);
+	return RecordOffset;
+}
+
+static void FinishSpillRecord(int32 RecordOffset, TArray<uint8>& Bytes)
+{
+	const int32 BodyOffset = RecordOffset + TELEMETRY_SPILL_RECORD_PREFIX_SIZE;
+	const int32 BodySize = Bytes.Num() - BodyOffset;
+	SpillPatchUInt32(static_cast<uint32>(BodySize), Bytes, RecordOffset);
+	SpillPatchUInt32(FCrc::MemCrc32(Bytes.GetData() + BodyOffset, BodySize), Bytes, RecordOffset + 4);
+}
+
+/** Append a whole record, prefix included, for an event */
+static void WriteSpillRecord(int32 LocalUserNum, const FString& OwnerUserId, const FAccelByteModelsTelemetryBody& Event, TArray<uint8>& OutBytes)
+{
+	const int32 RecordOffset = StartSpillRecord(OutBytes);
+
+	SpillWriteUInt32(static_cast<uint32>(LocalUserNum), OutBytes);
+	SpillWriteString(OwnerUserId, OutBytes);
+	SpillWriteUInt64(static_cast<uint64>(Event.ClientTimestamp.GetTicks()), OutBytes);
+	SpillWriteString(Event.EventNamespace, OutBytes);
+	SpillWriteString(Event.EventName, OutBytes);
+
+	FString Payload;
+	if (Event.Payload.IsValid())
+	{
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Payload);
+		FJsonSerializer::Serialize(Event.Payload.ToSharedRef(), Writer);
+	}
+
+	const FTCHARToUTF8 ConvertedPayload(*Payload);
+	SpillWriteUInt32(static_cast<uint32>(ConvertedPayload.Length()), OutBytes);
+	OutBytes.Append(reinterpret_cast<uint8 const*>(ConvertedPayload.Get()), ConvertedPayload.Length());
+
+	FinishSpillRecord(RecordOffset, OutBytes);
+}
+
+/**
+ * Bounds checked reader over a single record body
+ */
+struct FSpillRecordReader
+{
+	uint8 const* Data;
+	int32 Size;
+	int32 Offset = 0;
+
+	FSpillRecordReader(uint8 const* InData, int32 InSize)
+		: Data(InData)
+		, Size(InSize)
+	{
+	}
+
+	bool ReadUInt32(uint32& OutValue)
+	{
+		if (Size - Offset < 4)
+		{
+			return false;
+		}
+		OutValue = SpillReadUInt32(Data + Offset);
+		Offset += 4;
+		return true;
+	}
+
+	bool ReadInt64(int64& OutValue)
+	{
+		if (Size - Offset < 8)
+		{
+			return false;
+		}
+		OutValue = static_cast<int64>(SpillReadUInt64(Data + Offset));
+		Offset += 8;
+		return true;
+	}
+
+	bool ReadUTF8(int32 Length, FString& OutValue)
+	{
+		if (Length < 0 || Size - Offset < Length)
+		{
+			return false;
+		}
+
+		const FUTF8ToTCHAR Converted(reinterpret_cast<ANSICHAR const*>(Data + Offset), Length);
+		OutValue = FString(Converted.Length(), Converted.Get());
+		Offset += Length;
+		return true;
+	}
+
+	bool ReadString(FString& OutValue)
+	{
+		if (Size - Offset < 2)
+		{
+			return false;
+		}
+
+		const int32 Length = static_cast<int32>(Data[Offset]) | (static_cast<int32>(Data[Offset + 1]) << 8);
+		Offset += 2;
+		return ReadUTF8(Length, OutValue);
+	}
+};
+
+/**
+ * Read the local user index and owner at the start of a record body.
+ *
+ * @param OutEventOffset Offset in the body where the fields of the event itself start
+ */
+static bool ReadSpillRecordOwner(uint8 const* Data, int32 Size, int32& OutLocalUserNum, FString& OutOwnerUserId, int32& OutEventOffset)
+{
+	FSpillRecordReader Reader(Data, Size);
+
+	uint32 LocalUserNum = 0;
+	if (!Reader.ReadUInt32(LocalUserNum) || !Reader.ReadString(OutOwnerUserId))
+	{
+		return false;
+	}
+
+	OutLocalUserNum = static_cast<int32>(LocalUserNum);
+	OutEventOffset = Reader.Offset;
+	return true;
+}
+
+static bool ReadSpillRecordEvent(uint8 const* Data, int32 Size, TSharedPtr<FAccelByteModelsTelemetryBody>& OutEvent)
+{
+	FSpillRecordReader Reader(Data, Size);
+
+	int64 ClientTimestampTicks = 0;
+	uint32 PayloadLength = 0;
+	FString Payload;
+	TSharedRef<FAccelByteModelsTelemetryBody> Event = MakeShared<FAccelByteModelsTelemetryBody>();
+	if (!Reader.ReadInt64(ClientTimestampTicks)
+		|| !Reader.ReadString(Event->EventNamespace)
+		|| !Reader.ReadString(Event->EventName)
+		|| !Reader.ReadUInt32(PayloadLength)
+		|| PayloadLength > static_cast<uint32>(Size)
+		|| !Reader.ReadUTF8(static_cast<int32>(PayloadLength), Payload))
+	{
+		return false;
+	}
+
+	// A body with trailing bytes was not written by this version
+	if (Reader.Offset != Size || ClientTimestampTicks < 0 || ClientTimestampTicks > FDateTime::MaxValue().GetTicks())
+	{
+		return false;
+	}
+
+	if (!Payload.IsEmpty())
+	{
+		TSharedPtr<FJsonObject> PayloadObject;
+		const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Payload);
+		if (!FJsonSerializer::Deserialize(JsonReader, PayloadObject) || !PayloadObject.IsValid())
+		{
+			return false;
+		}
+		Event->Payload = PayloadObject;
+	}
+
+	Event->ClientTimestamp = FDateTime(ClientTimestampTicks);
+	OutEvent = Event;
+	return true;
+}
+
+/**
+ * Reads a range of the spill file in large chunks, so that small records do not cost a read call each
+ */
+struct FSpillFileReader
+{
+	IFileHandle& Handle;
+	int64 EndOffset;
+	TArray<uint8> Buffer;
+	int64 BufferStart = 0;
+
+	FSpillFileReader(IFileHandle& InHandle, int64 InEndOffset)
+		: Handle(InHandle)
+		, EndOffset(InEndOffset)
+	{
+	}
+
+	/** Get the bytes at an offset, valid until the next call, or nullptr if they are past the end or cannot be read */
+	uint8 const* Get(int64 Offset, int64 Size)
+	{
+		if (Size < 0 || Size > TELEMETRY_SPILL_MAX_BODY_SIZE + TELEMETRY_SPILL_RECORD_PREFIX_SIZE || Offset + Size > EndOffset)
+		{
+			return nullptr;
+		}
+
+		if (Offset < BufferStart || Offset + Size > BufferStart + Buffer.Num())
+		{
+			const int64 ReadSize = FMath::Min(FMath::Max(Size, static_cast<int64>(TELEMETRY_SPILL_CHUNK_SIZE)), EndOffset - Offset);
+			Buffer.SetNumUninitialized(static_cast<int32>(ReadSize));
+			if (!Handle.Seek(Offset) || !Handle.Read(Buffer.GetData(), ReadSize))
+			{
+				Buffer.Reset();
+				return nullptr;
+			}
+			BufferStart = Offset;
+		}
+
+		return Buffer.GetData() + (Offset - BufferStart);
+	}
+};
+
+/**
+ * Go through the records of a range of the spill file, stopping at the first one that is cut short or fails its CRC, or
+ * before the first one that the record function turns down.
+ *
+ * @return Offset right after the last record gone through
+ */
+static int64 ReadSpillRecords(IFileHandle& Handle, int64 StartOffset, int64 EndOffset, TFunctionRef<bool(int64 /*RecordOffset*/, uint8 const* /*Body*/, int32 /*BodySize*/)> OnRecord)
+{
+	FSpillFileReader Reader(Handle, EndOffset);
+	int64 Offset = StartOffset;
+	while (true)
+	{
+		uint8 const* Prefix = Reader.Get(Offset, TELEMETRY_SPILL_RECORD_PREFIX_SIZE);
+		if (Prefix == nullptr)
+		{
+			break;
+		}
+
+		const uint32 BodySize = SpillReadUInt32(Prefix);
+		const uint32 BodyCrc = SpillReadUInt32(Prefix + 4);
+		if (BodySize < 4 || BodySize > TELEMETRY_SPILL_MAX_BODY_SIZE)
+		{
+			break;
+		}
+
+		uint8 const* Body = Reader.Get(Offset + TELEMETRY_SPILL_RECORD_PREFIX_SIZE, BodySize);
+		if (Body == nullptr || FCrc::MemCrc32(Body, static_cast<int32>(BodySize)) != BodyCrc)
+		{
+			break;
+		}
+
+		if (!OnRecord(Offset, Body, static_cast<int32>(BodySize)))
+		{
+			break;
+		}
+		Offset += TELEMETRY_SPILL_RECORD_PREFIX_SIZE + BodySize;
+	}
+
+	return Offset;
+}
+
+/** Whether a spill file starts with a header that this version can read */
+static bool ReadSpillHeader(IFileHandle& Handle)
+{
+	uint8 Header[TELEMETRY_SPILL_HEADER_SIZE];
+	if (Handle.Size() < TELEMETRY_SPILL_HEADER_SIZE || !Handle.Seek(0) || !Handle.Read(Header, TELEMETRY_SPILL_HEADER_SIZE))
+	{
+		return false;
+	}
+
+	const uint16 Version = static_cast<uint16>(Header[4] | (Header[5] << 8));
+	const uint16 HeaderSize = static_cast<uint16>(Header[6] | (Header[7] << 8));
+	return SpillReadUInt32(Header) == TELEMETRY_SPILL_MAGIC
+		&& Version == ACCELBYTE_TELEMETRY_SPILL_VERSION
+		&& HeaderSize == TELEMETRY_SPILL_HEADER_SIZE;
+}
+
+FAccelByteTelemetrySpillQueue::FAccelByteTelemetrySpillQueue(int32 InMaxInMemoryEvents)
+	: MaxInMemoryEvents(FMath::Max(InMaxInMemoryEvents, 0))
+{
+}
+
+FAccelByteTelemetrySpillQueue::~FAccelByteTelemetrySpillQueue()
+{
+	FScopeLock Lock(&QueueLock);
+	if (!WriteHandle.IsValid())
+	{
+		return;
+	}
+
+	// Buffered events would be lost otherwise, and events committed since the last rewrite would be sent again
+	SpillBufferedEvents();
+	CompactIfNeeded(true);
+	WriteHandle.Reset();
+}
+
+bool FAccelByteTelemetrySpillQueue::OpenSpillFile(const FString& InFilePath, int64 InMaxFileSize)
+{
+	FScopeLock Lock(&QueueLock);
+
+	WriteHandle.Reset();
+	PreviousRunEventCount = 0;
+	bIsSpillFileFull = false;
+	FilePath = InFilePath;
+	MaxFileSize = InMaxFileSize;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+
+	// Count the records left by a previous run, a file this version cannot read is started over
+	int64 ValidEndOffset = 0;
+	int64 ExistingFileSize = 0;
+	int32 ExistingEventCount = 0;
+	{
+		TUniquePtr<IFileHandle> ReadHandle(PlatformFile.OpenRead(*FilePath, true));
+		if (ReadHandle.IsValid() && ReadSpillHeader(*ReadHandle))
+		{
+			ExistingFileSize = ReadHandle->Size();
+			ValidEndOffset = ReadSpillRecords(*ReadHandle, TELEMETRY_SPILL_HEADER_SIZE, ExistingFileSize
+				, [&ExistingEventCount](int64, uint8 const*, int32)
+				{
+					ExistingEventCount++;
+					return true;
+				});
+		}
+	}
+
+	if (ValidEndOffset == 0)
+	{
+		if (!ResetSpillFile())
+		{
+			return false;
+		}
+	}
+	else
+	{
+		WriteHandle.Reset(PlatformFile.OpenWrite(*FilePath, true, true));
+		if (!WriteHandle.IsValid())
+		{
+			return false;
+		}
+
+		FileSize = ValidEndOffset;
+		FileReadOffset = TELEMETRY_SPILL_HEADER_SIZE;
+		RunStartOffset = ValidEndOffset;
+		PreviousRunEventCount = ExistingEventCount;
+
+		// The game stopped mid write last time, cut the file back to the records before the torn one
+		if (ValidEndOffset < ExistingFileSize)
+		{
+			RewriteSpillFile([](int32&, FString&) { return true; });
+		}
+	}
+
+	if (!WriteHandle.IsValid())
+	{
+		PreviousRunEventCount = 0;
+		return false;
+	}
+
+	// Events queued before the file was opened are spilled once the buffer fills up, as any other
+	if (BufferedEvents.Num() >= MaxInMemoryEvents)
+	{
+		SpillBufferedEvents();
+	}
+	return true;
+}
+
+void FAccelByteTelemetrySpillQueue::SetMaxInMemoryEvents(int32 InMaxInMemoryEvents)
+{
+	FScopeLock Lock(&QueueLock);
+	MaxInMemoryEvents = FMath::Max(InMaxInMemoryEvents, 0);
+
+	// Without a spill file, events past the new maximum are kept until replayed
+	if (WriteHandle.IsValid() && BufferedEvents.Num() >= MaxInMemoryEvents)
+	{
+		SpillBufferedEvents();
+	}
+}
+
+void FAccelByteTelemetrySpillQueue::Enqueue(int32 LocalUserNum, const TSharedPtr<FAccelByteModelsTelemetryBody>& Event)
+{
+	if (!Event.IsValid())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&QueueLock);
+	if (WriteHandle.IsValid() ? bIsSpillFileFull : BufferedEvents.Num() >= MaxInMemoryEvents)
+	{
+		DroppedEventCount++;
+		return;
+	}
+
+	BufferedEvents.Add({LocalUserNum, LocalUserNumToOwnerUserId.FindRef(LocalUserNum), Event, NextEventId++, 0});
+	LocalUserNumToEventCount.FindOrAdd(LocalUserNum)++;
+
+	if (WriteHandle.IsValid() && BufferedEvents.Num() >= MaxInMemoryEvents)
+	{
+		SpillBufferedEvents();
+	}
+}
+
+void FAccelByteTelemetrySpillQueue::SetOwner(int32 LocalUserNum, const FString& OwnerUserId)
+{
+	FScopeLock Lock(&QueueLock);
+	LocalUserNumToOwnerUserId.Add(LocalUserNum, OwnerUserId);
+
+	int32 InMemoryEventCount = 0;
+	for (TArray<FQueuedEvent>* Events : {&ReadEvents, &BufferedEvents})
+	{
+		for (FQueuedEvent& QueuedEvent : *Events)
+		{
+			if (QueuedEvent.LocalUserNum == LocalUserNum)
+			{
+				if (QueuedEvent.OwnerUserId.IsEmpty())
+				{
+					QueuedEvent.OwnerUserId = OwnerUserId;
+				}
+				InMemoryEventCount++;
+			}
+		}
+	}
+
+	// Spilled events of the local user would be dropped by the next run if the game crashed before they were sent, the
+	// rewrite fills in the owner of every record that has none
+	if (WriteHandle.IsValid() && !OwnerUserId.IsEmpty() && InMemoryEventCount < LocalUserNumToEventCount.FindRef(LocalUserNum))
+	{
+		RewriteSpillFile([](int32&, FString&) { return true; });
+	}
+}
+
+void FAccelByteTelemetrySpillQueue::MoveEvents(int32 FromLocalUserNum, int32 ToLocalUserNum)
+{
+	FScopeLock Lock(&QueueLock);
+
+	int32 EventCount = 0;
+	if (FromLocalUserNum == ToLocalUserNum || !LocalUserNumToEventCount.RemoveAndCopyValue(FromLocalUserNum, EventCount))
+	{
+		return;
+	}
+
+	LocalUserNumToEventCount.FindOrAdd(ToLocalUserNum) += EventCount;
+
+	const FString ToOwnerUserId = LocalUserNumToOwnerUserId.FindRef(ToLocalUserNum);
+	int32 InMemoryEventCount = 0;
+	for (TArray<FQueuedEvent>* Events : {&ReadEvents, &BufferedEvents})
+	{
+		for (FQueuedEvent& QueuedEvent : *Events)
+		{
+			if (QueuedEvent.LocalUserNum == FromLocalUserNum)
+			{
+				QueuedEvent.LocalUserNum = ToLocalUserNum;
+				QueuedEvent.OwnerUserId = ToOwnerUserId;
+				InMemoryEventCount++;
+			}
+		}
+	}
+
+	// The rest of the events are in the spill file, and keep the local user they were queued for until it is rewritten
+	if (WriteHandle.IsValid() && InMemoryEventCount < EventCount)
+	{
+		RewriteSpillFile([FromLocalUserNum, ToLocalUserNum, &ToOwnerUserId](int32& LocalUserNum, FString& OwnerUserId)
+		{
+			if (LocalUserNum == FromLocalUserNum)
+			{
+				LocalUserNum = ToLocalUserNum;
+				OwnerUserId = ToOwnerUserId;
+			}
+			return true;
+		});
+	}
+}
+
+int32 FAccelByteTelemetrySpillQueue::PeekEvents(int32 LocalUserNum, int32 MaxEvents, FPeekedEvents& OutPeeked)
+{
+	FScopeLock Lock(&QueueLock);
+
+	OutPeeked = FPeekedEvents();
+	OutPeeked.LocalUserNum = LocalUserNum;
+	if (MaxEvents <= 0 || GetEventCountLocked(LocalUserNum) == 0)
+	{
+		return 0;
+	}
+
+	ReadSpilledEvents(LocalUserNum, MaxEvents);
+
+	// Buffered events come after every spilled one, so they are only handed out once the file has been read through
+	const bool bHasReadAllSpilledEvents = !WriteHandle.IsValid() || FileReadOffset >= FileSize;
+	for (TArray<FQueuedEvent>* Events : {&ReadEvents, &BufferedEvents})
+	{
+		if (Events == &BufferedEvents && !bHasReadAllSpilledEvents)
+		{
+			break;
+		}
+
+		for (const FQueuedEvent& QueuedEvent : *Events)
+		{
+			if (OutPeeked.Events.Num() >= MaxEvents)
+			{
+				break;
+			}
+			if (QueuedEvent.LocalUserNum == LocalUserNum)
+			{
+				OutPeeked.Events.Add(QueuedEvent.Event);
+				OutPeeked.EventIds.Add(QueuedEvent.EventId);
+			}
+		}
+	}
+	return OutPeeked.Events.Num();
+}
+
+int32 FAccelByteTelemetrySpillQueue::CommitEvents(const FPeekedEvents& Peeked, int32 Count)
+{
+	FScopeLock Lock(&QueueLock);
+
+	Count = FMath::Clamp(Count, 0, Peeked.EventIds.Num());
+	if (Count == 0)
+	{
+		return 0;
+	}
+
+	TSet<int64> CommittedEventIds;
+	CommittedEventIds.Reserve(Count);
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		CommittedEventIds.Add(Peeked.EventIds[Index]);
+	}
+
+	const auto IsCommitted = [&CommittedEventIds](const FQueuedEvent& QueuedEvent) { return CommittedEventIds.Contains(QueuedEvent.EventId); };
+	const int32 CommittedCount = RemoveQueuedEvents(ReadEvents, IsCommitted) + RemoveQueuedEvents(BufferedEvents, IsCommitted);
+	CompactIfNeeded();
+	return CommittedCount;
+}
+
+int32 FAccelByteTelemetrySpillQueue::ReplayEvents(int32 LocalUserNum, FOnReplayEvent OnEvent)
+{
+	// Only as many events as are queued so far are replayed, so that events queued from the replay function stay queued
+	const int32 EventCount = GetEventCount(LocalUserNum);
+
+	int32 ReplayedCount = 0;
+	while (ReplayedCount < EventCount)
+	{
+		FPeekedEvents Peeked;
+		if (PeekEvents(LocalUserNum, FMath::Min(EventCount - ReplayedCount, TELEMETRY_SPILL_REPLAY_STEP_EVENTS), Peeked) == 0)
+		{
+			break;
+		}
+
+		// Handed out without the lock held, so that the replay function may take as long as it needs
+		for (const TSharedPtr<FAccelByteModelsTelemetryBody>& Event : Peeked.Events)
+		{
+			OnEvent(Event);
+		}
+
+		CommitEvents(Peeked, Peeked.Events.Num());
+		ReplayedCount += Peeked.Events.Num();
+	}
+
+	return ReplayedCount;
+}
+
+int32 FAccelByteTelemetrySpillQueue::RemoveEvents(int32 LocalUserNum)
+{
+	FScopeLock Lock(&QueueLock);
+
+	const int32 EventCount = LocalUserNumToEventCount.FindRef(LocalUserNum);
+	const auto IsOfLocalUser = [LocalUserNum](const FQueuedEvent& QueuedEvent) { return QueuedEvent.LocalUserNum == LocalUserNum; };
+	const int32 InMemoryEventCount = RemoveQueuedEvents(ReadEvents, IsOfLocalUser) + RemoveQueuedEvents(BufferedEvents, IsOfLocalUser);
+
+	// The rest of the events are in the spill file
+	if (WriteHandle.IsValid() && InMemoryEventCount < EventCount)
+	{
+		RewriteSpillFile([LocalUserNum](int32& RecordLocalUserNum, FString&) { return RecordLocalUserNum != LocalUserNum; });
+	}
+
+	LocalUserNumToEventCount.Remove(LocalUserNum);
+	LocalUserNumToOwnerUserId.Remove(LocalUserNum);
+	CompactIfNeeded();
+	return EventCount;
+}
+
+void FAccelByteTelemetrySpillQueue::SpillBufferedEvents()
+{
+	if (BufferedEvents.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<uint8> Records;
+	int32 SpilledCount = 0;
+	for (const FQueuedEvent& QueuedEvent : BufferedEvents)
+	{
+		const int32 RecordOffset = Records.Num();
+		WriteSpillRecord(QueuedEvent.LocalUserNum, QueuedEvent.OwnerUserId, *QueuedEvent.Event, Records);
+		if (FileSize + Records.Num() > MaxFileSize)
+		{
+			Records.SetNum(RecordOffset);
+			bIsSpillFileFull = true;
+			break;
+		}
+		SpilledCount++;
+	}
+
+	// Writes go straight to the OS, so a crash of the game does not lose them. A write that fails half way leaves a torn
+	// record, which is cut off the next time the file is opened.
+	if (Records.Num() > 0 && !WriteHandle->Write(Records.GetData(), Records.Num()))
+	{
+		FileSize = WriteHandle->Tell();
+		bIsSpillFileFull = true;
+		SpilledCount = 0;
+	}
+	else
+	{
+		FileSize += Records.Num();
+	}
+
+	for (int32 Index = SpilledCount; Index < BufferedEvents.Num(); Index++)
+	{
+		DroppedEventCount++;
+		DecrementEventCount(BufferedEvents[Index].LocalUserNum, 1);
+	}
+	BufferedEvents.Reset();
+}
+
+void FAccelByteTelemetrySpillQueue::ReadSpilledEvents(int32 LocalUserNum, int32 MaxEvents)
+{
+	if (!WriteHandle.IsValid() || FileReadOffset >= FileSize)
+	{
+		return;
+	}
+
+	TUniquePtr<IFileHandle> ReadHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath, true));
+	if (!ReadHandle.IsValid())
+	{
+		return;
+	}
+
+	const FString OwnerUserId = LocalUserNumToOwnerUserId.FindRef(LocalUserNum);
+	int32 UserEventCount = 0;
+	for (const FQueuedEvent& QueuedEvent : ReadEvents)
+	{
+		if (QueuedEvent.LocalUserNum == LocalUserNum)
+		{
+			UserEventCount++;
+		}
+	}
+
+	// Records of other local users are read past for as long as it takes, so that a peek does not come back empty while
+	// the local user still has events in the file. Their events stay in memory until their own local user peeks.
+	while (FileReadOffset < FileSize && UserEventCount < MaxEvents)
+	{
+		const int64 ChunkStartOffset = FileReadOffset;
+		const int64 ChunkEndOffset = ReadSpillRecords(*ReadHandle, ChunkStartOffset, FileSize, [&](int64 RecordOffset, uint8 const* Body, int32 BodySize)
+		{
+			if (RecordOffset - ChunkStartOffset >= TELEMETRY_SPILL_CHUNK_SIZE)
+			{
+				return false;
+			}
+
+			FQueuedEvent ReadEvent{static_cast<int32>(SpillReadUInt32(Body)), FString(), nullptr, NextEventId, TELEMETRY_SPILL_RECORD_PREFIX_SIZE + BodySize};
+			int32 EventOffset = 0;
+			const bool bIsReadable = ReadSpillRecordOwner(Body, BodySize, ReadEvent.LocalUserNum, ReadEvent.OwnerUserId, EventOffset)
+				&& ReadSpillRecordEvent(Body + EventOffset, BodySize - EventOffset, ReadEvent.Event);
+
+			if (IsPreviousRunRecord(RecordOffset, ReadEvent.LocalUserNum))
+			{
+				PreviousRunEventCount = FMath::Max(PreviousRunEventCount - 1, 0);
+
+				// Local user indices do not carry over between runs, only the owner tells whose event it is
+				if (!bIsReadable || ReadEvent.OwnerUserId.IsEmpty() || ReadEvent.OwnerUserId != OwnerUserId)
+				{
+					DroppedEventCount++;
+					return true;
+				}
+				ReadEvent.LocalUserNum = LocalUserNum;
+				LocalUserNumToEventCount.FindOrAdd(LocalUserNum)++;
+			}
+			else if (!bIsReadable)
+			{
+				DroppedEventCount++;
+				DecrementEventCount(ReadEvent.LocalUserNum, 1);
+				return true;
+			}
+			else if (ReadEvent.OwnerUserId.IsEmpty())
+			{
+				ReadEvent.OwnerUserId = LocalUserNumToOwnerUserId.FindRef(ReadEvent.LocalUserNum);
+			}
+
+			if (ReadEvent.LocalUserNum == LocalUserNum)
+			{
+				UserEventCount++;
+			}
+			NextEventId++;
+			ReadEvents.Add(MoveTemp(ReadEvent));
+			return true;
+		});
+
+		// A record that can no longer be read means the file changed underneath, whatever is past it is lost
+		if (ChunkEndOffset == ChunkStartOffset)
+		{
+			FileReadOffset = FileSize;
+			break;
+		}
+
+		FileReadOffset = ChunkEndOffset;
+		if (UserEventCount > 0)
+		{
+			break;
+		}
+	}
+}
+
+int32 FAccelByteTelemetrySpillQueue::RemoveQueuedEvents(TArray<FQueuedEvent>& Events, TFunctionRef<bool(const FQueuedEvent&)> Predicate)
+{
+	return Events.RemoveAll([this, &Predicate](const FQueuedEvent& QueuedEvent)
+	{
+		if (!Predicate(QueuedEvent))
+		{
+			return false;
+		}
+		DecrementEventCount(QueuedEvent.LocalUserNum, 1);
+		return true;
+	});
+}
+
+void FAccelByteTelemetrySpillQueue::DecrementEventCount(int32 LocalUserNum, int32 Count)
+{
+	int32* EventCount = LocalUserNumToEventCount.Find(LocalUserNum);
+	if (EventCount != nullptr && (*EventCount -= Count) <= 0)
+	{
+		LocalUserNumToEventCount.Remove(LocalUserNum);
+	}
+}
+
+void FAccelByteTelemetrySpillQueue::CompactIfNeeded(bool bForce /*= false*/)
+{
+	if (!WriteHandle.IsValid() || FileSize <= TELEMETRY_SPILL_HEADER_SIZE)
+	{
+		return;
+	}
+
+	if (GetEventCountLocked() == 0)
+	{
+		ResetSpillFile();
+		return;
+	}
+
+	// Rewriting the file costs a pass over all of it, so it waits until most of what it would go through is dead
+	int64 ReadEventsSize = 0;
+	for (const FQueuedEvent& QueuedEvent : ReadEvents)
+	{
+		ReadEventsSize += QueuedEvent.RecordSize;
+	}
+
+	const int64 CommittedSize = FileReadOffset - TELEMETRY_SPILL_HEADER_SIZE - ReadEventsSize;
+	if (CommittedSize > 0 && (bForce || (CommittedSize >= TELEMETRY_SPILL_COMPACT_MIN_SIZE && CommittedSize * 2 >= FileSize)))
+	{
+		RewriteSpillFile([](int32&, FString&) { return true; });
+	}
+}
+
+bool FAccelByteTelemetrySpillQueue::IsPreviousRunRecord(int64 RecordOffset, int32 RecordedLocalUserNum) const
+{
+	return RecordOffset < RunStartOffset || RecordedLocalUserNum == TELEMETRY_SPILL_PREVIOUS_RUN_LOCAL_USER_NUM;
+}
+
+bool FAccelByteTelemetrySpillQueue::RewriteSpillFile(TFunctionRef<bool(int32&, FString&)> ResolveRecord)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const FString TempFilePath = FilePath + TEXT(".tmp");
+
+	TArray<int64> NewRecordSizes;
+	NewRecordSizes.Reserve(ReadEvents.Num());
+	int64 NewFileSize = 0;
+	int64 NewFileReadOffset = 0;
+	bool bWasSuccessful = false;
+	{
+		TUniquePtr<IFileHandle> ReadHandle(PlatformFile.OpenRead(*FilePath, true));
+		TUniquePtr<IFileHandle> TempHandle(PlatformFile.OpenWrite(*TempFilePath));
+		if (ReadHandle.IsValid() && TempHandle.IsValid())
+		{
+			bWasSuccessful = true;
+			TArray<uint8> Pending;
+			Pending.Reserve(TELEMETRY_SPILL_CHUNK_SIZE);
+			WriteSpillHeader(Pending);
+
+			const auto FlushPending = [&](bool bForce)
+			{
+				if (bForce || Pending.Num() >= TELEMETRY_SPILL_CHUNK_SIZE)
+				{
+					NewFileSize += Pending.Num();
+					bWasSuccessful &= TempHandle->Write(Pending.GetData(), Pending.Num());
+					Pending.Reset();
+				}
+			};
+
+			// Events read out of the file that are still queued are the oldest, they stay read once the file is rewritten
+			for (const FQueuedEvent& QueuedEvent : ReadEvents)
+			{
+				const int32 RecordOffset = Pending.Num();
+				WriteSpillRecord(QueuedEvent.LocalUserNum, QueuedEvent.OwnerUserId, *QueuedEvent.Event, Pending);
+				NewRecordSizes.Add(Pending.Num() - RecordOffset);
+				FlushPending(false);
+			}
+			NewFileReadOffset = NewFileSize + Pending.Num();
+
+			ReadSpillRecords(*ReadHandle, FileReadOffset, FileSize, [&](int64 RecordOffset, uint8 const* Body, int32 BodySize)
+			{
+				int32 LocalUserNum = INDEX_NONE;
+				FString OwnerUserId;
+				int32 EventOffset = 0;
+				if (!ReadSpillRecordOwner(Body, BodySize, LocalUserNum, OwnerUserId, EventOffset))
+				{
+					return true;
+				}
+
+				// Records of a previous run are told apart by their local user index once they are no longer before the
+				// start of this run, they are resolved by their owner when read
+				if (IsPreviousRunRecord(RecordOffset, LocalUserNum))
+				{
+					LocalUserNum = TELEMETRY_SPILL_PREVIOUS_RUN_LOCAL_USER_NUM;
+				}
+				else
+				{
+					if (!ResolveRecord(LocalUserNum, OwnerUserId))
+					{
+						return true;
+					}
+					if (OwnerUserId.IsEmpty())
+					{
+						OwnerUserId = LocalUserNumToOwnerUserId.FindRef(LocalUserNum);
+					}
+				}
+
+				const int32 NewRecordOffset = StartSpillRecord(Pending);
+				SpillWriteUInt32(static_cast<uint32>(LocalUserNum), Pending);
+				SpillWriteString(OwnerUserId, Pending);
+				Pending.Append(Body + EventOffset, BodySize - EventOffset);
+				FinishSpillRecord(NewRecordOffset, Pending);
+				FlushPending(false);
+				return true;
+			});
+
+			FlushPending(true);
+		}
+	}
+
+	// The spill file cannot be moved over while it is open for appending
+	WriteHandle.Reset();
+	if (bWasSuccessful && IFileManager::Get().Move(*FilePath, *TempFilePath, true, true))
+	{
+		FileReadOffset = NewFileReadOffset;
+		RunStartOffset = TELEMETRY_SPILL_HEADER_SIZE;
+		bIsSpillFileFull = false;
+		for (int32 Index = 0; Index < ReadEvents.Num(); Index++)
+		{
+			ReadEvents[Index].RecordSize = NewRecordSizes[Index];
+		}
+	}
+	else
+	{
+		IFileManager::Get().Delete(*TempFilePath);
+		bWasSuccessful = false;
+	}
+
+	WriteHandle.Reset(PlatformFile.OpenWrite(*FilePath, true, true));
+	FileSize = WriteHandle.IsValid() ? WriteHandle->Size() : 0;
+	return bWasSuccessful;
+}
+
+bool FAccelByteTelemetrySpillQueue::ResetSpillFile()
+{
+	WriteHandle.Reset();
+	bIsSpillFileFull = false;
+
+	TArray<uint8> Header;
+	WriteSpillHeader(Header);
+	FileReadOffset = Header.Num();
+	RunStartOffset = Header.Num();
+	FileSize = 0;
+	if (!FFileHelper::SaveArrayToFile(Header, *FilePath))
+	{
+		return false;
+	}
+
+	WriteHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath, true, true));
+	if (!WriteHandle.IsValid())
+	{
+		return false;
+	}
+
+	FileSize = WriteHandle->Size();
+	return true;
+}
+
+int32 FAccelByteTelemetrySpillQueue::GetEventCount() const
+{
+	FScopeLock Lock(&QueueLock);
+	return GetEventCountLocked();
+}
+
+int32 FAccelByteTelemetrySpillQueue::GetEventCount(int32 LocalUserNum) const
+{
+	FScopeLock Lock(&QueueLock);
+	return GetEventCountLocked(LocalUserNum);
+}
+
+int32 FAccelByteTelemetrySpillQueue::GetEventCountLocked() const
+{
+	int32 EventCount = PreviousRunEventCount;
+	for (const TPair<int32, int32>& UserEventCount : LocalUserNumToEventCount)
+	{
+		EventCount += UserEventCount.Value;
+	}
+	return EventCount;
+}
+
+int32 FAccelByteTelemetrySpillQueue::GetEventCountLocked(int32 LocalUserNum) const
+{
+	const FString* OwnerUserId = LocalUserNumToOwnerUserId.Find(LocalUserNum);
+	const bool bMayOwnPreviousRunEvents = OwnerUserId != nullptr && !OwnerUserId->IsEmpty();
+	return LocalUserNumToEventCount.FindRef(LocalUserNum) + (bMayOwnPreviousRunEvents ? PreviousRunEventCount : 0);
+}
+
+int32 FAccelByteTelemetrySpillQueue::GetInMemoryEventCount() const
+{
+	FScopeLock Lock(&QueueLock);
+	return BufferedEvents.Num() + ReadEvents.Num();
+}
+
+int32 FAccelByteTelemetrySpillQueue::GetDroppedEventCount() const
+{
+	FScopeLock Lock(&QueueLock);
+	return DroppedEventCount;
+}
+
+int64 FAccelByteTelemetrySpillQueue::GetSpillFileSize() const
+{
+	FScopeLock Lock(&QueueLock);
+	return WriteHandle.IsValid() ? FileSize : 0;
+}
@@ -0,0 +1,275 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteUniqueIdCompactCodec.h"
+#include "Misc/Base64.h"
+
+/** Set when the AccelByte ID is stored as a length prefixed string instead of a 16 byte UUID */
+#define COMPACT_ID_FLAG_STRING_ID 0x01
+
+/** Platform type code for a composite without platform type */
+#define COMPACT_ID_PLATFORM_NONE 0
+
+/** Platform type code for a platform type that is not in KnownPlatformTypes, followed by the type string */
+#define COMPACT_ID_PLATFORM_CUSTOM 0xFF
+
+/** Longest string accepted by Decode, anything longer is treated as malformed */
+#define COMPACT_ID_MAX_STRING_LENGTH 1024
+
+/**
+ * Platform types that are encoded as a single byte, the code is the index plus one. Part of the wire format, so entries
+ * may only ever be appended.
+ */
+static const TCHAR* const KnownPlatformTypes[] = {
+	TEXT("STEAM"),
+	TEXT("PS4"),
+	TEXT("PS5"),
+	TEXT("GDK"),
+	TEXT("LIVE"),
+	TEXT("EOS"),
+	TEXT("SWITCH"),
+	TEXT("GOOGLEPLAY"),
+	TEXT("APPLE"),
+	TEXT("ANDROID"),
+	TEXT("IOS"),
+	TEXT("DEVICE"),
+	TEXT("OCULUS")
+};
+
+static void WriteVarUInt(uint32 Value, TArray<uint8>& OutBytes)
+{
+	do
+	{
+		uint8 Byte = Value & 0x7F;
+		Value >>= 7;
+		if (Value != 0)
+		{
+			Byte |= 0x80;
+		}
+		OutBytes.Add(Byte);
+	} while (Value != 0);
+}
+
+static bool ReadVarUInt(uint8 const* Data, int32 Size, int32& Offset, uint32& OutValue)
+{
+	OutValue = 0;
+	for (int32 Shift = 0; Shift < 32; Shift += 7)
+	{
+		if (Offset >= Size)
+		{
+			return false;
+		}
+
+		const uint8 Byte = Data[Offset++];
+		OutValue |= static_cast<uint32>(Byte & 0x7F) << Shift;
+		if ((Byte & 0x80) == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+static void WriteString(FString const& Value, TArray<uint8>& OutBytes)
+{
+	const FTCHARToUTF8 Converted(*Value);
+	WriteVarUInt(static_cast<uint32>(Converted.Length()), OutBytes);
+	OutBytes.Append(reinterpret_cast<uint8 const*>(Converted.Get()), Converted.Length());
+}
+
+static bool ReadString(uint8 const* Data, int32 Size, int32& Offset, FString& OutValue)
+{
+	uint32 Length = 0;
+	if (!ReadVarUInt(Data, Size, Offset, Length) || Length > COMPACT_ID_MAX_STRING_LENGTH || static_cast<int32>(Length) > Size - Offset)
+	{
+		return false;
+	}
+
+	const FUTF8ToTCHAR Converted(reinterpret_cast<ANSICHAR const*>(Data + Offset), Length);
+	OutValue = FString(Converted.Length(), Converted.Get());
+	Offset += Length;
+	return true;
+}
+
+static int32 HexCharToNibble(TCHAR Char)
+{
+	if (Char >= TEXT('0') && Char <= TEXT('9'))
+	{
+		return Char - TEXT('0');
+	}
+	if (Char >= TEXT('a') && Char <= TEXT('f'))
+	{
+		return Char - TEXT('a') + 10;
+	}
+	return INDEX_NONE;
+}
+
+/** Parse a 32 character lowercase hex UUID, uppercase is rejected so that decoding gives back the exact same string */
+static bool TryParseUuid(FString const& Id, uint8 OutBytes[16])
+{
+	if (Id.Len() != 32)
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < 16; Index++)
+	{
+		const int32 High = HexCharToNibble(Id[Index * 2]);
+		const int32 Low = HexCharToNibble(Id[Index * 2 + 1]);
+		if (High == INDEX_NONE || Low == INDEX_NONE)
+		{
+			return false;
+		}
+		OutBytes[Index] = static_cast<uint8>((High << 4) | Low);
+	}
+	return true;
+}
+
+void FAccelByteUniqueIdCompactCodec::Encode(FAccelByteUniqueIdComposite const& CompositeId, TArray<uint8>& OutBytes)
+{
+	uint8 UuidBytes[16];
+	const bool bIsUuid = TryParseUuid(CompositeId.Id, UuidBytes);
+
+	OutBytes.Add(ACCELBYTE_COMPACT_ID_VERSION);
+	OutBytes.Add(bIsUuid ? 0 : COMPACT_ID_FLAG_STRING_ID);
+
+	if (bIsUuid)
+	{
+		OutBytes.Append(UuidBytes, 16);
+	}
+	else
+	{
+		WriteString(CompositeId.Id, OutBytes);
+	}
+
+	if (CompositeId.PlatformType.IsEmpty())
+	{
+		OutBytes.Add(COMPACT_ID_PLATFORM_NONE);
+	}
+	else
+	{
+		uint8 PlatformCode = COMPACT_ID_PLATFORM_CUSTOM;
+		for (int32 Index = 0; Index < static_cast<int32>(UE_ARRAY_COUNT(KnownPlatformTypes)); Index++)
+		{
+			if (CompositeId.PlatformType.Equals(KnownPlatformTypes[Index], ESearchCase::CaseSensitive))
+			{
+				PlatformCode = static_cast<uint8>(Index + 1);
+				break;
+			}
+		}
+
+		OutBytes.Add(PlatformCode);
+		if (PlatformCode == COMPACT_ID_PLATFORM_CUSTOM)
+		{
+			WriteString(CompositeId.PlatformType, OutBytes);
+		}
+	}
+
+	WriteString(CompositeId.PlatformId, OutBytes);
+}
+
+bool FAccelByteUniqueIdCompactCodec::Decode(uint8 const* Data, int32 Size, FAccelByteUniqueIdComposite& OutCompositeId, int32& OutBytesRead)
+{
+	static const TCHAR* const HexDigits = TEXT("0123456789abcdef");
+
+	int32 Offset = 0;
+	if (Data == nullptr || Size < 2 || Data[0] != ACCELBYTE_COMPACT_ID_VERSION || (Data[1] & ~COMPACT_ID_FLAG_STRING_ID) != 0)
+	{
+		return false;
+	}
+	const uint8 Flags = Data[1];
+	Offset = 2;
+
+	FAccelByteUniqueIdComposite CompositeId;
+	if ((Flags & COMPACT_ID_FLAG_STRING_ID) != 0)
+	{
+		if (!ReadString(Data, Size, Offset, CompositeId.Id))
+		{
+			return false;
+		}
+	}
+	else
+	{
+		if (Size - Offset < 16)
+		{
+			return false;
+		}
+
+		TCHAR IdChars[33];
+		for (int32 Index = 0; Index < 16; Index++)
+		{
+			IdChars[Index * 2] = HexDigits[Data[Offset + Index] >> 4];
+			IdChars[Index * 2 + 1] = HexDigits[Data[Offset + Index] & 0x0F];
+		}
+		IdChars[32] = TEXT('\0');
+		CompositeId.Id = IdChars;
+		Offset += 16;
+	}
+
+	if (Offset >= Size)
+	{
+		return false;
+	}
+
+	const uint8 PlatformCode = Data[Offset++];
+	if (PlatformCode == COMPACT_ID_PLATFORM_CUSTOM)
+	{
+		if (!ReadString(Data, Size, Offset, CompositeId.PlatformType))
+		{
+			return false;
+		}
+	}
+	else if (PlatformCode != COMPACT_ID_PLATFORM_NONE)
+	{
+		if (PlatformCode > static_cast<int32>(UE_ARRAY_COUNT(KnownPlatformTypes)))
+		{
+			return false;
+		}
+		CompositeId.PlatformType = KnownPlatformTypes[PlatformCode - 1];
+	}
+
+	if (!ReadString(Data, Size, Offset, CompositeId.PlatformId))
+	{
+		return false;
+	}
+
+	OutCompositeId = MoveTemp(CompositeId);
+	OutBytesRead = Offset;
+	return true;
+}
+
+FString FAccelByteUniqueIdCompactCodec::EncodeToString(FAccelByteUniqueIdComposite const& CompositeId)
+{
+	TArray<uint8> Bytes;
+	Encode(CompositeId, Bytes);
+	return ACCELBYTE_COMPACT_ID_PREFIX + FBase64::Encode(Bytes);
+}
+
+bool FAccelByteUniqueIdCompactCodec::DecodeFromString(FString const& InString, FAccelByteUniqueIdComposite& OutCompositeId)
+{
+	if (!IsCompactString(InString))
+	{
+		return false;
+	}
+
+	TArray<uint8> Bytes;
+	if (!FBase64::Decode(InString.RightChop(1), Bytes))
+	{
+		return false;
+	}
+
+	// Trailing bytes mean that this is not a single encoded ID
+	int32 BytesRead = 0;
+	return Decode(Bytes.GetData(), Bytes.Num(), OutCompositeId, BytesRead) && BytesRead == Bytes.Num();
+}
+
+bool FAccelByteUniqueIdCompactCodec::IsCompactString(FString const& InString)
+{
+	return InString.StartsWith(ACCELBYTE_COMPACT_ID_PREFIX, ESearchCase::CaseSensitive);
+}
+
+#undef COMPACT_ID_FLAG_STRING_ID
+#undef COMPACT_ID_PLATFORM_NONE
+#undef COMPACT_ID_PLATFORM_CUSTOM
+#undef COMPACT_ID_MAX_STRING_LENGTH
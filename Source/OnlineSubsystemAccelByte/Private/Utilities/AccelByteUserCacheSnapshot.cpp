@@ -0,0 +1,420 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Utilities/AccelByteUserCacheSnapshot.h"
+#include "Utilities/AccelByteUniqueIdCompactCodec.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+
+/** "ABUC" read as a little endian uint32 */
+#define USER_CACHE_SNAPSHOT_MAGIC 0x43554241
+
+/** Size of the header fields in front of the namespace and base URL */
+#define USER_CACHE_SNAPSHOT_HEADER_PREFIX_SIZE 24
+
+/** Size of a header with an empty namespace and base URL, the smallest header that can be valid */
+#define USER_CACHE_SNAPSHOT_MIN_HEADER_SIZE 32
+
+/** Size of the body size and body CRC fields in front of every record body */
+#define USER_CACHE_SNAPSHOT_RECORD_PREFIX_SIZE 8
+
+/** Highest record count accepted on read, anything above is treated as a corrupt header */
+#define USER_CACHE_SNAPSHOT_MAX_RECORD_COUNT (1 << 20)
+
+/** Highest amount of linked platform entries stored for a single user */
+#define USER_CACHE_SNAPSHOT_MAX_LINKED_PLATFORMS 255
+
+static void WriteUInt16(uint16 Value, TArray<uint8>& OutBytes)
+{
+	OutBytes.Add(static_cast<uint8>(Value));
+	OutBytes.Add(static_cast<uint8>(Value >> 8));
+}
+
+static void WriteUInt32(uint32 Value, TArray<uint8>& OutBytes)
+{
+	for (int32 Shift = 0; Shift < 32; Shift += 8)
+	{
+		OutBytes.Add(static_cast<uint8>(Value >> Shift));
+	}
+}
+
+static void WriteUInt64(uint64 Value, TArray<uint8>& OutBytes)
+{
+	for (int32 Shift = 0; Shift < 64; Shift += 8)
+	{
+		OutBytes.Add(static_cast<uint8>(Value >> Shift));
+	}
+}
+
+static void PatchUInt32(uint32 Value, TArray<uint8>& Bytes, int32 Offset)
+{
+	for (int32 Index = 0; Index < 4; Index++)
+	{
+		Bytes[Offset + Index] = static_cast<uint8>(Value >> (Index * 8));
+	}
+}
+
+/** Write a string as a uint16 length and UTF-8 bytes, strings too long to fit are written as empty */
+static void WriteString(const FString& Value, TArray<uint8>& OutBytes)
+{
+	const FTCHARToUTF8 Converted(*Value);
+	if (Converted.Length() > MAX_uint16)
+	{
+		WriteUInt16(0, OutBytes);
+		return;
+	}
+
+	WriteUInt16(static_cast<uint16>(Converted.Length()), OutBytes);
+	OutBytes.Append(reinterpret_cast<uint8 const*>(Converted.Get()), Converted.Length());
+}
+
+static uint32 ReadUInt32(uint8 const* Data)
+{
+	return static_cast<uint32>(Data[0]) | (static_cast<uint32>(Data[1]) << 8) | (static_cast<uint32>(Data[2]) << 16) | (static_cast<uint32>(Data[3]) << 24);
+}
+
+static uint64 ReadUInt64(uint8 const* Data)
+{
+	return static_cast<uint64>(ReadUInt32(Data)) | (static_cast<uint64>(ReadUInt32(Data + 4)) << 32);
+}
+
+/**
+ * Bounds checked reader over a single record body
+ */
+struct FSnapshotRecordReader
+{
+	uint8 const* Data;
+	int32 Size;
+	int32 Offset = 0;
+
+	FSnapshotRecordReader(uint8 const* InData, int32 InSize)
+		: Data(InData)
+		, Size(InSize)
+	{
+	}
+
+	bool ReadUInt8(uint8& OutValue)
+	{
+		if (Size - Offset < 1)
+		{
+			return false;
+		}
+		OutValue = Data[Offset++];
+		return true;
+	}
+
+	bool ReadInt64(int64& OutValue)
+	{
+		if (Size - Offset < 8)
+		{
+			return false;
+		}
+		OutValue = static_cast<int64>(ReadUInt64(Data + Offset));
+		Offset += 8;
+		return true;
+	}
+
+	bool ReadString(FString& OutValue)
+	{
+		if (Size - Offset < 2)
+		{
+			return false;
+		}
+
+		const int32 Length = static_cast<int32>(Data[Offset]) | (static_cast<int32>(Data[Offset + 1]) << 8);
+		Offset += 2;
+		if (Size - Offset < Length)
+		{
+			return false;
+		}
+
+		const FUTF8ToTCHAR Converted(reinterpret_cast<ANSICHAR const*>(Data + Offset), Length);
+		OutValue = FString(Converted.Length(), Converted.Get());
+		Offset += Length;
+		return true;
+	}
+
+	bool ReadCompositeId(FAccelByteUniqueIdComposite& OutCompositeId)
+	{
+		int32 BytesRead = 0;
+		if (!FAccelByteUniqueIdCompactCodec::Decode(Data + Offset, Size - Offset, OutCompositeId, BytesRead))
+		{
+			return false;
+		}
+		Offset += BytesRead;
+		return true;
+	}
+};
+
+static bool ReadRecordBody(uint8 const* Data, int32 Size, FAccelByteUserInfoPtr& OutUser, int64& OutLastUpdatedTicks)
+{
+	FSnapshotRecordReader Reader(Data, Size);
+
+	FAccelByteUniqueIdComposite CompositeId;
+	if (!Reader.ReadCompositeId(CompositeId) || CompositeId.Id.IsEmpty())
+	{
+		return false;
+	}
+
+	FAccelByteUserInfoRef User = MakeShared<FAccelByteUserInfo, ESPMode::ThreadSafe>();
+	uint8 LinkedPlatformCount = 0;
+	if (!Reader.ReadInt64(OutLastUpdatedTicks)
+		|| !Reader.ReadString(User->DisplayName)
+		|| !Reader.ReadString(User->UniqueDisplayName)
+		|| !Reader.ReadString(User->PublicCode)
+		|| !Reader.ReadString(User->GameAvatarUrl)
+		|| !Reader.ReadString(User->PublisherAvatarUrl)
+		|| !Reader.ReadUInt8(LinkedPlatformCount))
+	{
+		return false;
+	}
+
+	User->LinkedPlatformInfo.Reserve(LinkedPlatformCount);
+	for (int32 Index = 0; Index < LinkedPlatformCount; Index++)
+	{
+		FAccelByteUniqueIdComposite LinkedCompositeId;
+		FAccelByteLinkedUserInfo LinkedInfo;
+		if (!Reader.ReadCompositeId(LinkedCompositeId)
+			|| !Reader.ReadString(LinkedInfo.PlatformId)
+			|| !Reader.ReadString(LinkedInfo.DisplayName)
+			|| !Reader.ReadString(LinkedInfo.AvatarUrl))
+		{
+			return false;
+		}
+
+		LinkedInfo.Id = FUniqueNetIdAccelByteUser::Create(LinkedCompositeId);
+		User->LinkedPlatformInfo.Add(LinkedInfo);
+	}
+
+	// A body with trailing bytes was not written by this version
+	if (Reader.Offset != Size || OutLastUpdatedTicks < 0 || OutLastUpdatedTicks > FDateTime::MaxValue().GetTicks())
+	{
+		return false;
+	}
+
+	User->Id = FUniqueNetIdAccelByteUser::Create(CompositeId);
+	OutUser = User;
+	return true;
+}
+
+FAccelByteUserCacheSnapshot::FAccelByteUserCacheSnapshot(const FString& InNamespace, const FString& InBaseUrl)
+	: Namespace(InNamespace)
+	, BaseUrl(InBaseUrl)
+{
+}
+
+void FAccelByteUserCacheSnapshot::AddUser(const FAccelByteUserInfo& User)
+{
+	if (!User.Id.IsValid() || User.Id->GetAccelByteId().IsEmpty())
+	{
+		return;
+	}
+
+	const int32 RecordOffset = Records.Num();
+
+	// Reserve the body size and CRC, patched in once the body is written
+	WriteUInt32(0, Records);
+	WriteUInt32(0, Records);
+	const int32 BodyOffset = Records.Num();
+
+	FAccelByteUniqueIdCompactCodec::Encode(User.Id->GetCompositeStructure(), Records);
+	WriteUInt64(static_cast<uint64>(User.LastUpdatedTime.GetTicks()), Records);
+	WriteString(User.DisplayName, Records);
+	WriteString(User.UniqueDisplayName, Records);
+	WriteString(User.PublicCode, Records);
+	WriteString(User.GameAvatarUrl, Records);
+	WriteString(User.PublisherAvatarUrl, Records);
+
+	TArray<const FAccelByteLinkedUserInfo*> LinkedPlatforms;
+	for (const FAccelByteLinkedUserInfo& LinkedInfo : User.LinkedPlatformInfo)
+	{
+		if (LinkedInfo.Id.IsValid() && LinkedPlatforms.Num() < USER_CACHE_SNAPSHOT_MAX_LINKED_PLATFORMS)
+		{
+			LinkedPlatforms.Add(&LinkedInfo);
+		}
+	}
+
+	Records.Add(static_cast<uint8>(LinkedPlatforms.Num()));
+	for (const FAccelByteLinkedUserInfo* LinkedInfo : LinkedPlatforms)
+	{
+		FAccelByteUniqueIdCompactCodec::Encode(LinkedInfo->Id->GetCompositeStructure(), Records);
+		WriteString(LinkedInfo->PlatformId, Records);
+		WriteString(LinkedInfo->DisplayName, Records);
+		WriteString(LinkedInfo->AvatarUrl, Records);
+	}
+
+	const int32 BodySize = Records.Num() - BodyOffset;
+	PatchUInt32(static_cast<uint32>(BodySize), Records, RecordOffset);
+	PatchUInt32(FCrc::MemCrc32(Records.GetData() + BodyOffset, BodySize), Records, RecordOffset + 4);
+
+	RecordOffsets.Add(static_cast<uint32>(RecordOffset));
+}
+
+int32 FAccelByteUserCacheSnapshot::GetHeaderSize() const
+{
+	TArray<uint8> ScopeBytes;
+	WriteString(Namespace, ScopeBytes);
+	WriteString(BaseUrl, ScopeBytes);
+	return USER_CACHE_SNAPSHOT_HEADER_PREFIX_SIZE + ScopeBytes.Num() + 4;
+}
+
+void FAccelByteUserCacheSnapshot::Serialize(TArray<uint8>& OutBytes) const
+{
+	const int32 HeaderSize = GetHeaderSize();
+	OutBytes.Reset(HeaderSize + RecordOffsets.Num() * 4 + Records.Num());
+
+	WriteUInt32(USER_CACHE_SNAPSHOT_MAGIC, OutBytes);
+	WriteUInt16(ACCELBYTE_USER_CACHE_SNAPSHOT_VERSION, OutBytes);
+	WriteUInt16(static_cast<uint16>(HeaderSize), OutBytes);
+	WriteUInt32(static_cast<uint32>(RecordOffsets.Num()), OutBytes);
+	WriteUInt32(static_cast<uint32>(Records.Num()), OutBytes);
+	WriteUInt64(static_cast<uint64>(FDateTime::UtcNow().GetTicks()), OutBytes);
+	WriteString(Namespace, OutBytes);
+	WriteString(BaseUrl, OutBytes);
+	WriteUInt32(FCrc::MemCrc32(OutBytes.GetData(), OutBytes.Num()), OutBytes);
+
+	for (const uint32 RecordOffset : RecordOffsets)
+	{
+		WriteUInt32(RecordOffset, OutBytes);
+	}
+
+	OutBytes.Append(Records);
+}
+
+bool FAccelByteUserCacheSnapshot::Deserialize(uint8 const* Data, int64 Size, const FString& Namespace, const FString& BaseUrl, TArray<FAccelByteUserInfoRef>& OutUsers, int32& OutCorruptRecordCount)
+{
+	OutCorruptRecordCount = 0;
+
+	if (Data == nullptr || Size < USER_CACHE_SNAPSHOT_MIN_HEADER_SIZE || ReadUInt32(Data) != USER_CACHE_SNAPSHOT_MAGIC)
+	{
+		return false;
+	}
+
+	const uint16 Version = static_cast<uint16>(Data[4] | (Data[5] << 8));
+	const uint16 HeaderSize = static_cast<uint16>(Data[6] | (Data[7] << 8));
+	if (HeaderSize < USER_CACHE_SNAPSHOT_MIN_HEADER_SIZE || HeaderSize > Size
+		|| ReadUInt32(Data + HeaderSize - 4) != FCrc::MemCrc32(Data, HeaderSize - 4))
+	{
+		return false;
+	}
+
+	const uint32 RecordCount = ReadUInt32(Data + 8);
+	const int64 RecordAreaSize = ReadUInt32(Data + 12);
+	if (Version != ACCELBYTE_USER_CACHE_SNAPSHOT_VERSION || RecordCount > USER_CACHE_SNAPSHOT_MAX_RECORD_COUNT)
+	{
+		return false;
+	}
+
+	// The namespace and base URL fill the rest of the header, a snapshot written for another environment is discarded
+	FSnapshotRecordReader ScopeReader(Data + USER_CACHE_SNAPSHOT_HEADER_PREFIX_SIZE, HeaderSize - USER_CACHE_SNAPSHOT_HEADER_PREFIX_SIZE - 4);
+	FString SnapshotNamespace;
+	FString SnapshotBaseUrl;
+	if (!ScopeReader.ReadString(SnapshotNamespace) || !ScopeReader.ReadString(SnapshotBaseUrl) || ScopeReader.Offset != ScopeReader.Size
+		|| SnapshotNamespace != Namespace || SnapshotBaseUrl != BaseUrl)
+	{
+		return false;
+	}
+
+	const int64 OffsetTableStart = HeaderSize;
+	const int64 RecordAreaStart = OffsetTableStart + static_cast<int64>(RecordCount) * 4;
+	if (RecordAreaStart > Size)
+	{
+		return false;
+	}
+
+	// A truncated file keeps every record that still fits, the records past the end are counted as corrupt
+	const int64 AvailableRecordAreaSize = FMath::Min(RecordAreaSize, Size - RecordAreaStart);
+	uint8 const* RecordArea = Data + RecordAreaStart;
+
+	OutUsers.Reserve(OutUsers.Num() + RecordCount);
+	for (uint32 RecordIndex = 0; RecordIndex < RecordCount; RecordIndex++)
+	{
+		const int64 RecordOffset = ReadUInt32(Data + OffsetTableStart + RecordIndex * 4);
+		if (RecordOffset + USER_CACHE_SNAPSHOT_RECORD_PREFIX_SIZE > AvailableRecordAreaSize)
+		{
+			OutCorruptRecordCount++;
+			continue;
+		}
+
+		const int64 BodySize = ReadUInt32(RecordArea + RecordOffset);
+		const uint32 BodyCrc = ReadUInt32(RecordArea + RecordOffset + 4);
+		const int64 BodyOffset = RecordOffset + USER_CACHE_SNAPSHOT_RECORD_PREFIX_SIZE;
+		if (BodySize > AvailableRecordAreaSize - BodyOffset || BodySize > MAX_int32)
+		{
+			OutCorruptRecordCount++;
+			continue;
+		}
+
+		uint8 const* Body = RecordArea + BodyOffset;
+		if (FCrc::MemCrc32(Body, static_cast<int32>(BodySize)) != BodyCrc)
+		{
+			OutCorruptRecordCount++;
+			continue;
+		}
+
+		FAccelByteUserInfoPtr User;
+		int64 LastUpdatedTicks = 0;
+		if (!ReadRecordBody(Body, static_cast<int32>(BodySize), User, LastUpdatedTicks))
+		{
+			OutCorruptRecordCount++;
+			continue;
+		}
+
+		User->LastUpdatedTime = FDateTime(LastUpdatedTicks);
+		OutUsers.Add(User.ToSharedRef());
+	}
+
+	return true;
+}
+
+bool FAccelByteUserCacheSnapshot::SaveToFile(const FString& FilePath, const TArray<uint8>& Bytes)
+{
+	const FString TempFilePath = FilePath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempFilePath))
+	{
+		return false;
+	}
+
+	if (!IFileManager::Get().Move(*FilePath, *TempFilePath, true, true))
+	{
+		IFileManager::Get().Delete(*TempFilePath);
+		return false;
+	}
+
+	return true;
+}
+
+bool FAccelByteUserCacheSnapshot::LoadFromFile(const FString& FilePath, const FString& Namespace, const FString& BaseUrl, TArray<FAccelByteUserInfoRef>& OutUsers, int32& OutCorruptRecordCount)
+{
+	OutCorruptRecordCount = 0;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*FilePath))
+	{
+		return false;
+	}
+
+	// Map the file where possible, so that only the pages holding records that are actually read get loaded
+	TUniquePtr<IMappedFileHandle> MappedFile(PlatformFile.OpenMapped(*FilePath));
+	if (MappedFile.IsValid() && MappedFile->GetFileSize() > 0)
+	{
+		TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+		if (MappedRegion.IsValid())
+		{
+			return Deserialize(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize(), Namespace, BaseUrl, OutUsers, OutCorruptRecordCount);
+		}
+	}
+
+	// Platforms without memory mapped files fall back to reading the whole file
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+	{
+		return false;
+	}
+
+	return Deserialize(Bytes.GetData(), Bytes.Num(), Namespace, BaseUrl, OutUsers, OutCorruptRecordCount);
+}
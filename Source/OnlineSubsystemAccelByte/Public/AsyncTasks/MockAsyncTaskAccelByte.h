@@ -46,6 +46,15 @@ struct MockAsyncTaskParameter
 
 	/// The parent task will rely to this to compare it with ChildReportComplete count
 	uint32 ChildCount = 0;
+
+	// Priority class this task is scheduled under when dispatched in parallel
+	EAccelByteAsyncTaskPriority Priority = EAccelByteAsyncTaskPriority::Normal;
+
+	// Key used to coalesce identical mock tasks that are in flight at the same time, empty to never coalesce
+	FString CoalescingKey = {};
+
+	// Times this task actually started its work, coalesced tasks never start
+	uint32 StartedCount = 0;
 };
 
 class ONLINESUBSYSTEMACCELBYTE_API FMockAsyncTaskAccelByte
@@ -70,6 +79,16 @@ public:
 	
 	virtual void Initialize() override;
 
+	virtual EAccelByteAsyncTaskPriority GetTaskPriority() const override
+	{
+		return Parameter.Priority;
+	}
+
+	virtual FString GetCoalescingKey() const override
+	{
+		return Parameter.CoalescingKey;
+	}
+
 	// Used to ensure the child task really complete before we can consider the current task completion
 	void ChildReportComplete() { ChildCompleteReportedCount.Increment(); }
 
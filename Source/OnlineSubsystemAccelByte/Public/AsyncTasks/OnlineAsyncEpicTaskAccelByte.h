@@ -4,7 +4,6 @@
 
 #pragma once
 
-#include "Containers/List.h"
 #include "OnlineAsyncTaskAccelByte.h"
 #include "AsyncTasks/OnlineAsyncTaskAccelByteUtils.h"
 #include "OnlineAsyncTaskManager.h"
@@ -19,7 +18,6 @@ class FOnlineAsyncEpicTaskAccelByte
 	, public AccelByte::TSelfPtr<FOnlineAsyncEpicTaskAccelByte, ESPMode::ThreadSafe>
 {
 	uint32 EpicID = 0;
-	TDoubleLinkedList<TArray<FOnlineAsyncTaskAccelByte*>> TaskContainer;
 
 public:
 	FOnlineAsyncEpicTaskAccelByte(FOnlineSubsystemAccelByte* const InABSubsystem, int32 InLocalUserNum, const FVoidHandler& InDelegate) 
@@ -40,14 +38,14 @@ public:
 	/** Set the current Task/Epic as timeout along with all the task in the TaskContainer */
 	void Timeout();
 	
-	uint32 GetCurrentStackCapacity() { return TaskContainer.Num(); }
+	uint32 GetCurrentStackCapacity() { return StackCount; }
 
 	//TODO cyclic checking 
 	//recursively check GetParentTask(...) , collect it, and detect it etc.
 	void Enqueue(ETypeOfOnlineAsyncTask TaskType, FOnlineAsyncTaskAccelByte* ChildTask);
 
-	/** For test assertion purpose */
-	const TDoubleLinkedList<TArray<FOnlineAsyncTaskAccelByte*>>& GetTaskContainer() { return TaskContainer; }
+	/** For test assertion purpose, copy of every stack from the top to the bottom */
+	TArray<TArray<FOnlineAsyncTaskAccelByte*>> GetTaskContainer() const;
 
 protected:
 
@@ -57,8 +55,51 @@ protected:
 		return Name;
 	}
 
+	virtual FString GetMetricsName() const override
+	{
+		return TEXT("FOnlineAsyncEpicTaskAccelByte");
+	}
+
 private:
-	bool bIsTopStackRunning();
+	/**
+	 * Tasks that run together, only the stack at the top is ticked. Stacks live in StackPool and are linked by index, a
+	 * released stack keeps its task array allocation so that it can be reused by the next stack without allocating.
+	 */
+	struct FTaskStack
+	{
+		TArray<FOnlineAsyncTaskAccelByte*, TInlineAllocator<4>> Tasks;
+		int32 PrevIndex = INDEX_NONE;
+		int32 NextIndex = INDEX_NONE;
+
+		/** Whether this stack has been ticked at the top, serial tasks are inserted above the first started stack */
+		bool bHasStarted = false;
+	};
+
+	/** Storage for every stack, linked or free */
+	TArray<FTaskStack> StackPool;
+
+	/** Indices of StackPool entries that are not linked */
+	TArray<int32> FreeStackIndices;
+
+	int32 TopStackIndex = INDEX_NONE;
+	int32 BottomStackIndex = INDEX_NONE;
+
+	/**
+	 * Last stack of the run of not yet started stacks at the top, INDEX_NONE if the top stack has started. Serial tasks
+	 * are inserted right below it, which keeps them in FIFO order above the stack that is running.
+	 */
+	int32 LastPendingStackIndex = INDEX_NONE;
+
+	uint32 StackCount = 0;
+
+	/** Take a stack from the pool holding only the given task, the stack is not linked yet */
+	int32 AcquireStack(FOnlineAsyncTaskAccelByte* Task);
+
+	/** Link an acquired stack below InsertAfterIndex, or at the top if InsertAfterIndex is INDEX_NONE */
+	void LinkStack(int32 StackIndex, int32 InsertAfterIndex);
+
+	/** Unlink a stack and return it to the pool */
+	void ReleaseStack(int32 StackIndex);
 	
 	double GetWorldDelta();
 
@@ -242,6 +242,7 @@ public:
 	virtual void Initialize() override
 	{
 		CurrentState = EAccelByteAsyncTaskState::Initializing;
+		StartTimeInSeconds = FPlatformTime::Seconds();
 
 		// We only care about setting the last update time if we are using a timeout
 		if (bShouldUseTimeout)
@@ -298,6 +299,48 @@ public:
 	}
 
 	EAccelByteAsyncTaskState GetCurrentState() { return CurrentState; }
+
+	/**
+	 * Priority class that this task is scheduled under when dispatched in parallel. Override in tasks that sit on the
+	 * login or session critical path, or in tasks that are safe to delay behind other work.
+	 */
+	virtual EAccelByteAsyncTaskPriority GetTaskPriority() const
+	{
+		return EAccelByteAsyncTaskPriority::Normal;
+	}
+
+	/**
+	 * Key identifying the logical request made by this task, built from the task name and its parameters. Tasks with the
+	 * same key that are dispatched while one of them is still in flight are coalesced, meaning that only the first one
+	 * reaches the backend and the others complete with its result.
+	 *
+	 * Empty by default, meaning that the task is never coalesced. Tasks overriding this should also override
+	 * CopyCoalescedResult, as a coalesced task never runs Initialize or Tick on its own.
+	 */
+	virtual FString GetCoalescingKey() const
+	{
+		return TEXT("");
+	}
+
+	/**
+	 * Complete this task with the outcome of the identical task that was already in flight when this task was dispatched.
+	 * Called by the async task manager as soon as the in flight task completes.
+	 */
+	void CompleteAsCoalescedTask(const FOnlineAsyncTaskAccelByte& InFlightTask)
+	{
+		bIsCoalesced = true;
+		if (LocalUserNum == INVALID_CONTROLLERID)
+		{
+			LocalUserNum = InFlightTask.LocalUserNum;
+		}
+		if (!UserId.IsValid())
+		{
+			UserId = InFlightTask.UserId;
+		}
+
+		CopyCoalescedResult(InFlightTask);
+		CompleteTask(InFlightTask.CompleteState);
+	}
 	
 	int32 GetLocalUserNum() { return LocalUserNum; }
 
@@ -360,6 +403,15 @@ protected:
 	/** Epic for this task */
 	FOnlineAsyncEpicTaskAccelByte* Epic = nullptr;
 
+	/** Whether this task was completed with the result of another identical task, see CompleteAsCoalescedTask */
+	bool bIsCoalesced = false;
+
+	/** Time in seconds when this task was created, used for the queue wait metric */
+	double DispatchTimeInSeconds = FPlatformTime::Seconds();
+
+	/** Time in seconds when this task was initialized, zero if it completed without ever being initialized */
+	double StartTimeInSeconds = 0.0;
+
 	/**
 	 * Basic method to get the current name of the task, used for ToString on tasks as well as trace logs.
 	 *
@@ -389,6 +441,18 @@ protected:
 		CompleteState = InCompleteState;
 		bWasSuccessful = (CompleteState == EAccelByteAsyncTaskCompleteState::Success);
 		bIsComplete = true;
+
+		RecordCompletionMetrics();
+		ReportCompletionToTaskManager();
+	}
+
+	/**
+	 * Name that this task is aggregated under in the async task metrics. Defaults to the task name, override if the task
+	 * name is unique per instance.
+	 */
+	virtual FString GetMetricsName() const
+	{
+		return GetTaskName();
 	}
 
 	/**
@@ -559,6 +623,35 @@ protected:
 	 */
 	virtual void OnTaskStartWorking() {}
 
+	/**
+	 * Copy the result of an identical in flight task into this task, so that Finalize and TriggerDelegates behave as if
+	 * this task made the request itself. The in flight task is guaranteed to be of the same class, as the task name is
+	 * part of the coalescing key.
+	 */
+	virtual void CopyCoalescedResult(const FOnlineAsyncTaskAccelByte& InFlightTask) {}
+
+	/** Whether this task was completed with the result of another identical task rather than its own request */
+	bool IsCoalesced() const
+	{
+		return bIsCoalesced;
+	}
+
+	/**
+	 * Build the portion of a coalescing key for a list of user IDs, sorted so that the same set of users gives the same key
+	 * no matter the order that they were passed in.
+	 */
+	static FString GetCoalescingKeyForUserIds(const TArray<FUniqueNetIdRef>& UserIds)
+	{
+		TArray<FString> IdStrings;
+		IdStrings.Reserve(UserIds.Num());
+		for (const FUniqueNetIdRef& Id : UserIds)
+		{
+			IdStrings.Add(Id->ToString());
+		}
+		IdStrings.Sort();
+		return FString::Join(IdStrings, TEXT(","));
+	}
+
 	/**
 	 * Whether or not this task has the flag specified.
 	 */
@@ -575,6 +668,15 @@ protected:
 	*/
 	void ExecuteCriticalSectionAction(FVoidHandler Action);
 
+	/** Report queue wait and execution time of this task to the subsystem's async task metrics */
+	void RecordCompletionMetrics();
+
+	/**
+	 * Let the async task manager know that this task completed, so that it releases the scheduler slot held by this task
+	 * and completes any identical tasks that were coalesced into it.
+	 */
+	void ReportCompletionToTaskManager();
+
 private:
 	/** API client that should be used for this task, use API_CLIENT_CHECK_GUARD() to get a valid instance */
 	AccelByte::FApiClientPtr ApiClientInternal;
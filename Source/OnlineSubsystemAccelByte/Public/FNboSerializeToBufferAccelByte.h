@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "OnlineSubsystemAccelByteTypes.h"
+#include "Utilities/AccelByteUniqueIdCompactCodec.h"
 #if !(ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1)
 #include "NboSerializer.h"
 #else
@@ -35,6 +36,15 @@ public:
 	{
 	}
 
+	/**
+	 * Write user IDs in their compact string form instead of the legacy Base64 JSON form. Readers accept both forms, but
+	 * only readers that know the compact form, so this should stay off while older clients may read the packet.
+	 */
+	void SetUseCompactUniqueIds(bool bInUseCompactUniqueIds)
+	{
+		bUseCompactUniqueIds = bInUseCompactUniqueIds;
+	}
+
 	friend inline FNboSerializeToBufferAccelByte& operator<<(FNboSerializeToBufferAccelByte& Ar, const FOnlineSessionInfoAccelByteV1& SessionInfo)
 	{
 		check(SessionInfo.GetHostAddr().IsValid());
@@ -45,7 +55,14 @@ public:
 
 	friend inline FNboSerializeToBufferAccelByte& operator<<(FNboSerializeToBufferAccelByte& Ar, const FUniqueNetIdAccelByteUser& UniqueId)
 	{
-		((FNboSerializeToBuffer&)Ar) << UniqueId.UniqueNetIdStr;
+		if (Ar.bUseCompactUniqueIds && UniqueId.IsValid())
+		{
+			((FNboSerializeToBuffer&)Ar) << UniqueId.ToCompactString();
+		}
+		else
+		{
+			((FNboSerializeToBuffer&)Ar) << UniqueId.UniqueNetIdStr;
+		}
 		return Ar;
 	}
 
@@ -54,6 +71,9 @@ public:
 		((FNboSerializeToBuffer&)Ar) << UniqueId.UniqueNetIdStr;
 		return Ar;
 	}
+
+private:
+	bool bUseCompactUniqueIds = false;
 };
 
 class FNboSerializeFromBufferAccelByte 
@@ -85,6 +105,12 @@ public:
 	friend inline FNboSerializeFromBufferAccelByte& operator>>(FNboSerializeFromBufferAccelByte& Ar, FUniqueNetIdAccelByteUser& UniqueId)
 	{
 		Ar >> UniqueId.UniqueNetIdStr;
+
+		// Keep the legacy form in the ID itself, so that ToString stays the same whichever form was sent
+		if (FAccelByteUniqueIdCompactCodec::IsCompactString(UniqueId.UniqueNetIdStr))
+		{
+			UniqueId.UniqueNetIdStr = FUniqueNetIdAccelByteUser::Create(UniqueId.UniqueNetIdStr)->ToString();
+		}
 		return Ar;
 	}
 
@@ -5,8 +5,14 @@
 #pragma once
 
 #include "OnlineAsyncTaskManager.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include "Containers/Queue.h"
 
 class FOnlineSubsystemAccelByte;
+class FOnlineAsyncTaskAccelByte;
+
+/** Number of values in EAccelByteAsyncTaskPriority, used to size the per priority scheduler state */
+#define AB_ASYNC_TASK_PRIORITY_COUNT 3
 
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineAsyncTaskManagerAccelByte : public FOnlineAsyncTaskManager
 {
@@ -15,17 +21,133 @@ public:
 	/** Constructor to set up the cached parent subsystem for this manager instance */
 	FOnlineAsyncTaskManagerAccelByte(FOnlineSubsystemAccelByte* ParentSubsystem);
 
-	virtual ~FOnlineAsyncTaskManagerAccelByte() = default;
+	virtual ~FOnlineAsyncTaskManagerAccelByte();
 
 	void OnlineTick() override;
 
-	void CheckMaxParallelTasks();
+	/**
+	 * Add a parallel task under the given priority class.
+	 *
+	 * The task is handed to the parallel task list right away if its class has a free slot and nothing of the same class
+	 * is already waiting. Otherwise it is put in the pending queue of its class, and admitted from OnlineTick once a slot
+	 * frees up.
+	 *
+	 * @param NewTask Task that we want to run in parallel
+	 * @param Priority Priority class that the task is scheduled under
+	 */
+	void AddToParallelTasksWithPriority(FOnlineAsyncTask* NewTask, EAccelByteAsyncTaskPriority Priority);
+
+	/**
+	 * Release the scheduler slot held by a task, so that the next pending task of its class can be admitted on the
+	 * following OnlineTick. Called by FOnlineAsyncTaskAccelByte once it completes, as the base manager removes finished
+	 * tasks from the parallel task list without going through any overridable method. Does nothing for tasks that hold
+	 * no slot, or that already released it.
+	 *
+	 * @param CompletedTask Task that just completed
+	 */
+	void ReleaseParallelTaskSlot(FOnlineAsyncTask* CompletedTask);
+
+	/** Get the amount of tasks of the given priority class waiting for a slot */
+	int32 GetPendingParallelTaskCount(EAccelByteAsyncTaskPriority Priority) const;
+
+	/** Get the amount of tasks of the given priority class that have been admitted and are still running */
+	int32 GetActiveParallelTaskCount(EAccelByteAsyncTaskPriority Priority) const;
+
+	/** Get the limit of in-flight parallel tasks for a priority class, zero or below means unbounded */
+	int32 GetMaxParallelTasksForPriority(EAccelByteAsyncTaskPriority Priority) const;
+
+	/**
+	 * Override the limit of in-flight parallel tasks for a priority class.
+	 *
+	 * @param Priority Priority class to set the limit for
+	 * @param Limit Maximum amount of in-flight tasks of that class, zero or below means unbounded
+	 */
+	void SetMaxParallelTasksForPriority(EAccelByteAsyncTaskPriority Priority, int32 Limit);
+
+	/**
+	 * Attach a task to an identical task that is already in flight, identified by FOnlineAsyncTaskAccelByte::GetCoalescingKey.
+	 * If no identical task is in flight, the task is registered as the one that later identical tasks will attach to.
+	 *
+	 * @param NewTask Task that is about to be dispatched
+	 * @return true if the task was attached and must not be dispatched, false if it should be dispatched as usual
+	 */
+	bool TryCoalesceTask(FOnlineAsyncTaskAccelByte* NewTask);
+
+	/** Get the amount of tasks currently attached to an in flight task with the given coalescing key */
+	int32 GetCoalescedTaskCount(const FString& CoalescingKey) const;
+
+	/**
+	 * Complete every task attached to an in flight task with its result, and move them to the out queue. Called by
+	 * FOnlineAsyncTaskAccelByte as soon as it completes, while its result is still there to copy, as the base manager
+	 * moves finished tasks to the out queue without going through any overridable method. Does nothing for tasks that
+	 * were not registered as in flight.
+	 *
+	 * Attached tasks may reach the out queue ahead of the in flight task, each of them finalizes from its own copy of
+	 * the result.
+	 *
+	 * @param CompletedTask Task that just completed
+	 */
+	void CompleteCoalescedTasks(FOnlineAsyncTaskAccelByte* CompletedTask);
 
 private:
 
+	/** An in flight task along with the identical tasks waiting on its result */
+	struct FCoalescedTaskGroup
+	{
+		FOnlineAsyncTaskAccelByte* InFlightTask = nullptr;
+		TArray<FOnlineAsyncTaskAccelByte*> AttachedTasks;
+	};
+
+	/** Coalesced task groups keyed by the coalescing key of their in flight task */
+	TMap<FString, FCoalescedTaskGroup> CoalescedTaskGroups;
+
+	/** Coalescing key of each registered in flight task, used to find its group once it completes */
+	TMap<FOnlineAsyncItem*, FString> CoalescingKeyByInFlightTask;
+
+	/** Lock guarding the coalescing state above */
+	mutable FCriticalSection CoalescingLock;
+
 	/** Pointer to subsystem instance that constructed this manager */
 	FOnlineSubsystemAccelByte* AccelByteSubsystem;
 
 	/** How long Task elapsed can considered as too long*/
 	const double TaskTimeThreshold = 30.0;
+
+	/**
+	 * Order in which priority classes are visited when handing out free slots to pending tasks. Critical tasks are
+	 * always drained first, this weighting only decides how Normal and Background tasks share the remaining slots so that
+	 * background queries still make progress under a steady stream of normal tasks.
+	 */
+	static const EAccelByteAsyncTaskPriority AdmissionOrder[];
+
+	/** Pending tasks for each priority class, in the order that they were dispatched */
+	TQueue<FOnlineAsyncTask*> PendingParallelTasks[AB_ASYNC_TASK_PRIORITY_COUNT];
+
+	/** Amount of tasks in each of the pending queues, as TQueue does not track its own size */
+	int32 PendingParallelTaskCount[AB_ASYNC_TASK_PRIORITY_COUNT] = {0, 0, 0};
+
+	/** Amount of admitted tasks for each priority class that have not completed yet */
+	int32 ActiveParallelTaskCount[AB_ASYNC_TASK_PRIORITY_COUNT] = {0, 0, 0};
+
+	/** Maximum amount of in-flight tasks for each priority class, zero or below means unbounded */
+	int32 MaxParallelTasksPerPriority[AB_ASYNC_TASK_PRIORITY_COUNT] = {0, 32, 8};
+
+	/** Priority class of each admitted task, so that its slot can be released on completion */
+	TMap<FOnlineAsyncTask*, EAccelByteAsyncTaskPriority> ActiveParallelTaskPriorities;
+
+	/** Position in AdmissionOrder where the next admission round starts */
+	int32 AdmissionCursor = 0;
+
+	/** Lock guarding all of the scheduler state above */
+	mutable FCriticalSection SchedulerLock;
+
+	/** Whether a task of the given priority class can be admitted right now. Expects SchedulerLock to be held. */
+	bool HasFreeSlot(EAccelByteAsyncTaskPriority Priority) const;
+
+	/** Mark a task as admitted under the given priority class. Expects SchedulerLock to be held. */
+	void MarkAdmitted(FOnlineAsyncTask* Task, EAccelByteAsyncTaskPriority Priority);
+
+	/** Pop as many pending tasks as the free slots allow, and hand them to the parallel task list */
+	void AdmitPendingParallelTasks();
+
 };
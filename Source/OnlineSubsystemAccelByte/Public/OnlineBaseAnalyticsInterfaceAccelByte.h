@@ -9,6 +9,8 @@
 #include "OnlineIdentityInterfaceAccelByte.h"
 #include "Models/AccelByteGameTelemetryModels.h"
 #include "OnlineErrorAccelByte.h"
+#include "Utilities/AccelByteTelemetrySpillQueue.h"
+#include "Utilities/AccelByteTelemetryReplayBatcher.h"
 
 DECLARE_MULTICAST_DELEGATE_FourParams(FAccelByteOnSendEventCompleted, int32 /*LocalUserNum*/, const FString& /*EventName*/, bool /*bWasSuccessful*/, const FOnlineErrorAccelByte& /*Error*/);
 typedef FAccelByteOnSendEventCompleted::FDelegate FAccelByteOnSendEventCompletedDelegate;
@@ -20,9 +22,15 @@ class ONLINESUBSYSTEMACCELBYTE_API FOnlineBaseAnalyticsAccelByte : public TShare
 {
 protected:
 
-	/** Constructor that is invoked by the Subsystem instance to create an analytics instance */
-	FOnlineBaseAnalyticsAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
+	/**
+	 * Constructor that is invoked by the Subsystem instance to create an analytics instance
+	 *
+	 * @param InSubsystem Instance of the subsystem that created this interface
+	 * @param InCachedEventsName Name of the file that events cached before login are spilled to, without a file if empty
+	 */
+	FOnlineBaseAnalyticsAccelByte(FOnlineSubsystemAccelByte* InSubsystem, const FString& InCachedEventsName = FString())
 		: AccelByteSubsystem(InSubsystem)
+		, CachedEventsName(InCachedEventsName)
 	{}
 
 	virtual ~FOnlineBaseAnalyticsAccelByte() {};
@@ -65,6 +73,9 @@ protected:
 	int32 SettingInterval;
 	TMap<int32, bool> SetEventIntervalMap;
 
+	/** Name of the file that events cached before login are spilled to */
+	FString CachedEventsName;
+
 	/** Add Event to cache, used in case of the user is not logged in yet */
 	void AddToCache(int32 LocalUserNum, const TSharedPtr<FAccelByteModelsTelemetryBody>& Cache);
 
@@ -81,9 +92,27 @@ protected:
 	virtual bool SetEventSendInterval(int32 InLocalUserNum) = 0;
 	virtual void SendCachedEvent(int32 InLocalUserNum, const TSharedPtr<FAccelByteModelsTelemetryBody> & CachedEvent) = 0;
 
+PACKAGE_SCOPE:
+	/**
+	 * Open the spill file for events cached before login, and wait for a login to replay the events that a previous run
+	 * left in it to the users that own them. Called by the subsystem once the interface is created.
+	 */
+	void Init();
+
+	/**
+	 * Send the next batch of cached events replayed after login, if one is due.
+	 */
+	void Tick(float DeltaTime);
+
 private:
-	mutable FCriticalSection CachedEventsLock;
-	TMap<int32, TArray<TSharedPtr<FAccelByteModelsTelemetryBody>>> CachedEvents;
+	/** Events cached before login, bounded in memory and spilled to disk past that */
+	FAccelByteTelemetrySpillQueue CachedEvents;
+
+	/** Whether cached events are replayed after login in paced batches, rather than all sent at once */
+	bool bIsCachedEventReplayBatched = true;
+
+	/** Paces the replay of cached events after login, pulling each batch from CachedEvents */
+	FAccelByteTelemetryReplayBatcher CachedEventReplay;
 	TMap<int32, FDelegateHandle> OnLoginSuccessDelegateHandle;
 	TMap<int32, FDelegateHandle> OnLogoutSuccessDelegateHandle;
 	FDelegateHandle OnLocalUserNumCachedDelegateHandle;
@@ -16,6 +16,8 @@
 #include "Models/AccelByteChatModels.h"
 #include "Interfaces/OnlineChatInterface.h"
 #include "OnlineSubsystemAccelBytePackage.h"
+#include "Utilities/AccelByteRingBuffer.h"
+#include "Utilities/AccelBytePagedQuery.h"
 
 struct FAccelByteChatRoomConfig {
 	// Flag indicating whether users can join the chat room without an invite
@@ -103,6 +105,10 @@ typedef TSharedPtr<FAccelByteChatRoomMember> FAccelByteChatRoomMemberPtr;
 using FChatRoomIdToChatMessages = TMap<FChatRoomId, TArray<TSharedRef<FChatMessage>>>;
 using FUserIdToRoomChatMessages = TMap<TSharedRef<const FUniqueNetIdAccelByteUser>, FChatRoomIdToChatMessages, FDefaultSetAllocator, TUserUniqueIdConstSharedRefMapKeyFuncs<FChatRoomIdToChatMessages>>;
 
+using FChatMessageRingBuffer = TAccelByteRingBuffer<TSharedRef<FChatMessage>>;
+using FChatRoomIdToChatMessageRingBuffer = TMap<FChatRoomId, FChatMessageRingBuffer>;
+using FUserIdToRoomChatMessageRingBuffer = TMap<TSharedRef<const FUniqueNetIdAccelByteUser>, FChatRoomIdToChatMessageRingBuffer, FDefaultSetAllocator, TUserUniqueIdConstSharedRefMapKeyFuncs<FChatRoomIdToChatMessageRingBuffer>>;
+
 class ONLINESUBSYSTEMACCELBYTE_API FAccelByteChatMessage : public FChatMessage
 {
 public:
@@ -164,8 +170,11 @@ public:
 
 	static FAccelByteChatRoomInfoRef Create();
 	
+	/** Check whether a user is a member of this room, in constant time */
 	bool HasMember(const FString& UserId) const;
+	/** Members of this room. Their order is not kept when members are removed */
 	const TArray<FString>& GetMembers() const;
+	int32 GetMemberCount() const;
 
 PACKAGE_SCOPE:
 	void SetTopicData(const FAccelByteModelsChatTopicQueryData& InTopicData);
@@ -177,7 +186,15 @@ PACKAGE_SCOPE:
 	bool bIsPrivate{};
 	bool bIsJoined{};
 	FChatRoomConfig RoomConfig;
+	/** Members in here must only be changed through SetTopicData, AddMember and RemoveMember to keep MemberIndices in sync */
 	FAccelByteModelsChatTopicQueryData TopicData;
+
+private:
+	/** Index of each member within TopicData.Members */
+	TMap<FString, int32> MemberIndices;
+
+	/** Rebuild MemberIndices from TopicData.Members, dropping duplicate members */
+	void RebuildMemberIndices();
 };
 
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineChatAccelByte : public IOnlineChat, public TSharedFromThis<FOnlineChatAccelByte, ESPMode::ThreadSafe>
@@ -593,6 +610,10 @@ PACKAGE_SCOPE:
 	*/
 	FAccelByteChatRoomMemberRef GetAccelByteChatRoomMember(const FString& UserId);
 	/**
+	* Create a chat message from a received chat notification, the sender shares the ID of their cached room member
+	*/
+	TSharedRef<FAccelByteChatMessage> CreateChatMessage(const FAccelByteModelsChatNotif& ChatNotif);
+	/**
 	* Cache current maximum chat message length
 	*/
 	void SetMaxChatMessageLength(int32 InMaxChatMessageLength) { MaxChatMessageLength = InMaxChatMessageLength; }
@@ -602,6 +623,25 @@ PACKAGE_SCOPE:
 	int32 GetMaxChatMessageLength() const { return MaxChatMessageLength; }
 	//~ End Utility functions
 
+protected:
+	/** Start paging through the topics of a local user, replacing the topic query of a previous connection if still running */
+	void StartTopicQuery(int32 LocalUserNum, const FUniqueNetIdRef& LocalUserId);
+
+	/** Dispatch the query room task for a single topic page, its response has to be handed to OnQueryChatRoomInfoComplete */
+	virtual void SendTopicQueryPage(int32 LocalUserNum, const FUniqueNetIdRef& LocalUserId, int32 PageIndex, int32 Offset, int32 Limit, const TSharedRef<FAccelBytePagedQuery, ESPMode::ThreadSafe>& TopicQuery);
+
+	/** Handle a topic page coming back, sending the following pages unless its query was replaced, failed or is complete */
+	void OnQueryChatRoomInfoComplete(bool bWasSuccessful, TArray<FAccelByteChatRoomInfoRef> RoomList, int32 LocalUserNum, FUniqueNetIdRef LocalUserId, int32 PageIndex, TSharedRef<FAccelBytePagedQuery, ESPMode::ThreadSafe> TopicQuery);
+
+	/** Topic query of each local user that is still paging through their topics after connecting to chat */
+	TMap<int32, TSharedRef<FAccelBytePagedQuery, ESPMode::ThreadSafe>> LocalUserNumToTopicQuery;
+
+	/** Amount of topics requested per page after connecting to chat, read from ChatTopicQueryPageSize in the config */
+	int32 TopicQueryPageSize{200};
+
+	/** Maximum amount of topic pages requested at once, read from MaxChatTopicQueryPagesInFlight in the config */
+	int32 MaxTopicQueryPagesInFlight{4};
+
 private:
 	//~ Begin Chat Notification Handlers
 	void OnChatDisconnectedNotification(const FAccelByteModelsChatDisconnectNotif& DisconnectEvent, int32 LocalUserNum);
@@ -618,17 +658,22 @@ private:
 	//~ End Chat Notification Handlers
 
 	//~ Begin Chat Internal Handlers
-	void OnQueryChatRoomInfoComplete(bool bWasSuccessful, TArray<FAccelByteChatRoomInfoRef> RoomList, int32 LocalUserNum);
 	void OnQueryChatMemberInfo_TriggerChatRoomMemberJoin(bool bIsSuccessful, TArray<FAccelByteUserInfoRef> UsersQueried, FString RoomId, FUniqueNetIdPtr UserId, FUniqueNetIdPtr MemberId);
 	void OnQueryChatRoomById_TriggerChatRoomMemberJoin(bool bWasSuccessful, FAccelByteChatRoomInfoPtr RoomInfo, int32 LocalUserNum, FUniqueNetIdPtr UserId, FUniqueNetIdPtr MemberId);
 	//~ End Chat Internal Handlers
 
+	/** Send every topic page that the topic query of a local user may send at this point */
+	void SendTopicQueryPages(int32 LocalUserNum, const FUniqueNetIdRef& LocalUserId, const TSharedRef<FAccelBytePagedQuery, ESPMode::ThreadSafe>& TopicQuery);
+
 	/** Cache chat room info. Populated after connect and updated on topic related events */
 	TMap<FString, FAccelByteChatRoomInfoRef> TopicIdToChatRoomInfoCached;
 	/** Cache chat room member. Populated along with the topic events */
 	TMap<FString, FAccelByteChatRoomMemberRef> UserIdToChatRoomMemberCached;
-	/** Cache live chat messages */
-	FUserIdToRoomChatMessages UserIdToChatRoomMessagesCached;
+	/** Cache live chat messages, keeping only the most recent messages of each room */
+	FUserIdToRoomChatMessageRingBuffer UserIdToChatRoomMessagesCached;
+
+	/** Maximum amount of live chat messages cached per room, read from MaxCachedChatMessagesPerRoom in the config */
+	int32 MaxCachedChatMessagesPerRoom{1000};
 
 	/** Cache maximum chat message length*/
 	int32 MaxChatMessageLength{INDEX_NONE};
@@ -19,7 +19,7 @@ PACKAGE_SCOPE:
 
 	/** Constructor that is invoked by the Subsystem instance to create a predefined event instance */
 	FOnlineGameStandardEventAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
-		: FOnlineBaseAnalyticsAccelByte(InSubsystem)
+		: FOnlineBaseAnalyticsAccelByte(InSubsystem, TEXT("GameStandardEvents"))
 	{
 		bIsHaveSettingInterval = GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("SendGameStandardEventInterval"), SettingInterval, GEngineIni);
 	}
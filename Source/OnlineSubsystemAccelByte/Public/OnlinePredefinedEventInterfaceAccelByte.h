@@ -19,7 +19,7 @@ PACKAGE_SCOPE:
 
 	/** Constructor that is invoked by the Subsystem instance to create a predefined event instance */
 	FOnlinePredefinedEventAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
-		: FOnlineBaseAnalyticsAccelByte(InSubsystem)
+		: FOnlineBaseAnalyticsAccelByte(InSubsystem, TEXT("PredefinedEvents"))
 	{
 		bIsHaveSettingInterval = GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("SendPredefinedEventInterval"), SettingInterval, GEngineIni);
 	}
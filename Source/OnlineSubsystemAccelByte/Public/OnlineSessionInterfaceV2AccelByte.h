@@ -24,6 +24,7 @@
 #include "Core/StatsD/IAccelByteStatsDMetricCollector.h"
 #include "GameServerApi/AccelByteServerMetricExporterApi.h"
 #include "OnlineSubsystemAccelBytePackage.h"
+#include "Utilities/AccelBytePollScheduler.h"
 
 class FInternetAddr;
 class FNamedOnlineSession;
@@ -295,30 +296,6 @@ struct ONLINESUBSYSTEMACCELBYTE_API FOnlineSessionInviteAccelByte
 	bool IsExpired();
 };
 
-struct ONLINESUBSYSTEMACCELBYTE_API FSessionServerCheckPollItem
-{
-	/** User ID of the player currently waiting for DS */
-	FUniqueNetIdPtr SearchingPlayerId;
-
-	/** Named session waiting to get DS */
-	FName SessionName;
-
-	/** Time in UTC the next session server check will be executed */
-	FDateTime NextPollTime;
-};
-
-struct ONLINESUBSYSTEMACCELBYTE_API FSessionInviteCheckPollItem
-{
-	/** User ID of the player currently waiting for DS */
-	FUniqueNetIdPtr SearchingPlayerId;
-
-	/** Named session waiting to get DS */
-	FString SessionId;
-
-	/** Time in UTC the next session server check will be executed */
-	FDateTime NextPollTime;
-};
-
 /**
  * AccelByte specific subclass for an online session search handle. Stores ticket ID and matchmaking user ID for retrieval later.
  */
@@ -721,7 +698,7 @@ public:
 	FNamedOnlineSession* GetPartySession() const;
 
 	/*
-	 * Attempt to get a named session instance by it's backend ID
+	 * Attempt to get a named session instance by it's backend ID, in constant time through the session ID index
 	 */
 	FNamedOnlineSession* GetNamedSessionById(const FString& SessionIdString);
 
@@ -1373,12 +1350,6 @@ PACKAGE_SCOPE:
 	 */
 	FOnlineSessionSettings CurrentMatchmakingSessionSettings{};
 
-	/**
-	 * UTC Time for the next poll to check matchmaking details,
-	 * Intended to be used for trigger manual poll matchmaking progress. 
-	 */
-	FDateTime NextMatchmakingDetailPollTime{0};
-
 	/**
 	 * enable match ticket details check polling.
 	 */
@@ -1401,12 +1372,12 @@ PACKAGE_SCOPE:
 	bool bSessionInviteCheckPollEnabled{true};
 	int32 SessionInviteCheckPollInitialDelay{30};
 	int32 SessionInviteCheckPollInterval{15};
-	
-	mutable FCriticalSection SessionServerCheckTimesLock;
-	TArray<FSessionServerCheckPollItem> SessionServerCheckPollTimes;
 
-	mutable FCriticalSection SessionInviteCheckTimesLock;
-	TArray<FSessionInviteCheckPollItem> SessionInviteCheckPollTimes;
+	/**
+	 * Match ticket, session server and session invite check polls, fired from Tick once due. Polls are cancelled as soon
+	 * as the notification that they stand in for arrives.
+	 */
+	FAccelBytePollScheduler PollScheduler;
 
 	/**
 	 * Global string for the environment variable to get session ID for a spawned server.
@@ -1432,18 +1403,21 @@ PACKAGE_SCOPE:
 
 	/**
 	 * Check matchmaking progress in case matchmaking found notifications is not received in a timely manner.
+	 * Fired by the match ticket check poll.
 	 */
 	void CheckMatchmakingProgress();
 
 	/**
 	 * Check session's dedicated server readiness when notification is not received in a timely manner.
+	 * Fired by the session server check poll of the session.
 	 */
-	void CheckSessionServerProgress();
+	void CheckSessionServerProgress(const FUniqueNetIdPtr& SearchingPlayerId, const FName SessionName);
 
 	/**
 	 * Check session's invite when notification is not received in a timely manner after match found is notified.
+	 * Fired by the session invite check poll of the session.
 	 */
-	void CheckSessionInviteAfterMatchFound();
+	void CheckSessionInviteAfterMatchFound(const FUniqueNetIdPtr& SearchingPlayerId, const FString& SessionId);
 	
 	/**
 	 * Session tick for various background tasks
@@ -1607,6 +1581,19 @@ PACKAGE_SCOPE:
 	 */
 	TSharedRef<FJsonObject> ConvertSessionSettingsToJsonObject(const FOnlineSessionSettings& Settings) const;
 
+	/**
+	 * Whether game session updates only send the attributes that changed, see bUseSessionAttributeMergePatch.
+	 */
+	bool IsSessionAttributeMergePatchEnabled() const
+	{
+		return bUseSessionAttributeMergePatch;
+	}
+
+	/**
+	 * Write every pending match ticket, session server and session invite check poll to the output device
+	 */
+	void DumpScheduledPolls(FOutputDevice& Ar) const;
+
 	/**
 	 * Read a base session model into a session settings instance
 	 */
@@ -1841,11 +1828,23 @@ private:
 	/** Sessions stored in this interface, associated by session name */
 	TMap<FName, TSharedPtr<FNamedOnlineSession>> Sessions;
 
+	/**
+	 * Name of each session in Sessions by its backend ID, so that notifications find their session without walking every
+	 * session. Kept in sync whenever a named session is added, removed or gets its session info, guarded by SessionLock.
+	 */
+	TMap<FString, FName> SessionIdToSessionName{};
+
 	/** Flag denoting whether there is already a task in progress to get a session associated with a server */
 	bool bIsGettingServerClaimedSession{ false };
 
-	/** Array of session names that have an update queued from the backend */
-	TArray<FName> SessionsWithPendingQueuedUpdates{};
+	/** Set of session names that have an update queued from the backend, for constant time checks when queueing */
+	TSet<FName> SessionsWithPendingQueuedUpdates{};
+
+	/**
+	 * Session names from SessionsWithPendingQueuedUpdates in the order that they were queued, so that a tick only visits
+	 * the sessions that changed rather than every session that we are in
+	 */
+	TArray<FName> PendingQueuedUpdateQueue{};
 
 	/** Array of delegates that are awaiting server session retrieval before executing */
 	TArray<TFunction<void()>> SessionCallsAwaitingServerSession;
@@ -1901,6 +1900,17 @@ private:
 	*/
 	bool bManualRegisterServer = false;
 
+	/**
+	* Whether game session updates only send the attributes that differ from the ones the backend last acknowledged,
+	* rather than every attribute. Only enable this for a session service that merges attributes into the existing ones on
+	* update, as one that replaces them would drop every attribute left out. Updates that remove an attribute still send
+	* every attribute, and updates that change none send an empty attributes object.
+	* Section: [OnlineSubsystemAccelByte]
+	* Key: bUseSessionAttributeMergePatch (boolean)
+	* Default behavior: if not specified then FALSE
+	*/
+	bool bUseSessionAttributeMergePatch = false;
+
 	/** Trigger warning to notify that the DS is not flag itself as ready after several minutes. */
 	bool OnServerNotSendReadyWhenTimesUp(float DeltaTime, FOnRegisterServerComplete Delegate);
 
@@ -2011,6 +2021,22 @@ private:
 	 */
 	void EnqueueBackendDataUpdate(const FName& SessionName, const TSharedPtr<FAccelByteModelsV2BaseSession>& SessionData, const bool bIsDSReadyUpdate=false);
 
+	/**
+	 * Mark a session as having a pending update to process on the next tick, if it was not marked already
+	 */
+	void QueuePendingSessionUpdate(const FName& SessionName);
+
+	/**
+	 * Index the backend ID of a named session by its name, if the session has a backend ID yet. Has to be called whenever
+	 * a named session gets its session info.
+	 */
+	void AddSessionIdToIndex(const FName& SessionName, const FOnlineSession& Session);
+
+	/**
+	 * Remove the backend ID of a named session from the session ID index, SessionLock has to be held by the caller
+	 */
+	void RemoveSessionIdFromIndex(const FName& SessionName);
+
 	void OnAMSDrain();
 
 	/**
@@ -2031,6 +2057,12 @@ protected:
 	// Making this async task a friend so that it can add new named sessions
 	friend class FOnlineAsyncTaskAccelByteGetServerClaimedV2Session;
 
+	// Making this exec test a friend so that it can add named sessions and queue updates for them
+	friend class FExecTestSessionUpdateBenchmark;
+
+	// Making this exec test a friend so that it can add named sessions and compare lookups against the session map
+	friend class FExecTestSessionIdIndex;
+
 private:
 	bool bFindMatchmakingGameSessionByIdInProgress{false};
 	FCriticalSection SessionInvitationGetInfoInProgressLock{};
@@ -67,6 +67,7 @@ class FAccelByteVoiceChat;
 
 class FOnlineAsyncEpicTaskAccelByte;
 class FOnlineAsyncTaskAccelByte;
+class FAccelByteAsyncTaskMetrics;
 
 struct FAccelByteModelsNotificationMessage;
 
@@ -107,6 +108,9 @@ typedef TSharedPtr<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe> FOnlineUserCa
 /** Shared pointer to the AccelByte async task manager for this OSS */
 typedef TSharedPtr<FOnlineAsyncTaskManagerAccelByte, ESPMode::ThreadSafe> FOnlineAsyncTaskManagerAccelBytePtr;
 
+/** Shared pointer to the AccelByte async task metrics for this OSS */
+typedef TSharedPtr<FAccelByteAsyncTaskMetrics, ESPMode::ThreadSafe> FAccelByteAsyncTaskMetricsPtr;
+
 /** Shared pointer to the AccelByte entitlements */
 typedef TSharedPtr<FOnlineEntitlementsAccelByte, ESPMode::ThreadSafe> FOnlineEntitlementsAccelBytePtr;
 
@@ -219,6 +223,16 @@ public:
 	 */
 	FOnlineUserCacheAccelBytePtr GetUserCache() const;
 
+	/**
+	 * Retrieves the latency and completion metrics recorded for async tasks of this subsystem
+	 */
+	FAccelByteAsyncTaskMetricsPtr GetAsyncTaskMetrics() const;
+
+	/**
+	 * Retrieves the manager that runs the async tasks of this subsystem
+	 */
+	FOnlineAsyncTaskManagerAccelBytePtr GetAsyncTaskManager() const;
+
 	//~ Begin FTickerObjectBase
 	virtual bool Tick(float DeltaTime) override;
 	//~ End FTickerObjectBase
@@ -309,8 +323,13 @@ PACKAGE_SCOPE:
 	{
 	}
 
-	/** Create and enqueue an Epic to the task manager's ParallelTasks queue */
-	FOnlineAsyncEpicTaskAccelByte* CreateAndDispatchEpic(int32 LocalUserNum, const AccelByte::FVoidHandler& InDelegate);
+	/**
+	 * Create and enqueue an Epic to the task manager's ParallelTasks queue
+	 *
+	 * @param Priority Priority class the Epic is scheduled under. Leave unset for Epics created on behalf of a task that
+	 * is already running, these are added straight to the parallel task list.
+	 */
+	FOnlineAsyncEpicTaskAccelByte* CreateAndDispatchEpic(int32 LocalUserNum, const AccelByte::FVoidHandler& InDelegate, TOptional<EAccelByteAsyncTaskPriority> Priority = {});
 
 // To allow the automation test
 OVERRIDE_PACKAGE_SCOPE:
@@ -372,6 +391,9 @@ PACKAGE_SCOPE:
 	/** To check the whether an Epic already set or not */
 	bool IsUpcomingEpicAlreadySet();
 
+	/** To check the whether a parent task already set or not */
+	bool IsUpcomingParentTaskAlreadySet();
+
 	/** Register an Epic to the subsystem.
 	* Therefore, every upcoming task created will be considered as sub-task of this Epic.
 	* It can be set by another async task using an existing Epic, or create a new Epic.
@@ -521,6 +543,9 @@ private:
 	/** Async task manager used by interfaces in our OSS to handle async */
 	FOnlineAsyncTaskManagerAccelBytePtr AsyncTaskManager;
 
+	/** Queue wait and execution metrics of every async task, aggregated per task class */
+	FAccelByteAsyncTaskMetricsPtr AsyncTaskMetrics;
+
 	/** Shared instance of our agreement interface implementation */
 	FOnlineAgreementAccelBytePtr AgreementInterface;
 	
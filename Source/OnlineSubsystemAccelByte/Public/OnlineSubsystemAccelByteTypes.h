@@ -398,6 +398,8 @@ class ONLINESUBSYSTEMACCELBYTE_API FUniqueNetIdAccelByteUser
 public:
 	/**
 	 * @brief Create a new AccelByte User UniqueNetId instance from a composite ID.
+	 * IDs are interned, so while an instance for the same composite is still alive it is returned instead of encoding
+	 * the composite again.
 	 * 
 	 * @param InCompositeId The AccelByte User UniqueNetId in composite structure.
 	 *
@@ -406,7 +408,9 @@ public:
 	static FUniqueNetIdAccelByteUserRef Create(FAccelByteUniqueIdComposite const& InCompositeId);
 
 	/**
-	 * @brief Create a new AccelByte User UniqueNetId instance from a string of UniqueNetId.
+	 * @brief Create a new AccelByte User UniqueNetId instance from a string of UniqueNetId, either in the legacy Base64
+	 * encoded JSON form or in the compact string form.
+	 * Like the composite overload, an interned instance created from the same string is returned when there is one.
 	 * 
 	 * @param InNetIdStr The UniqueNetId string.
 	 *
@@ -523,9 +527,18 @@ public:
 	 * @return AccelByte Unique ID in composite structure.
 	 */
 	FAccelByteUniqueIdComposite GetCompositeStructure() const;
+
+	/**
+	 * @brief Get the compact string form of this ID. Create accepts this form as well as the legacy form returned by
+	 * ToString.
+	 *
+	 * @return Compact string form of this ID.
+	 */
+	FString ToCompactString() const;
 	
 	/**
-	 * @brief Override equal check operator to check the AccelByte ID first, and then the platform type/ID.
+	 * @brief Override equal check operator. IDs that both have an AccelByte ID are equal when their AccelByte IDs match,
+	 * and IDs that both lack one are equal when their platform type and platform ID match.
 	 *
 	 * @param Other Another UniqueNetId object.
 	 * 
@@ -533,6 +546,21 @@ public:
 	 */
 	virtual bool Compare(FUniqueNetId const& Other) const override;
 
+	/**
+	 * @brief Hash of the fields that Compare matches on, so that equal IDs always hash equally. This is the AccelByte ID
+	 * hash computed at construction, or the hash of the platform type and platform ID for IDs without an AccelByte ID.
+	 */
+	virtual uint32 GetTypeHash() const override;
+
+	/**
+	 * @brief Get the 64-bit hash of the AccelByte ID portion, computed at construction. Case insensitive, matching how
+	 * Compare matches AccelByte IDs.
+	 */
+	uint64 GetAccelByteIdHash() const
+	{
+		return AccelByteIdHash;
+	}
+
 PACKAGE_SCOPE:
 	/**
 	 * @brief Internal constructor to set both composite elements and the encoded string at once without extra processing.
@@ -562,6 +590,19 @@ PACKAGE_SCOPE:
 	 */
 	static FUniqueNetIdAccelByteUserRef CastChecked(FUniqueNetIdRef const& InNetIdRef);
 
+	/**
+	 * @brief Enable or disable interning of IDs made through Create. Already interned IDs stay valid either way.
+	 *
+	 * @param bInEnabled Whether Create should look up and register interned IDs.
+	 */
+	static void SetInterningEnabled(bool bInEnabled);
+
+	/**
+	 * @brief Get the amount of entries in the interning tables, including entries whose ID has been destroyed but
+	 * have not been swept yet.
+	 */
+	static int32 GetInternedIdCount();
+
 private:
 
 	/**
@@ -579,6 +620,16 @@ private:
 	 */
 	bool bCachedValidState = false;
 
+	/**
+	 * @brief 64-bit hash of CompositeStructure.Id, updated whenever the composite is set
+	 */
+	uint64 AccelByteIdHash = 0;
+
+	/**
+	 * @brief Case insensitive 64-bit FNV-1a hash of an AccelByte ID.
+	 */
+	static uint64 ComputeAccelByteIdHash(FString const& AccelByteId);
+
 	/**
 	 * @brief Method that will decode a given string from Base64 into the correct ID format, as well as fill out necessary fields.
 	 */
@@ -1134,6 +1185,31 @@ enum class ETypeOfOnlineAsyncTask :uint8
 	Parallel = 1
 };
 
+/**
+ * Priority class of a parallel async task. Used by the async task manager to decide which pending tasks are admitted
+ * first once the number of in-flight tasks for a class reaches its configured limit.
+ */
+enum class EAccelByteAsyncTaskPriority : uint8
+{
+	Critical = 0, // Login and session critical work, such as creating or joining a session
+	Normal, // Default priority for any task that does not specify one
+	Background // Queries that can wait behind other work, such as user info, presence and stats queries
+};
+
+const static inline FString AsyncTaskPriorityToString(const EAccelByteAsyncTaskPriority& Priority)
+{
+	switch (Priority)
+	{
+	case EAccelByteAsyncTaskPriority::Critical:
+		return TEXT("Critical");
+	case EAccelByteAsyncTaskPriority::Normal:
+		return TEXT("Normal");
+	case EAccelByteAsyncTaskPriority::Background:
+		return TEXT("Background");
+	}
+	return TEXT("Unknown");
+}
+
 class FOnlineAsyncTaskAccelByte;
 
 /**
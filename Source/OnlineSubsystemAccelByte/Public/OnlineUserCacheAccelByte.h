@@ -7,9 +7,14 @@
 #include "Dom/JsonObject.h"
 #include "OnlineSubsystemAccelBytePackage.h"
 #include "InterfaceModels/OnlineUserInterfaceAccelByteModels.h"
+#include "Async/Future.h"
 
 class FOnlineSubsystemAccelByte;
 class IOnlineSubsystem;
+class FAccelByteUserCacheSnapshot;
+
+/** Number of shards that each user cache map is split into, must be a power of two */
+#define ACCELBYTE_USER_CACHE_SHARD_COUNT 16
 
 /**
  * @brief 3rd party platform information associated with an user AccelByte account 
@@ -270,6 +275,18 @@ private:
 	 */
 	bool bIsForcedStale { false };
 
+	/**
+	 * Neighbours of this user in the recency list of the user cache shard holding them, guarded by that shard's lock.
+	 * Important users are kept out of the list, as they are never purged.
+	 */
+	FAccelByteUserInfo* MoreRecentUser{ nullptr };
+	FAccelByteUserInfo* LessRecentUser{ nullptr };
+
+	/**
+	 * Whether this user is currently linked into the recency list of a user cache shard.
+	 */
+	bool bIsInRecencyList{ false };
+
 	/**
 	 * Copy UserInfo value 
 	 */
@@ -285,6 +302,11 @@ private:
 	 */
 	friend class FOnlineUserCacheAccelByte;
 
+	/**
+	 * Setting the user cache snapshot as a friend class to save and restore the last updated time
+	 */
+	friend class FAccelByteUserCacheSnapshot;
+
 };
 
 typedef TSharedRef<FAccelByteUserInfo, ESPMode::ThreadSafe> FAccelByteUserInfoRef;
@@ -308,9 +330,38 @@ DECLARE_DELEGATE_TwoParams(FOnQueryUsersComplete, bool /*bIsSuccessful*/, TArray
  * time you won't be able to query a user by their platform IDs is if they are not on the same platform as you, in which
  * you can only query by AccelByte ID.
  *
+ * Both maps are split into shards keyed by the hash of the map key, each with its own lock. Lookups from the game thread
+ * only contend with inserts that land in the same shard, rather than waiting on a whole batch of queried users being
+ * added from a background task. No more than one shard lock is ever held at a time.
+ *
  * User data will be kept cached based on how long it has been since they have been accessed. You can configure how long
  * users will stay in cache with the `UserCachePurgeTimeoutSeconds` variable in the `OnlineSubsystemAccelByte` settings
- * in `DefaultEngine.ini`. Users will also not be purged if they were marked as important when queried.
+ * in `DefaultEngine.ini`. Users will also not be purged if they were marked as important when queried. Purging only runs
+ * from the ticker once `bEnableUserCachePurge` is set, and is disabled by default.
+ *
+ * Each AccelByte ID shard keeps its purgeable users in a list ordered by last access, so purging only ever looks at the
+ * least recently accessed users. At most `MaxUserCachePurgesPerTick` users are purged per tick, and the cache can be
+ * capped to `MaxCachedUserCount` users, evicting the least recently accessed users of a shard once it is full.
+ *
+ * Queries by AccelByte ID are not dispatched right away. They are held for `UserQueryBatchWindowMilliseconds` (by
+ * default until the next tick), merged with any other queries from the same local user into one deduplicated query, and
+ * the results are then handed back to every caller for the IDs they asked for. Set `bEnableUserQueryBatching` to false
+ * to dispatch every query on its own.
+ *
+ * Queries that need more than one backend request keep up to `MaxParallelUserQueryChunks` chunk requests in flight at
+ * once. Set it to one to send the chunks one after the other.
+ *
+ * With `bEnableUserCacheSnapshot` set, users are also written to a snapshot in the saved directory every
+ * `UserCacheSnapshotIntervalSeconds` and on shutdown. The snapshot is read back on a background thread after the first
+ * tick of the next session, so that users queried in a previous session are available without querying them again.
+ * Users that went stale according to `bEnableStalenessChecking` and `TimeUntilStaleSeconds` are neither written nor
+ * restored, and restored users never replace users that were already queried in the current session. A snapshot is only
+ * restored for the namespace and base URL that it was written for.
+ *
+ * IDs that the backend has no user for, such as deleted users or users from another environment, are remembered for
+ * `NegativeUserCacheTimeSeconds` so that asking for them again does not go back to the backend. Queries complete
+ * successfully without those users, just as if they had been queried. At most `MaxNegativeCachedUserCount` IDs are
+ * remembered at once, and an ID is forgotten as soon as a user with that ID is added to the cache.
  */
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineUserCacheAccelByte
 {
@@ -333,6 +384,11 @@ public:
 	 */
 	static bool GetFromWorld(const UWorld* World, TSharedPtr<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe>& OutInterfaceInstance);
 
+	/**
+	 * Waits for any snapshot load or save that is still running in the background.
+	 */
+	~FOnlineUserCacheAccelByte();
+
 	/**
 	 * Queries all of the IDs listed in the array on the AccelByte backend for user information, including platform IDs.
 	 * If platform IDs are found and match the current platform that we are on, extra queries will be made through the platform OSSes.
@@ -506,10 +562,95 @@ PACKAGE_SCOPE:
 	 *
 	 * Will return the number of users purged from the cache.
 	 *
-	 * Do not call this method directly, it will be called from the owning OnlineSubsystem's ticker!
+	 * Only the least recently accessed end of each shard is checked, and no more than MaxUserCachePurgesPerTick users
+	 * are removed per call, so the cost of a call does not grow with the size of the cache.
+	 *
+	 * Prefer TickPurge, which only purges when purging is enabled.
 	 */
 	int32 Purge();
 
+	/**
+	 * Purge expired users if bEnableUserCachePurge is set. Returns the number of users purged from the cache.
+	 *
+	 * Do not call this method directly, it will be called from the owning OnlineSubsystem's ticker!
+	 */
+	int32 TickPurge();
+
+	/**
+	 * Get the amount of users cached by AccelByte ID.
+	 */
+	int32 GetCachedUserCount();
+
+	/**
+	 * Dispatch every batch of queries by AccelByte ID that has waited out the batching window, or every pending batch
+	 * if forced. Returns the number of queries that were dispatched.
+	 *
+	 * Do not call this method directly, it will be called from the owning OnlineSubsystem's ticker!
+	 */
+	int32 FlushPendingUserQueries(bool bForce = false);
+
+	/**
+	 * Fail every query by AccelByte ID that is still waiting in a batch, rather than dispatching it for a user that is no
+	 * longer logged in or through a subsystem that is shutting down. Returns the number of queries that were failed.
+	 *
+	 * @param LocalUserNum Local user to fail the queries of, or INVALID_CONTROLLERID to fail the queries of every user
+	 */
+	int32 FailPendingUserQueries(int32 LocalUserNum = INVALID_CONTROLLERID);
+
+	/**
+	 * Set the length of time in seconds that a user will stay in the cache without being accessed. Intended for runtime
+	 * testing of cache. Prefer using ini or command line to control purge time.
+	 */
+	void SetUserCachePurgeTimeoutSeconds(double InUserCachePurgeTimeoutSeconds);
+
+	/**
+	 * Set the maximum amount of users removed by a single purge, zero or below means unbounded. Intended for runtime
+	 * testing of cache.
+	 */
+	void SetMaxUserCachePurgesPerTick(int32 InMaxUserCachePurgesPerTick);
+
+	/**
+	 * Set the maximum amount of users kept in the cache, zero or below means unbounded. Only applied as users are added.
+	 * Intended for runtime testing of cache.
+	 */
+	void SetMaxCachedUserCount(int32 InMaxCachedUserCount);
+
+	/**
+	 * Start loading the snapshot on the first call, and write a new snapshot in the background whenever the snapshot
+	 * interval has passed. Does nothing unless snapshots are enabled.
+	 *
+	 * Do not call this method directly, it will be called from the owning OnlineSubsystem's ticker!
+	 */
+	void TickSnapshot();
+
+	/**
+	 * Write every user that is not stale to the snapshot right away, after waiting for any snapshot load or save still
+	 * running in the background. Does nothing unless snapshots are enabled. Called by the owning OnlineSubsystem on shutdown.
+	 *
+	 * @return true if the snapshot was written
+	 */
+	bool SaveSnapshot();
+
+	/**
+	 * Add users read back from a snapshot to the cache. Stale users are skipped, as are users that are already cached,
+	 * since those have been queried during this session. Restored users are never marked as important, and do not evict
+	 * other users to stay under the cache limit.
+	 *
+	 * @return Amount of users added to the cache
+	 */
+	int32 RestoreUsersToCache(const TArray<FAccelByteUserInfoRef>& RestoredUsers);
+
+	/**
+	 * Get the maximum amount of chunk requests that a single user query keeps in flight at once.
+	 */
+	int32 GetMaxParallelUserQueryChunks() const;
+
+	/**
+	 * Set the maximum amount of chunk requests that a single user query keeps in flight at once, clamped to at least one.
+	 * Only affects queries started after this call. Intended for runtime testing.
+	 */
+	void SetMaxParallelUserQueryChunks(int32 InMaxParallelUserQueryChunks);
+
 	/**
 	 * Check whether a user exists already in the cache so that we don't requery them.
 	 */
@@ -521,12 +662,54 @@ PACKAGE_SCOPE:
 	 */
 	void GetQueryAndCacheArrays(const TArray<FString>& AccelByteIds, TArray<FString>& UsersToQuery, TArray<FAccelByteUserInfoRef>& UsersInCache);
 
+	/**
+	 * Remember AccelByte IDs that the backend returned no user for, so that they are not queried again until the
+	 * negative cache time has passed.
+	 */
+	void AddAccelByteIdsToNegativeCache(const TArray<FString>& AccelByteIds);
+
+	/**
+	 * Remember platform IDs of the given platform type that the backend could not map to an AccelByte user.
+	 */
+	void AddPlatformIdsToNegativeCache(const FString& PlatformType, const TArray<FString>& PlatformIds);
+
+	/**
+	 * Remove every platform ID of the given platform type that is known to have no AccelByte user.
+	 *
+	 * @return Amount of IDs removed
+	 */
+	int32 RemoveNegativeCachedPlatformIds(const FString& PlatformType, TArray<FString>& PlatformIds);
+
+	/**
+	 * Get the amount of IDs remembered as having no user, including ones that have expired but were not removed yet.
+	 */
+	int32 GetNegativeCachedUserCount();
+
+	/**
+	 * Set how long in seconds an ID with no user is remembered, zero or below disables the negative cache. Only affects
+	 * IDs added after this call. Intended for runtime testing.
+	 */
+	void SetNegativeUserCacheTimeSeconds(int32 InNegativeUserCacheTimeSeconds);
+
 private:
 
 	/**
-	 * Mutex used to lock maps while we add to or retrieve from cache
+	 * One shard of a user cache map, along with the lock used while we add to or retrieve from it
 	 */
-	FCriticalSection CacheLock;
+	struct FUserCacheShard
+	{
+		FCriticalSection Lock;
+		TMap<FString, FAccelByteUserInfoRef> UserInfoMap;
+
+		/** Ends of the recency list of purgeable users, only tracked for the AccelByte ID shards */
+		FAccelByteUserInfo* MostRecentUser = nullptr;
+		FAccelByteUserInfo* LeastRecentUser = nullptr;
+	};
+
+	/**
+	 * Whether expired users are purged from the cache on tick. Disabled by default.
+	 */
+	bool bEnableUserCachePurge { false };
 
 	/**
 	 * Length of time in seconds that a user will stay in the cache without being accessed before being purged.
@@ -535,15 +718,139 @@ private:
 	double UserCachePurgeTimeoutSeconds = 600.0;
 
 	/**
-	 * User cache that maps AccelByte IDs to shared user instances
+	 * Maximum amount of users removed from the cache by a single purge, zero or below means unbounded. Any users that are
+	 * left over are picked up on the following ticks. Defaults to 64 users.
+	 */
+	int32 MaxUserCachePurgesPerTick = 64;
+
+	/**
+	 * Maximum amount of users kept in the cache, split evenly between the AccelByte ID shards. Once a shard is full, its
+	 * least recently accessed users are evicted as new users are added. Important users are never evicted, so they may
+	 * push the cache past this limit. Zero or below means unbounded, which is the default.
+	 */
+	int32 MaxCachedUserCount = 0;
+
+	/**
+	 * Shard that the next purge starts from, so that a shard with many expired users cannot starve the others.
+	 * Only accessed from Purge on the game thread.
+	 */
+	int32 PurgeShardCursor = 0;
+
+	/**
+	 * A query by AccelByte IDs that is waiting in a batch, along with the delegate that its users are handed to
 	 */
-	TMap<FString, FAccelByteUserInfoRef> AccelByteIdToUserInfoMap;
+	struct FPendingUserQuery
+	{
+		TSet<FString> AccelByteIds;
+		FOnQueryUsersComplete Delegate;
+	};
 
 	/**
-	 * User cache that maps platform type and ID to shared user instances. The key is just
+	 * Queries by AccelByte IDs from the same local user, merged into a single query. Important queries are never batched.
+	 */
+	struct FPendingUserQueryBatch
+	{
+		int32 LocalUserNum = INVALID_CONTROLLERID;
+		double FirstQueuedTimeInSeconds = 0.0;
+
+		/** Every ID requested by the queries in this batch, without duplicates and in the order that they were requested */
+		TArray<FString> AccelByteIds;
+		TSet<FString> AccelByteIdSet;
+
+		TArray<FPendingUserQuery> Queries;
+	};
+
+	/**
+	 * Batches of queries waiting to be dispatched
+	 */
+	TArray<FPendingUserQueryBatch> PendingUserQueryBatches;
+
+	/**
+	 * Lock for PendingUserQueryBatches, queries may be made from any thread
+	 */
+	FCriticalSection PendingUserQueryLock;
+
+	/**
+	 * Whether queries by AccelByte IDs are merged into batches before being dispatched. Enabled by default.
+	 */
+	bool bEnableUserQueryBatching { true };
+
+	/**
+	 * How long in milliseconds a batch waits for more queries after the first one is added. Zero dispatches the batch on
+	 * the next tick, which merges every query made during the same frame. Defaults to zero.
+	 */
+	int32 UserQueryBatchWindowMilliseconds { 0 };
+
+	/**
+	 * Maximum amount of chunk requests that a single user query keeps in flight at once. Defaults to four.
+	 */
+	int32 MaxParallelUserQueryChunks { 4 };
+
+	/**
+	 * Whether users are written to a snapshot on disk and restored from it in the next session. Disabled by default.
+	 */
+	bool bEnableUserCacheSnapshot { false };
+
+	/**
+	 * How often in seconds the snapshot is written while the game runs, on top of the write on shutdown. Zero or below
+	 * only writes on shutdown. Defaults to five minutes.
+	 */
+	int32 UserCacheSnapshotIntervalSeconds { 300 };
+
+	/**
+	 * Path of the snapshot file, set up on Init. Snapshots are disabled while this is empty.
+	 */
+	FString SnapshotFilePath;
+
+	/**
+	 * Time at which the next periodic snapshot is written. Only accessed from the game thread.
+	 */
+	double NextSnapshotSaveTimeInSeconds { 0.0 };
+
+	/**
+	 * Whether the snapshot load has been started. Only accessed from the game thread.
+	 */
+	bool bHasStartedSnapshotLoad { false };
+
+	/**
+	 * Snapshot load and write running in the background, if any.
+	 */
+	TFuture<void> SnapshotLoadFuture;
+	TFuture<void> SnapshotSaveFuture;
+
+	/**
+	 * How long in seconds an ID that the backend has no user for is remembered. Zero or below disables the negative cache.
+	 * Defaults to one minute.
+	 */
+	int32 NegativeUserCacheTimeSeconds { 60 };
+
+	/**
+	 * Maximum amount of IDs remembered as having no user. Once full, expired IDs are dropped first and then the IDs that
+	 * expire soonest. Defaults to 1024.
+	 */
+	int32 MaxNegativeCachedUserCount { 1024 };
+
+	/**
+	 * Time at which each ID that has no user expires from the negative cache, keyed by AccelByte ID or by the platform
+	 * key described for PlatformIdShards
+	 */
+	TMap<FString, double> NegativeCacheExpiryTimes;
+
+	/**
+	 * Lock for NegativeCacheExpiryTimes, queries complete on any thread
+	 */
+	FCriticalSection NegativeCacheLock;
+
+	/**
+	 * User cache that maps AccelByte IDs to shared user instances, split into shards
+	 */
+	FUserCacheShard AccelByteIdShards[ACCELBYTE_USER_CACHE_SHARD_COUNT];
+
+	/**
+	 * User cache that maps platform type and ID to shared user instances, split into shards. The key is just
 	 * a string that combines both type and ID, in the following format: "TYPE;ID".
 	 */
-	TMap<FString, FAccelByteUserInfoRef> PlatformIdToUserInfoMap;
+	FUserCacheShard PlatformIdShards[ACCELBYTE_USER_CACHE_SHARD_COUNT];
 
 	/**
 	 * AccelByte online subsystem instance that owns this user cache.
@@ -573,4 +880,79 @@ private:
 	 */
 	FString ConvertPlatformTypeAndIdToCacheKey(const FString& Type, const FString& Id) const;
 
+	/**
+	 * Get the index of the shard that holds the given key, using the same case insensitive hash as the shard maps.
+	 */
+	static int32 GetShardIndex(const FString& Key);
+
+	/**
+	 * Find a user in the shard that holds the given key, locking only that shard for the duration of the lookup.
+	 */
+	static FAccelByteUserInfoPtr FindInShards(FUserCacheShard* Shards, const FString& Key);
+
+	/**
+	 * Mark a user as accessed now. If the user is held by its AccelByte ID shard, it is also moved to the most recent end
+	 * of that shard's recency list, or taken out of it if the user is important.
+	 */
+	void TouchUser(FAccelByteUserInfo& UserInfo);
+
+	/**
+	 * Same as TouchUser, for a user that is known to be held by the given AccelByte ID shard. Expects the shard lock to be held.
+	 */
+	static void TouchUserInShard(FUserCacheShard& Shard, FAccelByteUserInfo& UserInfo);
+
+	/**
+	 * Remove a user from the recency list of the shard, if they are in it. Expects the shard lock to be held.
+	 */
+	static void UnlinkFromRecencyList(FUserCacheShard& Shard, FAccelByteUserInfo& UserInfo);
+
+	/**
+	 * Remove the least recently accessed purgeable user from the shard, or only take them out of the recency list if they
+	 * have been marked as important since. Expects the shard lock to be held.
+	 */
+	static void EvictLeastRecentUser(FUserCacheShard& Shard, TArray<FAccelByteUserInfoRef>& OutEvictedUsers);
+
+	/**
+	 * Whether the data of a user is recent enough to be written to or restored from a snapshot.
+	 */
+	bool IsSnapshotUserFresh(const FAccelByteUserInfo& UserInfo, const FDateTime& Now) const;
+
+	/**
+	 * Append every user that is recent enough to the snapshot, locking one shard at a time.
+	 */
+	void BuildSnapshot(FAccelByteUserCacheSnapshot& OutSnapshot);
+
+	/**
+	 * Remember the given keys as having no user, making room for them if the negative cache is full.
+	 */
+	void AddKeysToNegativeCache(const TArray<FString>& Keys);
+
+	/**
+	 * Whether the key is remembered as having no user. Expired keys are removed as they are found. Expects the negative
+	 * cache lock to be held.
+	 */
+	bool IsNegativeCachedLocked(const FString& Key, double CurrentTimeInSeconds);
+
+	/**
+	 * Forget the keys of users that were just added to the cache, as those clearly exist now.
+	 */
+	void RemoveUsersFromNegativeCache(const TArray<FAccelByteUserInfoRef>& Users);
+
+	/**
+	 * Remove the platform ID entries of users that have been purged or evicted from the AccelByte ID shards.
+	 */
+	void RemovePlatformEntries(const TArray<FAccelByteUserInfoRef>& EvictedUsers);
+
+	/**
+	 * Add a query by AccelByte IDs to the pending batch of the local user. The query is dispatched right away instead if
+	 * batching is disabled, if it is important, or if it is made while an epic or parent task is set for upcoming tasks.
+	 * Expects the IDs to already be filtered.
+	 */
+	bool QueueUsersQuery(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant);
+
+	/**
+	 * Dispatch the tasks to query users by AccelByte IDs and then their profiles.
+	 */
+	bool DispatchUsersQuery(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant);
+
 };
\ No newline at end of file
@@ -0,0 +1,166 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AsyncTasks/OnlineAsyncTaskAccelByte.h"
+
+/** Number of values in EAccelByteAsyncTaskCompleteState, used to count tasks per complete state */
+#define AB_ASYNC_TASK_COMPLETE_STATE_COUNT 5
+
+/**
+ * Fixed bucket latency histogram, bucket bounds grow roughly exponentially from one millisecond to one minute.
+ * Percentiles are interpolated within the bucket that they fall into, so they are estimates rather than exact values.
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteAsyncTaskLatencyHistogram
+{
+	/** Number of buckets, the last bucket holds every sample above the highest bound */
+	static constexpr int32 BucketCount = 17;
+
+	/** Upper bound of each bucket in milliseconds, except for the last bucket which is unbounded */
+	static const double BucketUpperBoundsMs[BucketCount - 1];
+
+	/** Amount of samples in each bucket */
+	uint32 Buckets[BucketCount] = {};
+
+	/** Total amount of samples recorded */
+	uint32 SampleCount = 0;
+
+	/** Sum of all samples in milliseconds, used for the average */
+	double TotalMs = 0.0;
+
+	/** Highest sample recorded in milliseconds */
+	double MaxMs = 0.0;
+
+	void AddSample(double Milliseconds);
+
+	/**
+	 * Estimate a percentile of the recorded samples.
+	 *
+	 * @param Percentile Percentile to get, between 0 and 100
+	 * @return Estimated value in milliseconds, or zero if no samples were recorded
+	 */
+	double GetPercentile(double Percentile) const;
+
+	double GetAverage() const
+	{
+		return (SampleCount > 0) ? TotalMs / SampleCount : 0.0;
+	}
+};
+
+/**
+ * Aggregated metrics for every task of one task class
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteAsyncTaskClassMetrics
+{
+	/** Time between a task being created and it being initialized */
+	FAccelByteAsyncTaskLatencyHistogram QueueWait;
+
+	/** Time between a task being initialized and it being completed */
+	FAccelByteAsyncTaskLatencyHistogram Execution;
+
+	/** Amount of tasks that finished in each EAccelByteAsyncTaskCompleteState */
+	uint32 CompleteStateCounts[AB_ASYNC_TASK_COMPLETE_STATE_COUNT] = {};
+
+	uint32 GetCompletedCount() const
+	{
+		return Execution.SampleCount;
+	}
+
+	uint32 GetTimeoutCount() const
+	{
+		return CompleteStateCounts[static_cast<int32>(EAccelByteAsyncTaskCompleteState::TimedOut)];
+	}
+};
+
+/**
+ * Time spent by the async task manager on the game thread, finalizing completed tasks and triggering their delegates
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteAsyncTaskGameTickStats
+{
+	/** Amount of game ticks recorded */
+	uint64 TickCount = 0;
+
+	/** Sum of the time spent in every recorded game tick */
+	double TotalSeconds = 0.0;
+
+	/** Longest single game tick recorded */
+	double MaxSeconds = 0.0;
+
+	double GetAverageSeconds() const
+	{
+		return (TickCount > 0) ? TotalSeconds / TickCount : 0.0;
+	}
+};
+
+/**
+ * Collects queue wait and execution time of every AccelByte async task, aggregated per task class.
+ *
+ * Recording a task only takes a lock and a map lookup, so unlike the trace logs it is cheap enough to be left on in
+ * shipping builds. Metrics can be dumped through the "ONLINE ASYNCTASKMETRICS" console command.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteAsyncTaskMetrics
+{
+public:
+
+	/**
+	 * Record a completed task.
+	 *
+	 * @param TaskClassName Name of the task class, all tasks sharing the name are aggregated together
+	 * @param QueueWaitSeconds Time the task spent waiting to be initialized
+	 * @param ExecutionSeconds Time the task spent between initialization and completion
+	 * @param CompleteState State that the task completed in
+	 */
+	void RecordTask(const FString& TaskClassName, double QueueWaitSeconds, double ExecutionSeconds, EAccelByteAsyncTaskCompleteState CompleteState);
+
+	/**
+	 * Get a copy of the metrics for a single task class.
+	 *
+	 * @return true if any task of that class has been recorded
+	 */
+	bool GetTaskClassMetrics(const FString& TaskClassName, FAccelByteAsyncTaskClassMetrics& OutMetrics) const;
+
+	/** Get a copy of the metrics for every task class recorded so far */
+	TMap<FString, FAccelByteAsyncTaskClassMetrics> GetAllTaskClassMetrics() const;
+
+	/**
+	 * Record a single game tick of the async task manager.
+	 *
+	 * @param Seconds Time spent processing the out queue during this tick
+	 */
+	void RecordGameTick(double Seconds);
+
+	/** Get a copy of the game tick stats recorded so far */
+	FAccelByteAsyncTaskGameTickStats GetGameTickStats() const;
+
+	/** Clear everything recorded so far */
+	void Reset();
+
+	/** Write a table of the recorded metrics, sorted by p99 execution time, to the output device */
+	void Dump(FOutputDevice& Ar) const;
+
+	void SetEnabled(bool bInEnabled)
+	{
+		bEnabled = bInEnabled;
+	}
+
+	bool IsEnabled() const
+	{
+		return bEnabled;
+	}
+
+private:
+
+	/** Aggregated metrics keyed by task class name */
+	TMap<FString, FAccelByteAsyncTaskClassMetrics> MetricsByTaskClass;
+
+	/** Game thread cost of the async task manager */
+	FAccelByteAsyncTaskGameTickStats GameTickStats;
+
+	/** Lock for MetricsByTaskClass and GameTickStats, tasks may complete on the game thread, the online thread or HTTP threads */
+	mutable FCriticalSection MetricsLock;
+
+	/** Whether tasks should be recorded at all */
+	FThreadSafeBool bEnabled = true;
+};
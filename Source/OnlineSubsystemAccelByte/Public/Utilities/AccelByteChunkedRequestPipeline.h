@@ -0,0 +1,202 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Optional.h"
+
+/**
+ * Sends a list of IDs to the backend in chunks, keeping up to a fixed amount of chunk requests in flight at once.
+ *
+ * The result of each chunk is stored by its index, so that once every chunk has completed the results can be merged in
+ * chunk order no matter in which order the responses arrived. The first chunk to fail fails the whole pipeline, no more
+ * chunks are sent after that and results of chunks that were already in flight are dropped.
+ *
+ * Chunks may be added while others are in flight, for example to retry IDs that a response reported as not processed.
+ * Such a chunk must be added before completing the chunk that it came from, otherwise the pipeline could be seen as
+ * finished in between.
+ *
+ * Every method is thread safe. The send function is never called with the internal lock held, so responses may complete
+ * their chunk and send the next ones from any thread, even from within the send function itself.
+ */
+template <typename ResultType>
+class TAccelByteChunkedRequestPipeline
+{
+public:
+	/** Sends the request for a single chunk, its response has to be reported through CompleteChunk or Fail */
+	typedef TFunction<void(int32 /*ChunkIndex*/, const TArray<FString>& /*ChunkIds*/)> FSendChunk;
+
+	explicit TAccelByteChunkedRequestPipeline(int32 InMaxChunksInFlight = 1)
+		: MaxChunksInFlight(FMath::Max(InMaxChunksInFlight, 1))
+	{
+	}
+
+	/**
+	 * Set how many chunk requests may be in flight at once, one sends the chunks one after the other.
+	 * Only affects chunks sent after this call.
+	 */
+	void SetMaxChunksInFlight(int32 InMaxChunksInFlight)
+	{
+		FScopeLock Lock(&PipelineLock);
+		MaxChunksInFlight = FMath::Max(InMaxChunksInFlight, 1);
+	}
+
+	/**
+	 * Split the IDs into chunks of at most ChunkSize IDs and queue them to be sent, in order.
+	 *
+	 * @param Ids IDs to queue
+	 * @param ChunkSize Maximum amount of IDs in a single chunk
+	 */
+	void AddIds(const TArray<FString>& Ids, int32 ChunkSize)
+	{
+		ChunkSize = FMath::Max(ChunkSize, 1);
+
+		FScopeLock Lock(&PipelineLock);
+		for (int32 Start = 0; Start < Ids.Num(); Start += ChunkSize)
+		{
+			TArray<FString>& Chunk = Chunks.AddDefaulted_GetRef();
+			Chunk.Append(Ids.GetData() + Start, FMath::Min(ChunkSize, Ids.Num() - Start));
+			Results.AddDefaulted();
+		}
+	}
+
+	/**
+	 * Queue a single chunk to be sent after every chunk queued so far.
+	 *
+	 * @return Index of the new chunk
+	 */
+	int32 AddChunk(const TArray<FString>& ChunkIds)
+	{
+		FScopeLock Lock(&PipelineLock);
+		Results.AddDefaulted();
+		return Chunks.Add(ChunkIds);
+	}
+
+	/**
+	 * Send as many queued chunks as the in flight limit allows. Does nothing once the pipeline has failed.
+	 *
+	 * @param SendChunk Function that sends the request for a chunk
+	 * @return Amount of chunks that were sent
+	 */
+	int32 SendPendingChunks(const FSendChunk& SendChunk)
+	{
+		TArray<TPair<int32, TArray<FString>>> ChunksToSend;
+		{
+			FScopeLock Lock(&PipelineLock);
+			while (!bHasFailed && ChunksInFlight < MaxChunksInFlight && NextChunkToSend < Chunks.Num())
+			{
+				ChunksToSend.Emplace(NextChunkToSend, Chunks[NextChunkToSend]);
+				NextChunkToSend++;
+				ChunksInFlight++;
+			}
+		}
+
+		for (const TPair<int32, TArray<FString>>& Chunk : ChunksToSend)
+		{
+			SendChunk(Chunk.Key, Chunk.Value);
+		}
+
+		return ChunksToSend.Num();
+	}
+
+	/**
+	 * Store the result of a chunk that was sent.
+	 *
+	 * @param ChunkIndex Index of the chunk, as passed to the send function
+	 * @param Result Result of that chunk
+	 * @return true if this was the last chunk to complete, in which case the caller is the one that should merge the
+	 * results. false while chunks are still outstanding, or if the pipeline has failed.
+	 */
+	bool CompleteChunk(int32 ChunkIndex, ResultType&& Result)
+	{
+		FScopeLock Lock(&PipelineLock);
+		if (bHasFailed || !Results.IsValidIndex(ChunkIndex) || Results[ChunkIndex].IsSet())
+		{
+			return false;
+		}
+
+		Results[ChunkIndex] = MoveTemp(Result);
+		ChunksInFlight--;
+		CompletedChunkCount++;
+		return CompletedChunkCount == Chunks.Num();
+	}
+
+	/**
+	 * Mark the pipeline as failed, so that no more chunks are sent and outstanding results are dropped.
+	 *
+	 * @return true if this is the first failure, in which case the caller is the one that should report it
+	 */
+	bool Fail()
+	{
+		FScopeLock Lock(&PipelineLock);
+		if (bHasFailed)
+		{
+			return false;
+		}
+
+		bHasFailed = true;
+		return true;
+	}
+
+	bool HasFailed() const
+	{
+		FScopeLock Lock(&PipelineLock);
+		return bHasFailed;
+	}
+
+	int32 GetChunkCount() const
+	{
+		FScopeLock Lock(&PipelineLock);
+		return Chunks.Num();
+	}
+
+	int32 GetChunksInFlight() const
+	{
+		FScopeLock Lock(&PipelineLock);
+		return ChunksInFlight;
+	}
+
+	/**
+	 * Move the result of every chunk out of the pipeline, in chunk order. Meant to be called once CompleteChunk returned
+	 * true, chunks without a result are skipped.
+	 */
+	TArray<ResultType> ConsumeResultsInChunkOrder()
+	{
+		FScopeLock Lock(&PipelineLock);
+
+		TArray<ResultType> OrderedResults;
+		OrderedResults.Reserve(Results.Num());
+		for (TOptional<ResultType>& Result : Results)
+		{
+			if (Result.IsSet())
+			{
+				OrderedResults.Add(MoveTemp(Result.GetValue()));
+				Result.Reset();
+			}
+		}
+
+		return OrderedResults;
+	}
+
+private:
+	/** IDs of every chunk, in the order that they are sent */
+	TArray<TArray<FString>> Chunks;
+
+	/** Result of each chunk by chunk index, unset until the chunk completes */
+	TArray<TOptional<ResultType>> Results;
+
+	/** Index of the next chunk to send */
+	int32 NextChunkToSend = 0;
+
+	int32 ChunksInFlight = 0;
+
+	int32 CompletedChunkCount = 0;
+
+	int32 MaxChunksInFlight = 1;
+
+	bool bHasFailed = false;
+
+	/** Lock for all of the state above, responses may arrive on any thread */
+	mutable FCriticalSection PipelineLock;
+};
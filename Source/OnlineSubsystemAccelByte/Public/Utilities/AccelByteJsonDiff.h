@@ -0,0 +1,33 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Structural comparison of JSON objects, used to only send the parts of an object that changed since the backend last
+ * acknowledged it.
+ *
+ * Fields are compared by value rather than by their serialized text, so the order of fields and the formatting of
+ * numbers make no difference. Nested objects and arrays are compared as a whole, a change anywhere inside of them marks
+ * the whole top level field as changed.
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteJsonDiff
+{
+	/**
+	 * Compare the top level fields of two objects.
+	 *
+	 * @param OldObject Object as last acknowledged by the backend, may be null if there is none
+	 * @param NewObject Object that should replace it
+	 * @param OutChangedFields Object that every field of NewObject that is new, or that differs from the same field of
+	 * OldObject, is added to
+	 * @param OutRemovedFieldNames Names of the fields of OldObject that NewObject no longer has
+	 * @return true if the objects differ in any way
+	 */
+	static bool DiffTopLevelFields(const TSharedPtr<FJsonObject>& OldObject
+		, const TSharedRef<FJsonObject>& NewObject
+		, const TSharedRef<FJsonObject>& OutChangedFields
+		, TArray<FString>& OutRemovedFieldNames);
+};
@@ -0,0 +1,92 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Pages through an offset and limit endpoint whose total amount of items is not known up front, keeping up to a fixed
+ * amount of page requests in flight at once.
+ *
+ * The first page is sent on its own, so that a query that fits in one page costs a single request. Once it has come
+ * back full, the following pages are sent in the background up to the in flight limit. The first page to come back with
+ * fewer items than the page size marks the end, no pages past it are sent, and pages past it that were already in
+ * flight are expected to come back empty. The first page to fail fails the whole query.
+ *
+ * Pages are not merged here, callers are expected to handle the items of each page as it comes back.
+ *
+ * Every method is thread safe. The send function is never called with the internal lock held, so responses may complete
+ * their page and send the next ones from any thread.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelBytePagedQuery
+{
+public:
+	/** Sends the request for a single page, its response has to be reported through CompletePage or Fail */
+	typedef TFunction<void(int32 /*PageIndex*/, int32 /*Offset*/, int32 /*Limit*/)> FSendPage;
+
+	FAccelBytePagedQuery(int32 InPageSize, int32 InMaxPagesInFlight);
+
+	/**
+	 * Send as many pages as the in flight limit allows. Does nothing once the end is known or the query has failed.
+	 *
+	 * @param SendPage Function that sends the request for a page
+	 * @return Amount of pages that were sent
+	 */
+	int32 SendPendingPages(const FSendPage& SendPage);
+
+	/**
+	 * Report the amount of items that a page came back with.
+	 *
+	 * @param PageIndex Index of the page, as passed to the send function
+	 * @param ItemCount Amount of items in the response
+	 * @return true if this completed the query, as the end is known and no more pages are in flight. false while pages
+	 * are still outstanding, or if the query has failed.
+	 */
+	bool CompletePage(int32 PageIndex, int32 ItemCount);
+
+	/**
+	 * Mark the query as failed, so that no more pages are sent.
+	 *
+	 * @return true if this is the first failure, in which case the caller is the one that should report it
+	 */
+	bool Fail();
+
+	bool HasFailed() const;
+
+	/** Whether the end has been found and every page has come back */
+	bool IsComplete() const;
+
+	int32 GetPageSize() const
+	{
+		return PageSize;
+	}
+
+	int32 GetPagesInFlight() const;
+
+	/** Amount of items that completed pages came back with */
+	int32 GetItemCount() const;
+
+private:
+	int32 PageSize = 1;
+
+	int32 MaxPagesInFlight = 1;
+
+	/** Index of the next page to send */
+	int32 NextPageIndex = 0;
+
+	/** Index of the first page that came back short, or INDEX_NONE until one has */
+	int32 EndPageIndex = INDEX_NONE;
+
+	/** Pages that were sent and have not come back yet */
+	TSet<int32> PagesInFlight;
+
+	int32 CompletedPageCount = 0;
+
+	int32 ItemCount = 0;
+
+	bool bHasFailed = false;
+
+	/** Lock for all of the state above, responses may arrive on any thread */
+	mutable FCriticalSection QueryLock;
+};
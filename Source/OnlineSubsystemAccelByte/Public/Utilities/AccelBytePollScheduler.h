@@ -0,0 +1,103 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Schedules fallback polls, each identified by a key, ordered by the time at which they are due.
+ *
+ * Due times are kept in a min heap, so a tick with nothing due only looks at the earliest poll, and a tick with polls
+ * due only touches those. Scheduling a key that is already scheduled replaces the pending poll, and cancelling a key
+ * is a single map removal; the heap entry that it leaves behind is skipped once it reaches the top.
+ *
+ * Every method is thread safe. Polls are fired without the internal lock held, so a poll may schedule or cancel polls,
+ * including its own key, from within its callback.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelBytePollScheduler
+{
+public:
+	/** Called once a poll is due, the poll is no longer scheduled by then */
+	typedef TFunction<void()> FOnPollDue;
+
+	/**
+	 * Schedule a poll, replacing the poll that is pending for the same key if any.
+	 *
+	 * @param Key Key identifying the poll, used to cancel it
+	 * @param DueTimeSeconds Time at which the poll is due, on the same clock as the times passed to Tick
+	 * @param OnPollDue Function called once the poll is due
+	 */
+	void Schedule(const FString& Key, double DueTimeSeconds, FOnPollDue&& OnPollDue);
+
+	/**
+	 * Cancel the poll that is pending for a key.
+	 *
+	 * @return true if a poll was pending for the key
+	 */
+	bool Cancel(const FString& Key);
+
+	/** Cancel every pending poll */
+	void CancelAll();
+
+	bool IsScheduled(const FString& Key) const;
+
+	/** Amount of polls that are pending */
+	int32 GetScheduledCount() const;
+
+	/**
+	 * Fire every poll that is due, earliest first.
+	 *
+	 * @param NowSeconds Current time, on the same clock as the due times passed to Schedule
+	 * @return Amount of polls that were fired
+	 */
+	int32 Tick(double NowSeconds);
+
+	/**
+	 * Write every pending poll, earliest first, to the output device.
+	 *
+	 * @param NowSeconds Current time, used to log how long until each poll is due
+	 */
+	void Dump(FOutputDevice& Ar, double NowSeconds) const;
+
+private:
+	struct FScheduledPoll
+	{
+		double DueTimeSeconds = 0.0;
+
+		/** Matches the heap entry that is current for this poll, older heap entries for the key are stale */
+		uint64 Generation = 0;
+
+		FOnPollDue OnPollDue;
+	};
+
+	struct FHeapEntry
+	{
+		double DueTimeSeconds = 0.0;
+		uint64 Generation = 0;
+		FString Key;
+
+		bool operator<(const FHeapEntry& Other) const
+		{
+			return DueTimeSeconds < Other.DueTimeSeconds;
+		}
+	};
+
+	/** Pending polls by key */
+	TMap<FString, FScheduledPoll> ScheduledPolls;
+
+	/** Due time of every scheduled poll, including stale entries of polls that were since cancelled or rescheduled */
+	TArray<FHeapEntry> DueTimeHeap;
+
+	/** Generation handed to the next scheduled poll */
+	uint64 NextGeneration = 1;
+
+	/** Lock for all of the state above, notifications may cancel polls from any thread */
+	mutable FCriticalSection SchedulerLock;
+
+	/**
+	 * Rebuild the heap from the pending polls once stale entries make up most of it, so that polls that keep getting
+	 * rescheduled without firing do not grow it without bound. SchedulerLock has to be held by the caller.
+	 */
+	void CompactHeapIfNeeded();
+};
@@ -0,0 +1,148 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fixed capacity buffer that keeps the most recent elements added to it. Once full, adding an element overwrites the
+ * oldest one in place, so no element is ever moved.
+ *
+ * Elements can be read by their position from the oldest or from the newest, neither of which copies the buffer. Storage
+ * grows with the elements added up to the capacity, so a buffer that only ever holds a few elements stays small.
+ *
+ * Not thread safe, callers are expected to guard the buffer along with whatever owns it.
+ */
+template <typename ElementType>
+class TAccelByteRingBuffer
+{
+public:
+	explicit TAccelByteRingBuffer(int32 InCapacity = 1)
+		: Capacity(FMath::Max(InCapacity, 1))
+	{
+	}
+
+	/**
+	 * Add an element as the newest one, overwriting the oldest element if the buffer is full.
+	 */
+	void Add(const ElementType& Element)
+	{
+		if (Elements.Num() < Capacity)
+		{
+			Elements.Add(Element);
+		}
+		else
+		{
+			Elements[Head] = Element;
+			Head = (Head + 1) % Capacity;
+		}
+	}
+
+	void Add(ElementType&& Element)
+	{
+		if (Elements.Num() < Capacity)
+		{
+			Elements.Add(MoveTemp(Element));
+		}
+		else
+		{
+			Elements[Head] = MoveTemp(Element);
+			Head = (Head + 1) % Capacity;
+		}
+	}
+
+	/**
+	 * Get an element by its position from the oldest element.
+	 *
+	 * @param Index Position of the element, zero being the oldest element
+	 */
+	const ElementType& operator[](int32 Index) const
+	{
+		check(Index >= 0 && Index < Elements.Num());
+		return Elements[(Head + Index) % Elements.Num()];
+	}
+
+	/**
+	 * Get an element by its position from the newest element.
+	 *
+	 * @param Index Position of the element, zero being the newest element
+	 */
+	const ElementType& GetFromNewest(int32 Index) const
+	{
+		check(Index >= 0 && Index < Elements.Num());
+		return (*this)[Elements.Num() - 1 - Index];
+	}
+
+	/**
+	 * Call a function on the newest elements, newest first.
+	 *
+	 * @param MaxCount Maximum amount of elements to visit
+	 * @param Visitor Function called with each element
+	 */
+	template <typename VisitorType>
+	void ForEachFromNewest(int32 MaxCount, VisitorType&& Visitor) const
+	{
+		const int32 Count = FMath::Clamp(MaxCount, 0, Elements.Num());
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			Visitor(GetFromNewest(Index));
+		}
+	}
+
+	/** Amount of elements held, never more than the capacity */
+	int32 Num() const
+	{
+		return Elements.Num();
+	}
+
+	bool IsEmpty() const
+	{
+		return Elements.Num() == 0;
+	}
+
+	int32 GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	/**
+	 * Change the capacity, keeping the newest elements that fit in it.
+	 */
+	void SetCapacity(int32 InCapacity)
+	{
+		InCapacity = FMath::Max(InCapacity, 1);
+		if (InCapacity == Capacity)
+		{
+			return;
+		}
+
+		const int32 KeepCount = FMath::Min(Elements.Num(), InCapacity);
+		TArray<ElementType> Kept;
+		Kept.Reserve(KeepCount);
+		for (int32 Index = Elements.Num() - KeepCount; Index < Elements.Num(); Index++)
+		{
+			Kept.Add(MoveTemp(Elements[(Head + Index) % Elements.Num()]));
+		}
+
+		Elements = MoveTemp(Kept);
+		Head = 0;
+		Capacity = InCapacity;
+	}
+
+	/** Remove every element, keeping the capacity */
+	void Reset()
+	{
+		Elements.Reset();
+		Head = 0;
+	}
+
+private:
+	/** Elements in storage order, the oldest one is at Head once the buffer is full */
+	TArray<ElementType> Elements;
+
+	/** Storage index of the oldest element, stays zero until the buffer is full */
+	int32 Head = 0;
+
+	int32 Capacity = 1;
+};
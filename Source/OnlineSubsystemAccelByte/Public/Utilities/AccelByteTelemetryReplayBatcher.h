@@ -0,0 +1,85 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Models/AccelByteGameTelemetryModels.h"
+
+class FAccelByteTelemetrySpillQueue;
+
+/**
+ * Paces the replay of telemetry events cached before login, so that a large backlog goes out as a few bounded batches
+ * spread over several ticks rather than as one request per event in a single frame.
+ *
+ * Events are pulled from the spill queue that caches them one batch at a time, and are only committed to it once the
+ * batch has been handed over, so a crash mid replay loses none of the events that were not sent yet. Local users are
+ * replayed one after the other, in the order they were added.
+ *
+ * Each batch holds events of a single local user in the order they were queued, and stops before the event that would
+ * take it past the maximum amount of events or the maximum size. An event larger than the maximum size goes out in a
+ * batch of its own. No more than one batch is sent per tick, and batches are at least the batch interval apart. A tick
+ * that finds no events to send waits the batch interval as well, as looking for them may have read the spill file.
+ *
+ * Sizes are estimated from the condensed JSON payload and the event names, as the events are sent by the SDK.
+ *
+ * Every method is thread safe. The send function is never called with the internal lock held.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteTelemetryReplayBatcher
+{
+public:
+	/** Sends a batch of events for a local user, along with the estimated size of the batch in bytes */
+	typedef TFunctionRef<void(int32 /*LocalUserNum*/, const TArray<TSharedPtr<FAccelByteModelsTelemetryBody>>& /*Batch*/, int32 /*BatchSize*/)> FSendBatch;
+
+	FAccelByteTelemetryReplayBatcher(int32 InMaxBatchEvents = 50, int32 InMaxBatchSize = 64 * 1024, double InBatchIntervalSeconds = 1.0);
+
+	/** Set the maximum amount of events and the maximum estimated size in bytes of a single batch */
+	void SetBatchLimits(int32 InMaxBatchEvents, int32 InMaxBatchSize);
+
+	/** Set the minimum time between two batches */
+	void SetBatchInterval(double InBatchIntervalSeconds);
+
+	/**
+	 * Start replaying the events queued for a local user, once the local users added before it are done.
+	 */
+	void Add(int32 LocalUserNum);
+
+	/**
+	 * Send the next batch if a replay is in progress and the batch interval has passed since the previous tick that
+	 * looked for one. The batch is removed from the spill queue once the send function returns.
+	 *
+	 * @param CurrentTimeInSeconds Current time, as returned by FPlatformTime::Seconds
+	 * @param Queue Spill queue that holds the events to replay
+	 * @param SendBatch Function that sends the batch
+	 * @return Amount of events sent
+	 */
+	int32 Tick(double CurrentTimeInSeconds, FAccelByteTelemetrySpillQueue& Queue, FSendBatch SendBatch);
+
+	/**
+	 * Stop replaying the events of a local user. Events that were not sent yet stay in the spill queue.
+	 *
+	 * @return true if a replay of the local user was in progress
+	 */
+	bool Remove(int32 LocalUserNum);
+
+	/** Amount of local users whose events are still being replayed */
+	int32 GetReplayCount() const;
+
+	/** Estimated size in bytes of an event once sent */
+	static int32 GetEventSize(const FAccelByteModelsTelemetryBody& Event);
+
+private:
+	int32 MaxBatchEvents = 50;
+
+	int32 MaxBatchSize = 64 * 1024;
+
+	double BatchIntervalSeconds = 1.0;
+
+	/** Local users whose events are being replayed, in the order they were added */
+	TArray<int32> ReplayLocalUserNums;
+
+	/** Time from which the next batch may be sent */
+	double NextBatchTimeInSeconds = 0.0;
+
+	mutable FCriticalSection BatcherLock;
+};
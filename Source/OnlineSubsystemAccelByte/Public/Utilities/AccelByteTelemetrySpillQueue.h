@@ -0,0 +1,246 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Models/AccelByteGameTelemetryModels.h"
+
+/** Version of the spill file written by FAccelByteTelemetrySpillQueue, files of any other version are discarded on open */
+#define ACCELBYTE_TELEMETRY_SPILL_VERSION 3
+
+/**
+ * Queue of telemetry events that are held back until the user that they belong to logs in.
+ *
+ * New events go to a bounded buffer in memory. Without a spill file, events that arrive while the buffer is full are
+ * dropped. With a spill file, a full buffer is appended to the file in a single write and emptied, so a crash before
+ * login loses no more than the events still in the buffer. The buffer is also written out when the queue is destroyed.
+ *
+ * Events are handed out by peeking at them and committing them once sent. Peeks read spilled events back in bounded
+ * chunks, oldest first, and keep them in memory until they are committed, so committing never touches the file. Events
+ * of other local users that a peek reads past are kept in memory as well, until their own local user peeks. The file is
+ * rewritten without the committed events once those make up most of it, and reset once the queue is empty. Until then, a
+ * crash sends the committed events again on the next run rather than losing those that were not sent yet.
+ *
+ * Each event carries the AccelByte user ID of its owner, known once its local user logs in. As local user indices do not
+ * carry over between runs, events left in the file by a previous run are only handed to the local user of the same owner.
+ * Those without an owner, or that belong to another account, are dropped once read.
+ *
+ * Spill file layout, every integer is little endian:
+ * - Header of 8 bytes: uint32 magic "ABTS", uint16 version, uint16 header size
+ * - Records, appended one after the other: uint32 body size, uint32 CRC32 of the body, then the body itself
+ *
+ * A record body holds the int32 local user index that the event was queued for, the owner user ID as a uint16 byte
+ * length followed by UTF-8, the int64 UTC ticks of the client timestamp, the event namespace and event name in the same
+ * way as the owner, and the condensed JSON payload as a uint32 byte length followed by UTF-8. Reading stops at the first
+ * record that is cut short or fails its CRC, as happens when the game crashes mid write, and the file is cut back to the
+ * records before it.
+ *
+ * Every method is thread safe. Replay functions are called without the lock held.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteTelemetrySpillQueue
+{
+public:
+	/** Called with each replayed event, in the order that the events were queued */
+	typedef TFunctionRef<void(const TSharedPtr<FAccelByteModelsTelemetryBody>& /*Event*/)> FOnReplayEvent;
+
+	/** Events read by PeekEvents, still queued until they are passed to CommitEvents */
+	struct FPeekedEvents
+	{
+		int32 LocalUserNum = INDEX_NONE;
+
+		/** Events in the order they were queued */
+		TArray<TSharedPtr<FAccelByteModelsTelemetryBody>> Events;
+
+		/** Bookkeeping of the queue, the ID that the queue knows each event by */
+		TArray<int64> EventIds;
+	};
+
+	explicit FAccelByteTelemetrySpillQueue(int32 InMaxInMemoryEvents = 256);
+
+	~FAccelByteTelemetrySpillQueue();
+
+	/**
+	 * Start spilling to a file, keeping the events that a previous run left in it. Expected to be called before any event
+	 * is peeked at.
+	 *
+	 * @param InFilePath Path of the spill file, created along with its directory if missing
+	 * @param InMaxFileSize Size in bytes past which new events are dropped rather than written
+	 * @return true if the file is open for appending
+	 */
+	bool OpenSpillFile(const FString& InFilePath, int64 InMaxFileSize);
+
+	/** Set the maximum amount of events buffered in memory before they are spilled */
+	void SetMaxInMemoryEvents(int32 InMaxInMemoryEvents);
+
+	/**
+	 * Queue an event for a local user, owned by the user set for that local user if any.
+	 */
+	void Enqueue(int32 LocalUserNum, const TSharedPtr<FAccelByteModelsTelemetryBody>& Event);
+
+	/**
+	 * Set the AccelByte user ID of the user that logged in as a local user. Events queued for the local user so far, and
+	 * from now on, belong to that user, as do the events of a previous run that the user owned. Rewrites the spill file if
+	 * some of the events of the local user were spilled, so that they keep their owner should the game crash.
+	 */
+	void SetOwner(int32 LocalUserNum, const FString& OwnerUserId);
+
+	/**
+	 * Hand every event queued for one local user over to another, for events that were queued before the local user
+	 * index was known. Rewrites the spill file if some of those events were spilled.
+	 */
+	void MoveEvents(int32 FromLocalUserNum, int32 ToLocalUserNum);
+
+	/**
+	 * Read the oldest events of a local user without removing them from the queue. Goes through as much of the spill file
+	 * as it takes to find events of the local user, then stops at the end of the first chunk of about a megabyte that has
+	 * any, so fewer events than asked for may come back while more are queued.
+	 *
+	 * @param LocalUserNum Index of the local user that logged in
+	 * @param MaxEvents Maximum amount of events to read
+	 * @param OutPeeked Events read, to be passed to CommitEvents once handed over
+	 * @return Amount of events read
+	 */
+	int32 PeekEvents(int32 LocalUserNum, int32 MaxEvents, FPeekedEvents& OutPeeked);
+
+	/**
+	 * Remove the first events of a peek from the queue, once they have been handed over. Events that were committed
+	 * already, or spilled since the peek, are not removed, and the latter are peeked again.
+	 *
+	 * @param Peeked Events read by PeekEvents
+	 * @param Count Amount of events to remove, from the start of the peek
+	 * @return Amount of events removed
+	 */
+	int32 CommitEvents(const FPeekedEvents& Peeked, int32 Count);
+
+	/**
+	 * Hand out every event queued for a local user so far, along with the events of a previous run that its owner left,
+	 * and remove them from the queue. Events are read and removed in bounded steps.
+	 *
+	 * @param LocalUserNum Index of the local user that logged in
+	 * @param OnEvent Function called with each event
+	 * @return Amount of events handed out
+	 */
+	int32 ReplayEvents(int32 LocalUserNum, FOnReplayEvent OnEvent);
+
+	/**
+	 * Remove the events of a local user from the queue without handing them out, and forget its owner. Rewrites the spill
+	 * file if some of those events were spilled. Events left by a previous run are kept.
+	 *
+	 * @return Amount of events removed from the queue
+	 */
+	int32 RemoveEvents(int32 LocalUserNum);
+
+	/** Amount of events queued, those left by a previous run that were not read yet included */
+	int32 GetEventCount() const;
+
+	/**
+	 * Amount of events queued for a local user. Once the local user has an owner, also counts the events left by a
+	 * previous run that were not read yet, as some of them may turn out to be its own.
+	 */
+	int32 GetEventCount(int32 LocalUserNum) const;
+
+	/** Amount of events held in memory, whether buffered or read back from the spill file */
+	int32 GetInMemoryEventCount() const;
+
+	/** Amount of events dropped as the queue or the spill file was full, or as nobody could own them */
+	int32 GetDroppedEventCount() const;
+
+	/** Size of the spill file in bytes, or zero without one */
+	int64 GetSpillFileSize() const;
+
+private:
+	struct FQueuedEvent
+	{
+		int32 LocalUserNum;
+
+		/** AccelByte user ID of the owner, empty until its local user logs in */
+		FString OwnerUserId;
+
+		TSharedPtr<FAccelByteModelsTelemetryBody> Event;
+
+		/** Unique within the queue, never reused */
+		int64 EventId;
+
+		/** Size of the record that the event was read from, or zero for a buffered event */
+		int64 RecordSize;
+	};
+
+	/** Append the buffered events to the spill file, dropping those that do not fit, and empty the buffer */
+	void SpillBufferedEvents();
+
+	/** Read chunks of the spill file into memory, up to the first chunk that holds events of a local user */
+	void ReadSpilledEvents(int32 LocalUserNum, int32 MaxEvents);
+
+	/** Remove the events of a list that a predicate matches, taking them off the count of their local user */
+	int32 RemoveQueuedEvents(TArray<FQueuedEvent>& Events, TFunctionRef<bool(const FQueuedEvent&)> Predicate);
+
+	/** Take events off the count of a local user */
+	void DecrementEventCount(int32 LocalUserNum, int32 Count);
+
+	/**
+	 * Reset the spill file once no events are left, or rewrite it once committed events make up most of it.
+	 *
+	 * @param bForce Rewrite the file if it holds any committed events
+	 */
+	void CompactIfNeeded(bool bForce = false);
+
+	/** Whether a record of the spill file was left by a previous run */
+	bool IsPreviousRunRecord(int64 RecordOffset, int32 RecordedLocalUserNum) const;
+
+	/**
+	 * Write the events read out of the spill file that are still queued to a new file, followed by the records that were
+	 * not read yet, and move it over the spill file.
+	 *
+	 * @param ResolveRecord Called with the local user and owner of each unread record of this run, may change them, or
+	 * return false to drop the record
+	 */
+	bool RewriteSpillFile(TFunctionRef<bool(int32& /*LocalUserNum*/, FString& /*OwnerUserId*/)> ResolveRecord);
+
+	/** Replace the spill file with one that holds no records */
+	bool ResetSpillFile();
+
+	int32 GetEventCountLocked() const;
+
+	int32 GetEventCountLocked(int32 LocalUserNum) const;
+
+	int32 MaxInMemoryEvents = 256;
+
+	/** Events queued since the buffer was last spilled, oldest first */
+	TArray<FQueuedEvent> BufferedEvents;
+
+	/** Events read out of the spill file that are still queued, oldest first, all older than the buffered events */
+	TArray<FQueuedEvent> ReadEvents;
+
+	int64 NextEventId = 0;
+
+	/** Amount of events queued for each local user, events of a previous run included once read */
+	TMap<int32, int32> LocalUserNumToEventCount;
+
+	TMap<int32, FString> LocalUserNumToOwnerUserId;
+
+	/** Amount of events left by a previous run that were not read yet */
+	int32 PreviousRunEventCount = 0;
+
+	int32 DroppedEventCount = 0;
+
+	FString FilePath;
+
+	TUniquePtr<IFileHandle> WriteHandle;
+
+	int64 FileSize = 0;
+
+	int64 MaxFileSize = 0;
+
+	/** Records of the spill file before this offset were read into memory */
+	int64 FileReadOffset = 0;
+
+	/** Records of the spill file before this offset were left by a previous run */
+	int64 RunStartOffset = 0;
+
+	/** Whether a spill did not fit in the file, new events are dropped until the file is rewritten */
+	bool bIsSpillFileFull = false;
+
+	mutable FCriticalSection QueueLock;
+};
@@ -0,0 +1,66 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+
+/**
+ * Prefix of the compact string form of a user ID. It is not part of the Base64 alphabet, so a compact string can never
+ * be mistaken for the legacy Base64 JSON form, and both can be read side by side.
+ */
+#define ACCELBYTE_COMPACT_ID_PREFIX TEXT("~")
+
+/** Version of the compact binary form written by FAccelByteUniqueIdCompactCodec, other versions are rejected on decode */
+#define ACCELBYTE_COMPACT_ID_VERSION 1
+
+/**
+ * Compact, versioned binary form of an AccelByte user ID composite, as an alternative to the Base64 encoded JSON form.
+ *
+ * Version 1 layout:
+ * - uint8 version
+ * - uint8 flags, bit 0 set when the AccelByte ID is stored as a string rather than as a 16 byte UUID
+ * - AccelByte ID, either 16 raw bytes of the lowercase hex UUID, or a length prefixed UTF-8 string
+ * - uint8 platform type, zero for none, an index into the known platform types, or 0xFF for a custom type followed by
+ *   a length prefixed UTF-8 string
+ * - Platform ID as a length prefixed UTF-8 string
+ *
+ * Lengths are unsigned LEB128 varints. A typical ID with platform information takes under 40 bytes, compared to well
+ * over 100 for the legacy form.
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteUniqueIdCompactCodec
+{
+	/**
+	 * Append the compact form of a composite to a byte array.
+	 *
+	 * @param CompositeId Composite to encode
+	 * @param OutBytes Array that the encoded bytes are appended to
+	 */
+	static void Encode(FAccelByteUniqueIdComposite const& CompositeId, TArray<uint8>& OutBytes);
+
+	/**
+	 * Decode a composite from the start of a buffer. Safe to call on untrusted input, any truncated or malformed data
+	 * fails the decode rather than reading out of bounds.
+	 *
+	 * @param Data Start of the encoded data
+	 * @param Size Amount of bytes available from Data
+	 * @param OutCompositeId Decoded composite
+	 * @param OutBytesRead Amount of bytes the encoded composite took
+	 * @return true if a composite was decoded
+	 */
+	static bool Decode(uint8 const* Data, int32 Size, FAccelByteUniqueIdComposite& OutCompositeId, int32& OutBytesRead);
+
+	/** Encode a composite into its compact string form, ACCELBYTE_COMPACT_ID_PREFIX followed by the Base64 bytes */
+	static FString EncodeToString(FAccelByteUniqueIdComposite const& CompositeId);
+
+	/**
+	 * Decode a composite from its compact string form.
+	 *
+	 * @return true if the string was a valid compact string
+	 */
+	static bool DecodeFromString(FString const& InString, FAccelByteUniqueIdComposite& OutCompositeId);
+
+	/** Whether the string is in the compact string form, without validating the rest of it */
+	static bool IsCompactString(FString const& InString);
+};
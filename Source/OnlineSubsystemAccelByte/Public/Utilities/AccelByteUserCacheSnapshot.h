@@ -0,0 +1,106 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineUserCacheAccelByte.h"
+
+/** Version of the snapshot written by FAccelByteUserCacheSnapshot, snapshots of any other version are ignored on load */
+#define ACCELBYTE_USER_CACHE_SNAPSHOT_VERSION 2
+
+/**
+ * Compact, versioned binary snapshot of cached users, so that a new game session can start with the users that the
+ * previous one had already queried. A snapshot is tied to the namespace and base URL that it was written for, and is
+ * discarded when read for any other, so that users of one environment never show up in another.
+ *
+ * Version 2 layout, every integer is little endian:
+ * - Header: uint32 magic "ABUC", uint16 version, uint16 header size, uint32 record count, uint32 record area size, int64
+ *   UTC ticks at which the snapshot was written, the namespace and base URL as strings, and uint32 CRC32 of the preceding
+ *   header bytes
+ * - Offset table: one uint32 per record, the offset of that record from the start of the record area
+ * - Record area: per record, uint32 body size, uint32 CRC32 of the body, then the body itself
+ *
+ * A record body holds the compact form of the user ID (see FAccelByteUniqueIdCompactCodec), the int64 UTC ticks at which
+ * the user was last updated, the display name, unique display name, public code, game avatar URL and publisher avatar
+ * URL, and then a uint8 count of linked platform entries, each made of a compact ID, platform ID, display name and
+ * avatar URL. Strings are a uint16 byte length followed by UTF-8.
+ *
+ * The offset table lets a reader jump to any record of a memory mapped file without parsing the ones before it. Reading
+ * is safe on untrusted input: a bad header discards the whole snapshot, and a record that is out of bounds or fails its
+ * CRC is skipped on its own. Importance and forced staleness are session state, and are not stored.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelByteUserCacheSnapshot
+{
+public:
+
+	/**
+	 * @param InNamespace Namespace that the users of this snapshot were queried from
+	 * @param InBaseUrl Base URL of the environment that the users of this snapshot were queried from
+	 */
+	FAccelByteUserCacheSnapshot(const FString& InNamespace, const FString& InBaseUrl);
+
+	/**
+	 * Append a user to the snapshot.
+	 *
+	 * @param User User to append, only read during the call
+	 */
+	void AddUser(const FAccelByteUserInfo& User);
+
+	/** Amount of users appended so far */
+	int32 GetUserCount() const
+	{
+		return RecordOffsets.Num();
+	}
+
+	/** Size in bytes of the header that Serialize writes, the offset table starts right after it */
+	int32 GetHeaderSize() const;
+
+	/**
+	 * Write the full snapshot, header and offset table included.
+	 *
+	 * @param OutBytes Array that is replaced by the snapshot
+	 */
+	void Serialize(TArray<uint8>& OutBytes) const;
+
+	/**
+	 * Read every intact user out of a snapshot.
+	 *
+	 * @param Data Start of the snapshot
+	 * @param Size Amount of bytes available from Data
+	 * @param Namespace Namespace that the snapshot has to be written for
+	 * @param BaseUrl Base URL that the snapshot has to be written for
+	 * @param OutUsers Users read from the snapshot, in the order they were added
+	 * @param OutCorruptRecordCount Amount of records that were skipped as they failed validation
+	 * @return true if the header was valid and matched the namespace and base URL, false if the whole snapshot was discarded
+	 */
+	static bool Deserialize(uint8 const* Data, int64 Size, const FString& Namespace, const FString& BaseUrl, TArray<FAccelByteUserInfoRef>& OutUsers, int32& OutCorruptRecordCount);
+
+	/**
+	 * Write a serialized snapshot to disk. The snapshot is written next to the target first and then moved over it, so
+	 * that a crash while writing never leaves a half written snapshot in place.
+	 *
+	 * @return true if the snapshot was written
+	 */
+	static bool SaveToFile(const FString& FilePath, const TArray<uint8>& Bytes);
+
+	/**
+	 * Read a snapshot from disk, memory mapping the file where the platform supports it.
+	 *
+	 * @return true if the file exists and its header was valid and matched the namespace and base URL
+	 */
+	static bool LoadFromFile(const FString& FilePath, const FString& Namespace, const FString& BaseUrl, TArray<FAccelByteUserInfoRef>& OutUsers, int32& OutCorruptRecordCount);
+
+private:
+
+	/** Namespace and base URL written to the header */
+	FString Namespace;
+	FString BaseUrl;
+
+	/** Every record appended so far, laid out as in the record area */
+	TArray<uint8> Records;
+
+	/** Offset of each record within Records */
+	TArray<uint32> RecordOffsets;
+
+};